@@ -159,6 +159,22 @@ static inline int mbox_try_get(mbox_t *mbox, msg_t *msg)
     return _mbox_get(mbox, msg, NON_BLOCKING);
 }
 
+/**
+ * @brief Get multiple messages from mailbox
+ *
+ * Takes up to @p num of the queued messages within a single critical section.
+ * Writers blocked on the full mailbox are woken up for every message taken,
+ * with at most one context switch. If the mailbox is empty, this function
+ * will return right away.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[out] msgs array of @p num messages to store the retrieved messages
+ * @param[in] num   maximum number of messages to retrieve
+ *
+ * @return  number of messages retrieved, 0 if the mailbox was empty
+ */
+unsigned mbox_try_get_many(mbox_t *mbox, msg_t *msgs, unsigned num);
+
 #ifdef __cplusplus
 }
 #endif
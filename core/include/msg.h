@@ -309,6 +309,47 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Send multiple messages to the same thread at once
+ *
+ * All messages are passed to the target thread within a single critical
+ * section and the target is woken up at most once. If the target is waiting
+ * for a message, the first message is copied directly to it, the others are
+ * put into its message queue. Messages that do not fit into the message queue
+ * are not sent, this function never blocks.
+ *
+ * The order of the messages is preserved. The value of ``sender_pid`` of each
+ * message sent is set like msg_send() and msg_send_int() do.
+ *
+ * Can be called from interrupt context.
+ *
+ * @param[in] m             Array of @p num messages, must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return  Number of messages sent, i.e. the first messages of @p m that were
+ *          passed to the target
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
+/**
+ * @brief Receive multiple messages at once
+ *
+ * This function blocks until at least one message was received. Then all
+ * messages already queued for the calling thread are copied to @p m, up to
+ * @p num, within a single critical section.
+ *
+ * @pre     @p num > 0
+ *
+ * @param[out] m    Array of @p num preallocated ``msg_t`` structures, must not
+ *                  be NULL.
+ * @param[in] num   Maximum number of messages to receive.
+ *
+ * @return  Number of messages received, at least 1.
+ */
+int msg_receive_many(msg_t *m, unsigned num);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -123,3 +123,33 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
         return 0;
     }
 }
+
+unsigned mbox_try_get_many(mbox_t *mbox, msg_t *msgs, unsigned num)
+{
+    unsigned irqstate = irq_disable();
+    unsigned count = 0;
+    uint16_t wake_priority = SCHED_PRIO_LEVELS;
+
+    while ((count < num) && cib_avail(&mbox->cib)) {
+        /* copy msg from queue */
+        msgs[count++] = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
+        /* every message taken frees a slot for a blocked writer */
+        list_node_t *next = list_remove_head(&mbox->writers);
+        if (next) {
+            thread_t *thread = container_of((clist_node_t *)next, thread_t,
+                                            rq_entry);
+            sched_set_status(thread, STATUS_PENDING);
+            if (thread->priority < wake_priority) {
+                wake_priority = thread->priority;
+            }
+        }
+    }
+    DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: "
+          "mbox_try_get_many(): got %u queued messages.\n", thread_getpid(),
+          (unsigned)mbox, count);
+    irq_restore(irqstate);
+    if (wake_priority < SCHED_PRIO_LEVELS) {
+        sched_switch(wake_priority);
+    }
+    return count;
+}
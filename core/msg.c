@@ -267,6 +267,70 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = (in_irq) ? KERNEL_PID_ISR : thread_getpid();
+    unsigned count = 0;
+    bool woken = false;
+
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_many(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("msg_send_many(): target thread %d does not exist\n", target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_many(): Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", sender_pid, target_pid);
+        /* the queue of a receive blocked thread is empty, so the first
+         * message goes directly to the target and the rest is queued */
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        count++;
+    }
+
+    for (; count < num; count++) {
+        int n = cib_put(&(target->msg_queue));
+
+        if (n < 0) {
+            DEBUG("msg_send_many(): message queue is full (or there is none), "
+                  "%u of %u messages sent\n", count, num);
+            break;
+        }
+        m[count].sender_pid = sender_pid;
+        target->msg_array[n] = m[count];
+    }
+
+#if MODULE_CORE_THREAD_FLAGS
+    if (count > (unsigned)woken) {
+        target->flags |= THREAD_FLAG_MSG_WAITING;
+        thread_flags_wake(target);
+    }
+#endif
+
+    if (woken && in_irq) {
+        sched_context_switch_request = 1;
+    }
+    irq_restore(state);
+    if (woken && !in_irq) {
+        thread_yield_higher();
+    }
+
+    return count;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
@@ -428,6 +492,43 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* gets up to num messages from the queue of the current thread without
+ * blocking, returns 0 if there are waiting senders to let _msg_receive()
+ * handle them */
+static unsigned _msg_receive_queued(msg_t *m, unsigned num)
+{
+    unsigned count = 0;
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+
+    if (thread_has_msg_queue(me) && !me->msg_waiters.next) {
+        int queue_index;
+
+        while ((count < num) &&
+               ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            m[count++] = me->msg_array[queue_index];
+        }
+    }
+    irq_restore(state);
+
+    return count;
+}
+
+int msg_receive_many(msg_t *m, unsigned num)
+{
+    assert(num > 0);
+
+    unsigned count = _msg_receive_queued(m, num);
+
+    if (count == 0) {
+        _msg_receive(m, 1);
+        /* a sender may have queued more messages while waking us up */
+        count = 1 + _msg_receive_queued(m + 1, num - 1);
+    }
+
+    return count;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -33,6 +33,10 @@
 #include "mpu.h"
 #endif
 
+#ifdef MODULE_SCHED_LATENCY
+#include "sched_latency.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -142,6 +146,9 @@ thread_t *__attribute__((used)) sched_run(void)
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {
         if (active_thread) {
             _unschedule(active_thread);
+#ifdef MODULE_SCHED_LATENCY
+            sched_latency_run(active_thread, NULL);
+#endif
             active_thread = NULL;
         }
 
@@ -165,6 +172,10 @@ thread_t *__attribute__((used)) sched_run(void)
 
     next_thread->status = STATUS_RUNNING;
 
+#ifdef MODULE_SCHED_LATENCY
+    sched_latency_run(active_thread, next_thread);
+#endif
+
     if (previous_thread == next_thread) {
 #ifdef MODULE_SCHED_CB
         /* Call the sched callback again only if the active thread is NULL. When
@@ -220,6 +231,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
             clist_rpush(&sched_runqueues[process->priority],
                         &(process->rq_entry));
             _set_runqueue_bit(process);
+#ifdef MODULE_SCHED_LATENCY
+            sched_latency_wakeup(process);
+#endif
         }
     }
     else {
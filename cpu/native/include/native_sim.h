@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Discrete-event simulation mode of native
+ *
+ * With the `native_sim` module, a native instance started with
+ * `--sim=<addr>:<port>` runs on a virtual clock controlled by the simulation
+ * coordinator in `dist/tools/native_sim`. The timer does not expire in real
+ * time. Instead, whenever the instance is idle, it reports the deadline of
+ * its timer to the coordinator and waits until the coordinator advances its
+ * clock, either to that deadline or to the time a frame from its
+ * `socket_zep` interface is delivered to it. The coordinator forwards
+ * the ZEP frames between the instances over a radio medium with
+ * configurable loss and delay.
+ *
+ * Without the `--sim` option, the instance runs in real time as usual.
+ *
+ * An instance that busy-waits does not get idle, so the coordinator cannot
+ * advance its clock. To let busy-waits on the timer, e.g. ztimer_spin() or
+ * delay loops of drivers, terminate anyway, every read of the timer but the
+ * first one after an advance moves the clock of the instance forward by
+ * @ref CONFIG_NATIVE_SIM_READ_US. The timer fires when its deadline is passed
+ * this way. This time is only accounted to the instance itself: frames it
+ * sends meanwhile are still scheduled at the time of the coordinator.
+ *
+ * @note    Input on stdin is only handled when the instance is advanced by
+ *          the coordinator.
+ *
+ * @warning A busy-wait that does not read the timer, e.g. polling a flag
+ *          that only an interrupt of the timer or a received frame would
+ *          set, never ends and stalls the whole simulation.
+ */
+#ifndef NATIVE_SIM_H
+#define NATIVE_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Virtual time in microseconds a read of the timer takes
+ *
+ * Applies to all reads but the first one after the clock was advanced.
+ */
+#ifndef CONFIG_NATIVE_SIM_READ_US
+#define CONFIG_NATIVE_SIM_READ_US   (1U)
+#endif
+
+/**
+ * @brief   Deadline of an instance without a running timer
+ */
+#define NATIVE_SIM_NEVER            (UINT64_MAX)
+
+/**
+ * @name    Message types of the simulation control protocol
+ * @{
+ */
+#define NATIVE_SIM_MSG_IDLE         (1U)    /**< instance to coordinator: idle
+                                             *   until the deadline */
+#define NATIVE_SIM_MSG_ADVANCE      (2U)    /**< coordinator to instance:
+                                             *   advance the clock */
+/** @} */
+
+/**
+ * @brief   Message of the simulation control protocol
+ *
+ * All fields are in network byte order.
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;           /**< message type */
+    uint8_t reserved[3];    /**< reserved, set to 0 */
+    uint32_t id;            /**< instance id (`--id`) */
+    uint32_t step;          /**< step of the coordinator the message refers to */
+    uint64_t time;          /**< deadline (idle) or virtual time (advance)
+                             *   in microseconds */
+} native_sim_msg_t;
+
+/**
+ * @brief   Connect to the simulation coordinator
+ *
+ * Called by startup code when the `--sim` option is given.
+ *
+ * @param[in] addr  address of the coordinator
+ * @param[in] port  port of the coordinator
+ */
+void native_sim_init(const char *addr, const char *port);
+
+/**
+ * @brief   Check if the instance runs on the virtual clock
+ *
+ * @return  true, if the instance is connected to a coordinator
+ */
+bool native_sim_active(void);
+
+/**
+ * @brief   Get the virtual time
+ *
+ * @return  virtual time in microseconds
+ */
+uint64_t native_sim_now(void);
+
+/**
+ * @brief   Read the virtual time for the timer
+ *
+ * Unlike native_sim_now(), all calls but the first one since the clock was
+ * last advanced move the clock forward by @ref CONFIG_NATIVE_SIM_READ_US.
+ * SIGALRM is raised if the deadline of the timer is reached this way.
+ *
+ * @return  virtual time in microseconds
+ */
+uint64_t native_sim_read(void);
+
+/**
+ * @brief   Set the deadline of the timer
+ *
+ * SIGALRM is raised when the clock is advanced to @p deadline.
+ *
+ * @param[in] deadline  virtual time in microseconds, @ref NATIVE_SIM_NEVER
+ *                      to clear the timer
+ */
+void native_sim_timer_set(uint64_t deadline);
+
+/**
+ * @brief   Report idle to the coordinator and wait to be advanced
+ *
+ * Called instead of pause() when the instance is idle.
+ */
+void native_sim_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_SIM_H */
+/** @} */
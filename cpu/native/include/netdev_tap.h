@@ -24,6 +24,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/netdev.h"
 
@@ -35,6 +36,21 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames received per device interrupt
+ *
+ * Frames that are already pending on the TAP when one was received are
+ * fetched right away instead of raising a new interrupt for each, so an upper
+ * layer can handle them in a batch (see `gnrc_netif_rx_batch`).
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BURST
+#if defined(MODULE_GNRC_NETIF_RX_BATCH)
+#define CONFIG_NETDEV_TAP_RX_BURST  (8U)
+#else
+#define CONFIG_NETDEV_TAP_RX_BURST  (1U)
+#endif
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +60,10 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscuous;                 /**< Flag for promiscuous mode */
+    uint8_t rx_burst;                   /**< Frames left to receive in the
+                                             current interrupt */
+    bool rx_pending;                    /**< More frames pending within the
+                                             current interrupt */
 } netdev_tap_t;
 
 /**
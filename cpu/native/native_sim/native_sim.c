@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Discrete-event simulation mode of native
+ *
+ * @}
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "byteorder.h"
+#include "native_internal.h"
+#include "native_sim.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _sock = -1;
+static uint64_t _now;
+static uint64_t _deadline = NATIVE_SIM_NEVER;
+static uint32_t _step;
+static bool _read;
+
+void native_sim_init(const char *addr, const char *port)
+{
+    int res;
+    static const struct addrinfo hints = { .ai_family = AF_UNSPEC,
+                                           .ai_socktype = SOCK_DGRAM };
+    struct addrinfo *ai = NULL, *remote;
+
+    if ((res = real_getaddrinfo(addr, port, &hints, &ai)) < 0) {
+        errx(EXIT_FAILURE, "native_sim: unable to get coordinator address: %s\n",
+             gai_strerror(res));
+    }
+    for (remote = ai; remote != NULL; remote = remote->ai_next) {
+        if ((_sock = real_socket(remote->ai_family, remote->ai_socktype,
+                                 remote->ai_protocol)) < 0) {
+            continue;
+        }
+        if (real_connect(_sock, remote->ai_addr, remote->ai_addrlen) == 0) {
+            break;  /* successfully connected */
+        }
+        real_close(_sock);
+        _sock = -1;
+    }
+    real_freeaddrinfo(ai);
+    if (_sock < 0) {
+        err(EXIT_FAILURE, "native_sim: unable to connect to coordinator");
+    }
+}
+
+bool native_sim_active(void)
+{
+    return _sock >= 0;
+}
+
+uint64_t native_sim_now(void)
+{
+    return _now;
+}
+
+uint64_t native_sim_read(void)
+{
+    /* an instance busy-waiting on the timer never gets idle to be advanced,
+     * so let the reads take time */
+    if (_read) {
+        _now += CONFIG_NATIVE_SIM_READ_US;
+        if (_deadline <= _now) {
+            _deadline = NATIVE_SIM_NEVER;
+            kill(_native_pid, SIGALRM);
+        }
+    }
+    _read = true;
+    return _now;
+}
+
+void native_sim_timer_set(uint64_t deadline)
+{
+    DEBUG("native_sim: timer set to %" PRIu64 " at %" PRIu64 "\n",
+          deadline, _now);
+    _deadline = deadline;
+}
+
+void native_sim_idle(void)
+{
+    native_sim_msg_t msg = {
+        .type = NATIVE_SIM_MSG_IDLE,
+        .id = htonl(_native_id),
+        .step = htonl(_step),
+        .time = htonll(_deadline),
+    };
+    sigset_t sigio, oldmask;
+
+    /* frames are delivered before the clock is advanced for them, so they
+     * must only be handled after the advance */
+    sigemptyset(&sigio);
+    sigaddset(&sigio, SIGIO);
+    sigprocmask(SIG_BLOCK, &sigio, &oldmask);
+    if (real_write(_sock, &msg, sizeof(msg)) != sizeof(msg)) {
+        err(EXIT_FAILURE, "native_sim: unable to report idle");
+    }
+    while (1) {
+        ssize_t res = real_read(_sock, &msg, sizeof(msg));
+
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            err(EXIT_FAILURE, "native_sim: unable to receive from coordinator");
+        }
+        if ((res == sizeof(msg)) && (msg.type == NATIVE_SIM_MSG_ADVANCE)) {
+            break;
+        }
+        DEBUG("native_sim: ignoring unexpected message\n");
+    }
+    _step = ntohl(msg.step);
+    _read = false;
+    if (ntohll(msg.time) > _now) {
+        _now = ntohll(msg.time);
+    }
+    DEBUG("native_sim: step %" PRIu32 " advanced to %" PRIu64 "\n", _step, _now);
+    if (_deadline <= _now) {
+        _deadline = NATIVE_SIM_NEVER;
+        kill(_native_pid, SIGALRM);
+    }
+    sigprocmask(SIG_SETMASK, &oldmask, NULL);
+}
@@ -21,6 +21,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -96,8 +97,18 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
 
 static inline void _isr(netdev_t *netdev)
 {
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
     if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        dev->rx_burst = CONFIG_NETDEV_TAP_RX_BURST;
+        dev->rx_pending = false;
+        do {
+            /* on the last frame of the burst _continue_reading() raises a
+             * new interrupt if frames are still pending */
+            dev->rx_burst--;
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        } while (dev->rx_pending && (dev->rx_burst > 0));
+        dev->rx_burst = 0;
     }
 #if DEVELHELP
     else {
@@ -177,18 +188,34 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
+/* checks without blocking whether a frame can be read from the TAP */
+static bool _frame_pending(netdev_tap_t *dev)
+{
+    struct pollfd pfd = { .fd = dev->tap_fd, .events = POLLIN };
+    bool pending;
+
+    _native_in_syscall++; /* no switching here */
+    pending = (real_poll(&pfd, 1, 0) == 1) && (pfd.revents & POLLIN);
+    _native_in_syscall--;
+
+    return pending;
+}
+
 static void _continue_reading(netdev_tap_t *dev)
 {
     /* work around lost signals */
-    fd_set rfds;
-    struct timeval t;
-    memset(&t, 0, sizeof(t));
-    FD_ZERO(&rfds);
-    FD_SET(dev->tap_fd, &rfds);
+    bool pending = _frame_pending(dev);
+
+    if (pending && (dev->rx_burst > 0)) {
+        /* fetched by _isr() within the current burst */
+        dev->rx_pending = true;
+        DEBUG("netdev_tap: more frames pending\n");
+        return;
+    }
 
     _native_in_syscall++; /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if (pending) {
         int sig = SIGIO;
         extern int _sig_pipefd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -224,16 +251,28 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
+            dev->rx_pending = false;
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
 
             _continue_reading(dev);
         }
+        else if (!dev->rx_pending && !_frame_pending(dev)) {
+            /* nothing to read (e.g. the frame that raised the interrupt was
+             * already read within the last burst), so do not make the upper
+             * layer allocate space for a frame */
+            DEBUG("netdev_tap: no frame pending\n");
+            native_async_read_continue(dev->tap_fd);
+            return 0;
+        }
 
         /* no way of figuring out packet size without racey buffering,
          * so we return the maximum possible size */
         return ETHERNET_FRAME_LEN;
     }
 
+    /* set again by _continue_reading() if another frame is pending */
+    dev->rx_pending = false;
+
     int nread = real_read(dev->tap_fd, buf, len);
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
@@ -247,7 +286,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
+            _continue_reading(dev);
 
             return 0;
         }
@@ -258,6 +297,8 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     }
     else if (nread == -1) {
         if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            DEBUG("netdev_tap: no frame pending\n");
+            native_async_read_continue(dev->tap_fd);
         }
         else {
             err(EXIT_FAILURE, "netdev_tap: read");
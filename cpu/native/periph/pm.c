@@ -26,6 +26,10 @@
 #include "async_read.h"
 #include "tty_uart.h"
 
+#ifdef MODULE_NATIVE_SIM
+#include "native_sim.h"
+#endif
+
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
 #include "spidev_linux.h"
 #endif
@@ -39,7 +43,15 @@
 void pm_set_lowest(void)
 {
     _native_in_syscall++; /* no switching here */
-    real_pause();
+#ifdef MODULE_NATIVE_SIM
+    if (native_sim_active()) {
+        native_sim_idle();
+    }
+    else
+#endif
+    {
+        real_pause();
+    }
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
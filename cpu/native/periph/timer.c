@@ -47,6 +47,9 @@
 #include "cpu_conf.h"
 #include "native_internal.h"
 #include "periph/timer.h"
+#ifdef MODULE_NATIVE_SIM
+#include "native_sim.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -113,6 +116,14 @@ static void do_timer_set(unsigned int offset)
         offset = NATIVE_TIMER_MIN_RES;
     }
 
+#ifdef MODULE_NATIVE_SIM
+    if (native_sim_active()) {
+        native_sim_timer_set((offset) ? native_sim_now() + offset
+                                      : NATIVE_SIM_NEVER);
+        return;
+    }
+#endif
+
     memset(&itv, 0, sizeof(itv));
     itv.it_value.tv_sec = (offset / 1000000);
     itv.it_value.tv_usec = offset % 1000000;
@@ -182,6 +193,18 @@ unsigned int timer_read(tim_t dev)
 
     DEBUG("timer_read()\n");
 
+#ifdef MODULE_NATIVE_SIM
+    if (native_sim_active()) {
+        unsigned int now;
+
+        /* defer SIGALRM of a deadline reached by the read */
+        _native_syscall_enter();
+        now = native_sim_read() - time_null;
+        _native_syscall_leave();
+        return now;
+    }
+#endif
+
     _native_syscall_enter();
 #ifdef __MACH__
     clock_serv_t cclock;
@@ -93,6 +93,9 @@ socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #include "eeprom_native.h"
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
 #endif
+#ifdef MODULE_NATIVE_SIM
+#include "native_sim.h"
+#endif
 
 static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_PERIPH_GPIO_LINUX
@@ -109,6 +112,9 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     "p:"
+#endif
+#ifdef MODULE_NATIVE_SIM
+    "S:"
 #endif
     "";
 
@@ -138,6 +144,9 @@ static const struct option long_opts[] = {
 #endif
 #ifdef MODULE_PERIPH_EEPROM
     { "eeprom", required_argument, NULL, 'M' },
+#endif
+#ifdef MODULE_NATIVE_SIM
+    { "sim", required_argument, NULL, 'S' },
 #endif
     { NULL, 0, NULL, '\0' },
 };
@@ -283,6 +292,9 @@ void usage_exit(int status)
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     real_printf(" [-p <b>:<d>:<spidev>]\n");
 #endif
+#ifdef MODULE_NATIVE_SIM
+    real_printf(" [-S <addr>:<port>]\n");
+#endif
 
     real_printf(" help: %s -h\n\n", _progname);
 
@@ -347,11 +359,17 @@ void usage_exit(int status)
 "    -M <eeprom> , --eeprom=<eeprom>\n"
 "        Specify the file path where the EEPROM content is stored\n"
 "        Example: --eeprom=/tmp/riot_native.eeprom\n");
+#endif
+#ifdef MODULE_NATIVE_SIM
+    real_printf(
+"    -S <addr>:<port>, --sim=<addr>:<port>\n"
+"        run on the virtual clock of the simulation coordinator listening on\n"
+"        <addr>:<port> (see dist/tools/native_sim)\n");
 #endif
     real_exit(status);
 }
 
-#ifdef MODULE_SOCKET_ZEP
+#if defined(MODULE_SOCKET_ZEP) || defined(MODULE_NATIVE_SIM)
 static void _parse_ep_str(char *ep_str, char **addr, char **port)
 {
     /* read endpoint string in reverse, the last chars are the port and decimal
@@ -386,7 +404,9 @@ static void _parse_ep_str(char *ep_str, char **addr, char **port)
         usage_exit(EXIT_FAILURE);
     }
 }
+#endif
 
+#ifdef MODULE_SOCKET_ZEP
 static void _zep_params_setup(char *zep_str, int zep)
 {
     char *save_ptr, *first_ep, *second_ep;
@@ -449,6 +469,9 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
     int c, opt_idx = 0, uart = 0;
 #ifdef MODULE_SOCKET_ZEP
     unsigned zeps = 0;
+#endif
+#ifdef MODULE_NATIVE_SIM
+    char *sim_str = NULL, *sim_addr = NULL, *sim_port = NULL;
 #endif
     bool dmn = false, force_stderr = false;
     _stdiotype_t stderrtype = _STDIOTYPE_STDIO;
@@ -549,6 +572,13 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 strncpy(eeprom_file, optarg, EEPROM_FILEPATH_MAX_LEN);
                 break;
             }
+#endif
+#ifdef MODULE_NATIVE_SIM
+            case 'S':
+                /* reboot uses execve() so we need to preserve argv */
+                sim_str = strdup(optarg);
+                _parse_ep_str(sim_str, &sim_addr, &sim_port);
+                break;
 #endif
             default:
                 usage_exit(EXIT_FAILURE);
@@ -591,6 +621,12 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
     _native_null_out_file = _native_log_output(stdouttype, STDOUT_FILENO);
     _native_input(stdintype);
 
+#ifdef MODULE_NATIVE_SIM
+    if (sim_str != NULL) {
+        native_sim_init(sim_addr, sim_port);
+    }
+#endif
+
     /* startup is a constructor which is being called from the init_array during
      * C runtime initialization, this is normally used for code which must run
      * before launching main(), such as C++ global object constructors etc.
@@ -0,0 +1,643 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/*
+ * Coordinator for native instances in discrete-event simulation mode.
+ *
+ * Spawns the instances, runs them on a common virtual clock and forwards
+ * the ZEP frames they send over a lossy radio medium with delay. See
+ * README.md for usage.
+ */
+
+#include <endian.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+/* keep in sync with cpu/native/include/native_sim.h */
+#define MSG_IDLE            (1U)
+#define MSG_ADVANCE         (2U)
+#define NEVER               (UINT64_MAX)
+
+#define FRAME_MAXLEN        (2048U)
+#define ADDR                "127.0.0.1"
+#define PORT_DEFAULT        (17754U)
+#define POLL_TIMEOUT_MS     (1000)
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;
+    uint8_t reserved[3];
+    uint32_t id;
+    uint32_t step;
+    uint64_t time;
+} sim_msg_t;
+
+typedef struct {
+    unsigned dst;
+    float loss;
+} link_t;
+
+typedef struct {
+    pid_t pid;
+    struct sockaddr_in ctrl;    /* control endpoint, learned on registration */
+    struct sockaddr_in zep;     /* ZEP endpoint */
+    bool registered;
+    bool busy;                  /* advanced, but not yet idle again */
+    uint64_t deadline;
+    link_t *links;              /* NULL: all other nodes are neighbors */
+    unsigned links_numof;
+} node_t;
+
+typedef struct {
+    uint64_t time;
+    uint64_t seq;               /* keeps the order of equal times stable */
+    unsigned dst;
+    size_t len;
+    uint8_t *data;
+} event_t;
+
+typedef struct {
+    unsigned src;
+    unsigned idx;               /* order of reception */
+    size_t len;
+    uint8_t *data;
+} frame_t;
+
+static node_t *_nodes;
+static unsigned _nodes_numof = 2;
+static unsigned _registered;
+static unsigned _busy;
+
+static event_t *_heap;
+static size_t _heap_len, _heap_size;
+static uint64_t _event_seq;
+
+static frame_t *_frames;
+static size_t _frames_len, _frames_size;
+
+static int _ctrl_sock, _zep_sock;
+static unsigned _port = PORT_DEFAULT;
+
+static uint64_t _rng_state = 1;
+static float _loss;
+static uint64_t _delay = 1000;
+static uint64_t _jitter;
+
+static uint64_t _now;
+static uint32_t _step;
+
+static struct {
+    uint64_t sent;
+    uint64_t delivered;
+    uint64_t dropped;
+} _stats;
+
+static void _usage(const char *progname)
+{
+    fprintf(stderr,
+            "usage: %s [-n <nodes>] [-s <seed>] [-T <seconds>] [-d <us>] "
+            "[-j <us>]\n"
+            "       [-l <percent>] [-t <topology>] [-p <port>] [-o <logdir>] "
+            "-- <elf> [<args>]\n", progname);
+}
+
+static void _cleanup(void)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if (_nodes[i].pid > 0) {
+            kill(_nodes[i].pid, SIGKILL);
+            waitpid(_nodes[i].pid, NULL, 0);
+            _nodes[i].pid = 0;
+        }
+    }
+}
+
+static void _die(const char *msg)
+{
+    if (errno) {
+        perror(msg);
+    }
+    else {
+        fprintf(stderr, "%s\n", msg);
+    }
+    _cleanup();
+    exit(EXIT_FAILURE);
+}
+
+static void *_alloc(size_t size)
+{
+    void *res = malloc(size);
+
+    if (res == NULL) {
+        _die("malloc");
+    }
+    return res;
+}
+
+/* xorshift64*, so a run only depends on the seed */
+static uint64_t _rand(void)
+{
+    _rng_state ^= _rng_state >> 12;
+    _rng_state ^= _rng_state << 25;
+    _rng_state ^= _rng_state >> 27;
+    return _rng_state * 0x2545F4914F6CDD1DULL;
+}
+
+static float _rand_percent(void)
+{
+    return (float)(_rand() >> 11) * (100.0f / (float)(1ULL << 53));
+}
+
+static bool _event_before(const event_t *a, const event_t *b)
+{
+    return (a->time < b->time) || ((a->time == b->time) && (a->seq < b->seq));
+}
+
+static void _heap_push(const event_t *ev)
+{
+    size_t i;
+
+    if (_heap_len == _heap_size) {
+        _heap_size = (_heap_size) ? (_heap_size * 2) : 64;
+        if ((_heap = realloc(_heap, _heap_size * sizeof(*_heap))) == NULL) {
+            _die("realloc");
+        }
+    }
+    i = _heap_len++;
+    while ((i > 0) && _event_before(ev, &_heap[(i - 1) / 2])) {
+        _heap[i] = _heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    _heap[i] = *ev;
+}
+
+static void _heap_pop(event_t *ev)
+{
+    event_t last = _heap[--_heap_len];
+    size_t i = 0;
+
+    *ev = _heap[0];
+    while ((2 * i + 1) < _heap_len) {
+        size_t child = 2 * i + 1;
+
+        if (((child + 1) < _heap_len) &&
+            _event_before(&_heap[child + 1], &_heap[child])) {
+            child++;
+        }
+        if (!_event_before(&_heap[child], &last)) {
+            break;
+        }
+        _heap[i] = _heap[child];
+        i = child;
+    }
+    _heap[i] = last;
+}
+
+static void _link_add(unsigned a, unsigned b, float loss)
+{
+    node_t *node = &_nodes[a];
+
+    node->links = realloc(node->links, (node->links_numof + 1) * sizeof(link_t));
+    if (node->links == NULL) {
+        _die("realloc");
+    }
+    node->links[node->links_numof].dst = b;
+    node->links[node->links_numof].loss = loss;
+    node->links_numof++;
+}
+
+static void _topology_read(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128];
+    unsigned lineno = 0;
+
+    if (f == NULL) {
+        _die(path);
+    }
+    /* with a topology, only the listed nodes are neighbors */
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        _nodes[i].links = _alloc(sizeof(link_t));
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        unsigned a, b;
+        float loss = _loss;
+        int res;
+
+        lineno++;
+        if ((line[0] == '#') || (line[strspn(line, " \t\r\n")] == '\0')) {
+            continue;
+        }
+        res = sscanf(line, "%u %u %f", &a, &b, &loss);
+        if ((res < 2) || (a >= _nodes_numof) || (b >= _nodes_numof) ||
+            (a == b)) {
+            fprintf(stderr, "%s:%u: invalid link\n", path, lineno);
+            errno = 0;
+            _die("invalid topology");
+        }
+        _link_add(a, b, loss);
+        _link_add(b, a, loss);
+    }
+    fclose(f);
+}
+
+static int _socket_bind(unsigned port)
+{
+    struct sockaddr_in addr = { .sin_family = AF_INET,
+                                .sin_port = htons(port) };
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (sock < 0) {
+        _die("socket");
+    }
+    inet_pton(AF_INET, ADDR, &addr.sin_addr);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        _die("bind");
+    }
+    return sock;
+}
+
+static void _spawn(unsigned id, char **args, unsigned args_numof,
+                   unsigned seed, const char *logdir, int stdin_fd)
+{
+    char id_str[16], seed_str[16], zep_str[64], sim_str[32];
+    char **argv = _alloc((args_numof + 9) * sizeof(char *));
+    unsigned argc = 0;
+    pid_t pid;
+
+    snprintf(id_str, sizeof(id_str), "%u", id);
+    snprintf(seed_str, sizeof(seed_str), "%u", seed + id);
+    snprintf(zep_str, sizeof(zep_str), ADDR ":%u," ADDR ":%u",
+             _port + 2 + id, _port);
+    snprintf(sim_str, sizeof(sim_str), ADDR ":%u", _port + 1);
+    for (unsigned i = 0; i < args_numof; i++) {
+        argv[argc++] = args[i];
+    }
+    argv[argc++] = "-i";
+    argv[argc++] = id_str;
+    argv[argc++] = "-s";
+    argv[argc++] = seed_str;
+    argv[argc++] = "-z";
+    argv[argc++] = zep_str;
+    argv[argc++] = "-S";
+    argv[argc++] = sim_str;
+    argv[argc] = NULL;
+
+    if ((pid = fork()) < 0) {
+        _die("fork");
+    }
+    if (pid > 0) {
+        _nodes[id].pid = pid;
+        free(argv);
+        return;
+    }
+    dup2(stdin_fd, STDIN_FILENO);
+    if (logdir != NULL) {
+        char path[256];
+        int fd;
+
+        snprintf(path, sizeof(path), "%s/node%u.log", logdir, id);
+        if ((fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+            perror(path);
+            _exit(EXIT_FAILURE);
+        }
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        close(fd);
+    }
+    execv(argv[0], argv);
+    perror(argv[0]);
+    _exit(EXIT_FAILURE);
+}
+
+static void _check_children(void)
+{
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        if ((_nodes[i].pid > 0) &&
+            (waitpid(_nodes[i].pid, NULL, WNOHANG) == _nodes[i].pid)) {
+            _nodes[i].pid = 0;
+            fprintf(stderr, "node %u exited\n", i);
+            errno = 0;
+            _die("aborting simulation");
+        }
+    }
+}
+
+static void _ctrl_recv(void)
+{
+    struct pollfd pfd = { .fd = _ctrl_sock, .events = POLLIN };
+    struct sockaddr_in from;
+    socklen_t from_len = sizeof(from);
+    sim_msg_t msg;
+    node_t *node;
+    uint32_t id;
+    ssize_t res;
+
+    res = poll(&pfd, 1, POLL_TIMEOUT_MS);
+    if (res < 0) {
+        if (errno == EINTR) {
+            return;
+        }
+        _die("poll");
+    }
+    if (res == 0) {
+        _check_children();
+        return;
+    }
+    res = recvfrom(_ctrl_sock, &msg, sizeof(msg), 0,
+                   (struct sockaddr *)&from, &from_len);
+    if ((res != sizeof(msg)) || (msg.type != MSG_IDLE)) {
+        return;
+    }
+    if ((id = ntohl(msg.id)) >= _nodes_numof) {
+        fprintf(stderr, "ignoring unknown node %" PRIu32 "\n", id);
+        return;
+    }
+    node = &_nodes[id];
+    if (!node->registered) {
+        node->registered = true;
+        node->ctrl = from;
+        _registered++;
+    }
+    node->deadline = be64toh(msg.time);
+    if (node->busy && (ntohl(msg.step) == _step)) {
+        node->busy = false;
+        _busy--;
+    }
+}
+
+static void _advance(node_t *node, unsigned id)
+{
+    sim_msg_t msg = { .type = MSG_ADVANCE, .id = htonl(id),
+                      .step = htonl(_step), .time = htobe64(_now) };
+
+    if (sendto(_ctrl_sock, &msg, sizeof(msg), 0,
+               (struct sockaddr *)&node->ctrl, sizeof(node->ctrl)) < 0) {
+        _die("sendto");
+    }
+}
+
+static void _wake(unsigned id)
+{
+    if (!_nodes[id].busy) {
+        _nodes[id].busy = true;
+        _busy++;
+    }
+}
+
+static int _frame_cmp(const void *a, const void *b)
+{
+    const frame_t *fa = a, *fb = b;
+
+    if (fa->src != fb->src) {
+        return (fa->src < fb->src) ? -1 : 1;
+    }
+    return (fa->idx < fb->idx) ? -1 : (fa->idx > fb->idx);
+}
+
+static void _schedule(unsigned dst, float loss, const frame_t *frame)
+{
+    event_t ev;
+
+    if (_rand_percent() < loss) {
+        _stats.dropped++;
+        return;
+    }
+    ev.time = _now + _delay + ((_jitter) ? (_rand() % (_jitter + 1)) : 0);
+    ev.seq = _event_seq++;
+    ev.dst = dst;
+    ev.len = frame->len;
+    ev.data = _alloc(frame->len);
+    memcpy(ev.data, frame->data, frame->len);
+    _heap_push(&ev);
+}
+
+/* takes the frames sent in the last step onto the medium */
+static void _frames_collect(void)
+{
+    uint8_t buf[FRAME_MAXLEN];
+
+    _frames_len = 0;
+    while (1) {
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        ssize_t len = recvfrom(_zep_sock, buf, sizeof(buf), MSG_DONTWAIT,
+                               (struct sockaddr *)&from, &from_len);
+        unsigned src;
+
+        if (len < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            _die("recvfrom");
+        }
+        src = ntohs(from.sin_port) - (_port + 2);
+        if (src >= _nodes_numof) {
+            continue;
+        }
+        if (_frames_len == _frames_size) {
+            _frames_size = (_frames_size) ? (_frames_size * 2) : 64;
+            if ((_frames = realloc(_frames, _frames_size * sizeof(*_frames))) == NULL) {
+                _die("realloc");
+            }
+        }
+        _frames[_frames_len].src = src;
+        _frames[_frames_len].idx = _frames_len;
+        _frames[_frames_len].len = len;
+        _frames[_frames_len].data = _alloc(len);
+        memcpy(_frames[_frames_len].data, buf, len);
+        _frames_len++;
+    }
+    /* the instances of a step run in parallel, so sort their frames for a
+     * reproducible order */
+    qsort(_frames, _frames_len, sizeof(*_frames), _frame_cmp);
+    for (size_t i = 0; i < _frames_len; i++) {
+        const frame_t *frame = &_frames[i];
+        const node_t *node = &_nodes[frame->src];
+
+        _stats.sent++;
+        if (node->links == NULL) {
+            for (unsigned dst = 0; dst < _nodes_numof; dst++) {
+                if (dst != frame->src) {
+                    _schedule(dst, _loss, frame);
+                }
+            }
+        }
+        else {
+            for (unsigned l = 0; l < node->links_numof; l++) {
+                _schedule(node->links[l].dst, node->links[l].loss, frame);
+            }
+        }
+        free(frame->data);
+    }
+}
+
+static void _deliver(const event_t *ev)
+{
+    if (sendto(_zep_sock, ev->data, ev->len, 0,
+               (struct sockaddr *)&_nodes[ev->dst].zep,
+               sizeof(_nodes[ev->dst].zep)) < 0) {
+        _die("sendto");
+    }
+    _stats.delivered++;
+    _wake(ev->dst);
+}
+
+int main(int argc, char **argv)
+{
+    const char *topology = NULL, *logdir = NULL;
+    uint64_t end = 60ULL * 1000000ULL;
+    unsigned seed = 1;
+    struct timespec start, stop;
+    int stdin_pipe[2];
+    int c;
+
+    while ((c = getopt(argc, argv, "n:s:T:d:j:l:t:p:o:h")) >= 0) {
+        switch (c) {
+            case 'n':
+                _nodes_numof = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'T':
+                end = (uint64_t)(strtod(optarg, NULL) * 1000000.0);
+                break;
+            case 'd':
+                _delay = strtoull(optarg, NULL, 0);
+                break;
+            case 'j':
+                _jitter = strtoull(optarg, NULL, 0);
+                break;
+            case 'l':
+                _loss = strtof(optarg, NULL);
+                break;
+            case 't':
+                topology = optarg;
+                break;
+            case 'p':
+                _port = strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                logdir = optarg;
+                break;
+            default:
+                _usage(argv[0]);
+                return (c == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if ((optind >= argc) || (_nodes_numof == 0) ||
+        ((_port + 2 + _nodes_numof) > UINT16_MAX)) {
+        _usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    _rng_state = (seed) ? seed : 1;
+    _nodes = calloc(_nodes_numof, sizeof(*_nodes));
+    if (_nodes == NULL) {
+        _die("calloc");
+    }
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        _nodes[i].deadline = NEVER;
+        _nodes[i].zep.sin_family = AF_INET;
+        _nodes[i].zep.sin_port = htons(_port + 2 + i);
+        inet_pton(AF_INET, ADDR, &_nodes[i].zep.sin_addr);
+    }
+    if (topology != NULL) {
+        _topology_read(topology);
+    }
+    _zep_sock = _socket_bind(_port);
+    _ctrl_sock = _socket_bind(_port + 1);
+    /* the instances get a stdin that never delivers anything */
+    if (pipe(stdin_pipe) < 0) {
+        _die("pipe");
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned i = 0; i < _nodes_numof; i++) {
+        _spawn(i, &argv[optind], argc - optind, seed, logdir, stdin_pipe[0]);
+    }
+    while (_registered < _nodes_numof) {
+        _ctrl_recv();
+    }
+    fprintf(stderr, "%u nodes registered\n", _nodes_numof);
+
+    while (1) {
+        uint64_t next = NEVER;
+
+        _frames_collect();
+        if (_heap_len > 0) {
+            next = _heap[0].time;
+        }
+        for (unsigned i = 0; i < _nodes_numof; i++) {
+            if (_nodes[i].deadline < next) {
+                next = _nodes[i].deadline;
+            }
+        }
+        if (next == NEVER) {
+            fprintf(stderr, "no events left\n");
+            break;
+        }
+        if (next > end) {
+            _now = end;
+            break;
+        }
+        if (next > _now) {
+            _now = next;
+        }
+        _step++;
+        while ((_heap_len > 0) && (_heap[0].time <= _now)) {
+            event_t ev;
+
+            _heap_pop(&ev);
+            _deliver(&ev);
+            free(ev.data);
+        }
+        for (unsigned i = 0; i < _nodes_numof; i++) {
+            if (_nodes[i].deadline <= _now) {
+                _nodes[i].deadline = NEVER;
+                _wake(i);
+            }
+        }
+        for (unsigned i = 0; i < _nodes_numof; i++) {
+            if (_nodes[i].busy) {
+                _advance(&_nodes[i], i);
+            }
+        }
+        while (_busy > 0) {
+            _ctrl_recv();
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    double real = (stop.tv_sec - start.tv_sec) +
+                  (stop.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "virtual time: %.6f s, real time: %.3f s, steps: %" PRIu32 "\n"
+            "frames sent: %" PRIu64 ", delivered: %" PRIu64
+            ", dropped: %" PRIu64 "\n",
+            _now / 1e6, real, _step, _stats.sent, _stats.delivered,
+            _stats.dropped);
+    _cleanup();
+    return EXIT_SUCCESS;
+}
@@ -27,6 +27,9 @@
 #if MODULE_VFS
 #include "vfs.h"
 #endif
+#if MODULE_MTD_ASYNC
+#include "event.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -60,6 +63,10 @@ typedef struct {
     uint32_t sector_count;     /**< Number of sector in the MTD */
     uint32_t pages_per_sector; /**< Number of pages by sector in the MTD */
     uint32_t page_size;        /**< Size of the pages in the MTD */
+#if defined(MODULE_MTD_ASYNC) || defined(DOXYGEN)
+    event_t async_event;       /**< Posted to the worker when requests are queued */
+    clist_node_t async_queue;  /**< Queued asynchronous requests */
+#endif
 } mtd_dev_t;
 
 /**
@@ -203,6 +210,19 @@ struct mtd_desc {
      * @return < 0 value on error
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
+
+    /**
+     * @brief   Write data buffered by the driver to the memory
+     *
+     * Optional, drivers that finish all writes within @ref write and
+     * @ref write_page do not need to implement this.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @return 0 on success
+     * @return < 0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
 };
 
 /**
@@ -352,6 +372,20 @@ int mtd_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t num);
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write data buffered by a MTD device to the memory
+ *
+ * File systems call this to make sure that written data is persistent.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @return 0 if all data was written or @p mtd does not buffer writes
+ * @return < 0 if an error occurred
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EIO if I/O error occurred
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 #if defined(MODULE_VFS) || defined(DOXYGEN)
 /**
  * @brief   MTD driver for VFS
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD requests
+ * @ingroup     drivers_mtd
+ * @brief       Non-blocking read, write and erase requests for MTD devices
+ *
+ * The functions of the MTD interface block until the device finished the
+ * operation, which can take tens of milliseconds for erasing a sector of a
+ * SPI NOR flash. With this module, requests are queued per device and
+ * executed by a worker thread with the blocking MTD functions, so the caller
+ * can continue e.g. sampling sensors. When a request finished, its callback is
+ * called in the context of the worker thread.
+ *
+ * Before a request is executed, subsequent requests of the same type for the
+ * adjacent address range are merged into it, e.g. writes of consecutive pages
+ * from a contiguous buffer become a single multi-page write and erases of
+ * consecutive sectors a single erase that can use large erase blocks.
+ * Requests are only moved ahead of other queued requests if they do not
+ * access the same memory, so the device is always left in the same state as
+ * if all requests were executed in the order they were queued.
+ *
+ * This works for any MTD driver, e.g. `mtd_spi_nor`, `mtd_sdcard` or
+ * `mtd_native`.
+ *
+ * @warning The device must not be accessed with the blocking MTD functions
+ *          while asynchronous requests are pending.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static void _written(mtd_request_t *req)
+ * {
+ *     if (req->result < 0) {
+ *         ...
+ *     }
+ *     event_post(EVENT_PRIO_MEDIUM, req->arg);
+ * }
+ *
+ * static mtd_request_t req = { .cb = _written, .arg = &write_done_event };
+ *
+ * mtd_write_async(MTD_0, &req, buf, addr, sizeof(buf));
+ * ```
+ *
+ * The request and the buffer must not be touched until the callback was
+ * called.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request interface
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+#include <stdint.h>
+
+#include "clist.h"
+#include "mtd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Priority of the worker thread
+ *
+ * Lower than the main thread by default, so requests are executed whenever
+ * the application waits.
+ */
+#ifndef MTD_ASYNC_PRIO
+#define MTD_ASYNC_PRIO          (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+/**
+ * @brief   Stack size of the worker thread
+ */
+#ifndef MTD_ASYNC_STACKSIZE
+#define MTD_ASYNC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Types of asynchronous requests
+ */
+typedef enum {
+    MTD_REQUEST_READ,           /**< read from the device */
+    MTD_REQUEST_WRITE,          /**< write to the device */
+    MTD_REQUEST_ERASE,          /**< erase sectors of the device */
+} mtd_request_type_t;
+
+/**
+ * @brief   Forward declaration of the request type
+ */
+typedef struct mtd_request mtd_request_t;
+
+/**
+ * @brief   Completion callback of a request
+ *
+ * Called in the context of the worker thread.
+ *
+ * @param[in] req   The finished request, @ref mtd_request::result holds the
+ *                  result
+ */
+typedef void (*mtd_request_cb_t)(mtd_request_t *req);
+
+/**
+ * @brief   Asynchronous MTD request
+ *
+ * Only @ref cb and @ref arg need to be set by the application, all other
+ * fields are set when the request is queued.
+ */
+struct mtd_request {
+    clist_node_t node;          /**< queue entry */
+    mtd_request_cb_t cb;        /**< completion callback */
+    void *arg;                  /**< argument for the callback */
+    union {
+        void *dest;             /**< destination of a read */
+        const void *src;        /**< source of a write */
+    } buf;                      /**< data buffer, unused for erase */
+    uint32_t addr;              /**< starting address */
+    uint32_t count;             /**< number of bytes */
+    int result;                 /**< result of the blocking MTD function */
+    mtd_request_type_t type;    /**< type of the request */
+};
+
+/**
+ * @brief   Queues a read from a MTD device
+ *
+ * Completes like mtd_read().
+ *
+ * @param      mtd   the device to read from
+ * @param[in]  req   the request, its callback must be set
+ * @param[out] dest  the buffer to fill in
+ * @param[in]  addr  the start address to read from
+ * @param[in]  count the number of bytes to read
+ *
+ * @return 0 if the request was queued
+ * @return -ENODEV if @p mtd is not a valid device
+ */
+int mtd_read_async(mtd_dev_t *mtd, mtd_request_t *req, void *dest,
+                   uint32_t addr, uint32_t count);
+
+/**
+ * @brief   Queues a write to a MTD device
+ *
+ * Completes like mtd_write(), but @p count is not limited to a single page.
+ *
+ * @param      mtd   the device to write to
+ * @param[in]  req   the request, its callback must be set
+ * @param[in]  src   the buffer to write
+ * @param[in]  addr  the start address to write to
+ * @param[in]  count the number of bytes to write
+ *
+ * @return 0 if the request was queued
+ * @return -ENODEV if @p mtd is not a valid device
+ */
+int mtd_write_async(mtd_dev_t *mtd, mtd_request_t *req, const void *src,
+                    uint32_t addr, uint32_t count);
+
+/**
+ * @brief   Queues erasing sectors of a MTD device
+ *
+ * Completes like mtd_erase().
+ *
+ * @param      mtd   the device to erase
+ * @param[in]  req   the request, its callback must be set
+ * @param[in]  addr  the address of the first sector to erase
+ * @param[in]  count the number of bytes to erase
+ *
+ * @return 0 if the request was queued
+ * @return -ENODEV if @p mtd is not a valid device
+ * @return -EOVERFLOW if @p addr or @p count are not sector aligned
+ */
+int mtd_erase_async(mtd_dev_t *mtd, mtd_request_t *req, uint32_t addr,
+                    uint32_t count);
+
+/**
+ * @brief   Starts the worker thread
+ *
+ * Called by auto_init.
+ */
+void mtd_async_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_ASYNC_H */
+/** @} */
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD page cache
+ * @ingroup     drivers_storage
+ * @brief       Caches pages of a flash device in RAM
+ *
+ * This MTD module stacks on top of another MTD device and keeps a fixed number
+ * of its pages in RAM. Pages that are read repeatedly, e.g. file system
+ * metadata, are then served from RAM instead of being read again from a slow
+ * SPI flash or SD card. When all lines are in use, the least recently used
+ * page is evicted.
+ *
+ * Two write policies are supported:
+ *
+ * - @ref MTD_CACHE_WRITE_THROUGH: writes are passed to the parent device
+ *   immediately and update the cached copy of the page
+ * - @ref MTD_CACHE_WRITE_BACK: writes only update the cached copy of the page.
+ *   The written range of each page is tracked and written to the parent device
+ *   when the page is evicted, when the device is powered down or when
+ *   mtd_flush() is called. Subsequent writes to adjacent or overlapping ranges
+ *   of a page are merged into a single write to the parent device.
+ *
+ * The cache assumes that data written to the device is read back unchanged,
+ * i.e. that only erased memory is written. This is what file systems do.
+ *
+ * @warning With the write-back policy, data is lost if the device is not
+ *          flushed before a reset. File systems flush their device on
+ *          `vfs_fsync()` and on closing a file.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * The lines of the cache and their buffer are provided by the application.
+ * The buffer must hold `lines_numof` pages of the parent device:
+ *
+ * ```
+ * static mtd_cache_line_t lines[4];
+ * static uint8_t buf[4 * PAGE_SIZE];
+ *
+ * mtd_cache_t cache = {
+ *     .mtd = {
+ *         .driver = &mtd_cache_driver,
+ *     },
+ *     .parent = MTD_0,
+ *     .lines = lines,
+ *     .buf = buf,
+ *     .lines_numof = ARRAY_SIZE(lines),
+ *     .policy = MTD_CACHE_WRITE_BACK,
+ *     .lock = MUTEX_INIT,
+ * };
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ * The geometry of the cache device is copied from the parent device by
+ * mtd_init().
+ *
+ * @warning The parent device must not be accessed directly while the cache
+ *          is in use.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD page cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Write policy of the cache
+ */
+typedef enum {
+    MTD_CACHE_WRITE_BACK,       /**< write to the parent on eviction or flush */
+    MTD_CACHE_WRITE_THROUGH,    /**< write to the parent immediately */
+} mtd_cache_policy_t;
+
+/**
+ * @brief   A cache line holding a single page
+ */
+typedef struct {
+    uint32_t page;          /**< page of the parent device */
+    uint32_t used;          /**< value of the cache clock at the last access */
+    uint32_t dirty_start;   /**< start of the range not yet written back */
+    uint32_t dirty_end;     /**< end of the range not yet written back */
+    bool valid;             /**< the line holds @ref page */
+} mtd_cache_line_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< page accesses served from RAM */
+    uint32_t misses;        /**< page accesses that had to load the page */
+    uint32_t writebacks;    /**< writes of dirty ranges to the parent */
+    uint32_t evictions;     /**< valid lines reused for another page */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD page cache descriptor
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< cached MTD device */
+    mtd_cache_line_t *lines;    /**< cache lines */
+    uint8_t *buf;               /**< buffer of `lines_numof` pages */
+    uint8_t lines_numof;        /**< number of cache lines */
+    mtd_cache_policy_t policy;  /**< write policy */
+    mutex_t lock;               /**< cache access lock */
+    uint32_t clock;             /**< number of page accesses, used for LRU */
+    mtd_cache_stats_t stats;    /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   MTD page cache driver
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Writes all dirty ranges to the parent device
+ *
+ * The cached pages stay valid. This is the same as calling mtd_flush() on the
+ * cache device.
+ *
+ * @param[in] cache     The cache
+ *
+ * @return  0 on success
+ * @return  < 0 if writing to the parent device failed
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+/**
+ * @brief   Gets a copy of the cache statistics
+ *
+ * @param[in]  cache    The cache
+ * @param[out] stats    The statistics
+ */
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+/**
+ * @brief   Clears the cache statistics
+ *
+ * @param[in] cache     The cache
+ */
+void mtd_cache_reset_stats(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
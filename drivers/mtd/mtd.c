@@ -238,4 +238,18 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_flush(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->flush) {
+        return mtd->driver->flush(mtd);
+    }
+
+    /* writes are finished within the write functions */
+    return 0;
+}
+
 /** @} */
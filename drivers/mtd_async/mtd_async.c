@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "irq.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static event_queue_t _queue;
+static char _stack[MTD_ASYNC_STACKSIZE];
+
+/**
+ * @brief   Range of a batch of merged requests
+ */
+typedef struct {
+    mtd_request_t *first;       /**< request with the lowest address */
+    uint32_t end;               /**< end of the merged range */
+} _batch_t;
+
+static const uint8_t *_buf(const mtd_request_t *req)
+{
+    return req->buf.src;
+}
+
+static bool _overlap(const mtd_request_t *a, const mtd_request_t *b)
+{
+    return (a->addr < b->addr + b->count) && (b->addr < a->addr + a->count);
+}
+
+static int _conflicts(clist_node_t *node, void *arg)
+{
+    mtd_request_t *skipped = container_of(node, mtd_request_t, node);
+    mtd_request_t *req = arg;
+
+    /* reads can pass each other */
+    if ((skipped->type == MTD_REQUEST_READ) &&
+        (req->type == MTD_REQUEST_READ)) {
+        return 0;
+    }
+    return _overlap(skipped, req);
+}
+
+static bool _merge(_batch_t *batch, mtd_request_t *req)
+{
+    mtd_request_t *first = batch->first;
+    bool with_buf = req->type != MTD_REQUEST_ERASE;
+
+    if (req->type != first->type) {
+        return false;
+    }
+    if ((req->addr == batch->end) &&
+        (!with_buf ||
+         (_buf(req) == _buf(first) + (batch->end - first->addr)))) {
+        batch->end += req->count;
+        return true;
+    }
+    if ((req->addr + req->count == first->addr) &&
+        (!with_buf || (_buf(req) + req->count == _buf(first)))) {
+        batch->first = req;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief   Takes the first queued request and all requests that can be
+ *          merged with it from the queue of @p mtd
+ */
+static void _take_batch(mtd_dev_t *mtd, clist_node_t *requests,
+                        _batch_t *batch)
+{
+    clist_node_t pending = mtd->async_queue;
+    clist_node_t skipped = { .next = NULL };
+    clist_node_t *node = clist_lpop(&pending);
+    mtd_request_t *req = container_of(node, mtd_request_t, node);
+
+    clist_rpush(requests, node);
+    batch->first = req;
+    batch->end = req->addr + req->count;
+
+    while ((node = clist_lpop(&pending))) {
+        req = container_of(node, mtd_request_t, node);
+        /* the request must not pass one that accesses the same memory */
+        if (!clist_foreach(&skipped, _conflicts, req) && _merge(batch, req)) {
+            clist_rpush(requests, node);
+        }
+        else {
+            clist_rpush(&skipped, node);
+        }
+    }
+    mtd->async_queue = skipped;
+}
+
+static int _write(mtd_dev_t *mtd, const uint8_t *src, uint32_t addr,
+                  uint32_t count)
+{
+    if (mtd->driver->write_page) {
+        /* page size is always a power of two */
+        return mtd_write_page(mtd, src, addr / mtd->page_size,
+                              addr & (mtd->page_size - 1), count);
+    }
+
+    /* the write function of the driver cannot cross pages */
+    while (count) {
+        uint32_t chunk = mtd->page_size - (addr & (mtd->page_size - 1));
+
+        if (chunk > count) {
+            chunk = count;
+        }
+
+        int res = mtd_write(mtd, src, addr, chunk);
+        if (res < 0) {
+            return res;
+        }
+        src += chunk;
+        addr += chunk;
+        count -= chunk;
+    }
+    return 0;
+}
+
+static int _execute(mtd_dev_t *mtd, const _batch_t *batch)
+{
+    mtd_request_t *first = batch->first;
+    uint32_t count = batch->end - first->addr;
+
+    DEBUG("mtd_async: type %u addr %" PRIu32 " count %" PRIu32 "\n",
+          (unsigned)first->type, first->addr, count);
+
+    switch (first->type) {
+    case MTD_REQUEST_READ:
+        return mtd_read(mtd, first->buf.dest, first->addr, count);
+    case MTD_REQUEST_WRITE:
+        return _write(mtd, first->buf.src, first->addr, count);
+    case MTD_REQUEST_ERASE:
+        return mtd_erase(mtd, first->addr, count);
+    }
+    return -EINVAL;
+}
+
+static void _handler(event_t *event)
+{
+    mtd_dev_t *mtd = container_of(event, mtd_dev_t, async_event);
+    clist_node_t requests = { .next = NULL };
+    clist_node_t *node;
+    _batch_t batch;
+
+    unsigned state = irq_disable();
+    if (mtd->async_queue.next == NULL) {
+        irq_restore(state);
+        return;
+    }
+    _take_batch(mtd, &requests, &batch);
+    bool more = mtd->async_queue.next != NULL;
+    irq_restore(state);
+
+    /* serve other devices before the next batch of this device */
+    if (more) {
+        event_post(&_queue, event);
+    }
+
+    int res = _execute(mtd, &batch);
+
+    while ((node = clist_lpop(&requests))) {
+        mtd_request_t *req = container_of(node, mtd_request_t, node);
+
+        req->result = res;
+        req->cb(req);
+    }
+}
+
+static int _submit(mtd_dev_t *mtd, mtd_request_t *req,
+                   mtd_request_type_t type, uint32_t addr, uint32_t count)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    assert(req->cb);
+
+    req->type = type;
+    req->addr = addr;
+    req->count = count;
+
+    unsigned state = irq_disable();
+    mtd->async_event.handler = _handler;
+    clist_rpush(&mtd->async_queue, &req->node);
+    irq_restore(state);
+
+    event_post(&_queue, &mtd->async_event);
+    return 0;
+}
+
+int mtd_read_async(mtd_dev_t *mtd, mtd_request_t *req, void *dest,
+                   uint32_t addr, uint32_t count)
+{
+    req->buf.dest = dest;
+    return _submit(mtd, req, MTD_REQUEST_READ, addr, count);
+}
+
+int mtd_write_async(mtd_dev_t *mtd, mtd_request_t *req, const void *src,
+                    uint32_t addr, uint32_t count)
+{
+    req->buf.src = src;
+    return _submit(mtd, req, MTD_REQUEST_WRITE, addr, count);
+}
+
+int mtd_erase_async(mtd_dev_t *mtd, mtd_request_t *req, uint32_t addr,
+                    uint32_t count)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+
+    if ((addr % sector_size) || (count % sector_size)) {
+        return -EOVERFLOW;
+    }
+
+    req->buf.dest = NULL;
+    return _submit(mtd, req, MTD_REQUEST_ERASE, addr, count);
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+
+    /* should be never reached */
+    return NULL;
+}
+
+void mtd_async_init(void)
+{
+    /* requests may be queued before the worker runs */
+    event_queue_init_detached(&_queue);
+    thread_create(_stack, sizeof(_stack), MTD_ASYNC_PRIO, THREAD_CREATE_STACKTEST,
+                  _worker, NULL, "mtd_async");
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD page cache implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef MIN
+#define MIN(a, b) ((a) > (b) ? (b) : (a))
+#endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+static uint8_t *_line_buf(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * cache->mtd.page_size;
+}
+
+static bool _is_dirty(const mtd_cache_line_t *line)
+{
+    return line->dirty_end > line->dirty_start;
+}
+
+static int _writeback(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!_is_dirty(line)) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back page %" PRIu32 " [%" PRIu32 ", %" PRIu32 ")\n",
+          line->page, line->dirty_start, line->dirty_end);
+
+    int res = mtd_write_page(cache->parent,
+                             _line_buf(cache, line) + line->dirty_start,
+                             line->page, line->dirty_start,
+                             line->dirty_end - line->dirty_start);
+    if (res < 0) {
+        return res;
+    }
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    cache->stats.writebacks++;
+    return 0;
+}
+
+static mtd_cache_line_t *_lookup(mtd_cache_t *cache, uint32_t page)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && (line->page == page)) {
+            return line;
+        }
+    }
+    return NULL;
+}
+
+static mtd_cache_line_t *_victim(mtd_cache_t *cache)
+{
+    mtd_cache_line_t *victim = &cache->lines[0];
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (!line->valid) {
+            return line;
+        }
+        /* compare the age to handle the clock wrapping around */
+        if ((cache->clock - line->used) > (cache->clock - victim->used)) {
+            victim = line;
+        }
+    }
+    return victim;
+}
+
+/**
+ * @brief   Gets the line holding @p page, loads the page on a miss
+ *
+ * If @p fill is false, the page is not read from the parent on a miss as the
+ * caller overwrites the whole line.
+ */
+static int _get(mtd_cache_t *cache, uint32_t page, bool fill,
+                mtd_cache_line_t **out)
+{
+    mtd_cache_line_t *line = _lookup(cache, page);
+
+    if (line) {
+        cache->stats.hits++;
+    }
+    else {
+        cache->stats.misses++;
+        line = _victim(cache);
+
+        int res = _writeback(cache, line);
+        if (res < 0) {
+            return res;
+        }
+        if (line->valid) {
+            cache->stats.evictions++;
+            line->valid = false;
+        }
+        if (fill) {
+            res = mtd_read_page(cache->parent, _line_buf(cache, line), page, 0,
+                                cache->mtd.page_size);
+            if (res < 0) {
+                return res;
+            }
+        }
+        line->page = page;
+        line->valid = true;
+    }
+    line->used = ++cache->clock;
+    *out = line;
+    return 0;
+}
+
+static uint32_t _page_count(mtd_cache_t *cache)
+{
+    return cache->mtd.sector_count * cache->mtd.pages_per_sector;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    assert(cache->lines_numof > 0);
+
+    mutex_lock(&cache->lock);
+    int res = mtd_init(cache->parent);
+    if (res == 0) {
+        mtd->sector_count = cache->parent->sector_count;
+        mtd->pages_per_sector = cache->parent->pages_per_sector;
+        mtd->page_size = cache->parent->page_size;
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_cache_line_t *line;
+
+    assert(offset < mtd->page_size);
+
+    if (page >= _page_count(cache)) {
+        return -EOVERFLOW;
+    }
+    size = MIN(size, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+    int res = _get(cache, page, true, &line);
+    if (res == 0) {
+        memcpy(dest, _line_buf(cache, line) + offset, size);
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int _write_through(mtd_cache_t *cache, const void *src, uint32_t page,
+                          uint32_t offset, uint32_t size)
+{
+    int res = mtd_write_page(cache->parent, src, page, offset, size);
+    mtd_cache_line_t *line = _lookup(cache, page);
+
+    if ((res == 0) && line) {
+        memcpy(_line_buf(cache, line) + offset, src, size);
+        line->used = ++cache->clock;
+    }
+    return res;
+}
+
+static int _write_back(mtd_cache_t *cache, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_line_t *line;
+    uint32_t end = offset + size;
+    int res = _get(cache, page, size < cache->mtd.page_size, &line);
+
+    if (res < 0) {
+        return res;
+    }
+    if (_is_dirty(line)) {
+        if ((offset > line->dirty_end) || (end < line->dirty_start)) {
+            /* the gap in between must not be written, so the ranges
+             * cannot be merged */
+            res = _writeback(cache, line);
+            if (res < 0) {
+                return res;
+            }
+        }
+    }
+    memcpy(_line_buf(cache, line) + offset, src, size);
+    if (_is_dirty(line)) {
+        line->dirty_start = MIN(offset, line->dirty_start);
+        line->dirty_end = MAX(end, line->dirty_end);
+    }
+    else {
+        line->dirty_start = offset;
+        line->dirty_end = end;
+    }
+    return 0;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res;
+
+    assert(offset < mtd->page_size);
+
+    if (page >= _page_count(cache)) {
+        return -EOVERFLOW;
+    }
+    size = MIN(size, mtd->page_size - offset);
+
+    mutex_lock(&cache->lock);
+    if (cache->policy == MTD_CACHE_WRITE_THROUGH) {
+        res = _write_through(cache, src, page, offset, size);
+    }
+    else {
+        res = _write_back(cache, src, page, offset, size);
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t first = sector * mtd->pages_per_sector;
+    uint32_t last = (sector + count) * mtd->pages_per_sector;
+
+    if (sector + count > mtd->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    mutex_lock(&cache->lock);
+    /* pending writes to the erased pages are discarded */
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (line->valid && (line->page >= first) && (line->page < last)) {
+            line->valid = false;
+            line->dirty_start = 0;
+            line->dirty_end = 0;
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush_locked(mtd_cache_t *cache)
+{
+    /* write back in ascending page order, parents may prefer that */
+    while (1) {
+        mtd_cache_line_t *next = NULL;
+
+        for (unsigned i = 0; i < cache->lines_numof; i++) {
+            mtd_cache_line_t *line = &cache->lines[i];
+
+            if (_is_dirty(line) && (!next || (line->page < next->page))) {
+                next = line;
+            }
+        }
+        if (next == NULL) {
+            return 0;
+        }
+
+        int res = _writeback(cache, next);
+        if (res < 0) {
+            return res;
+        }
+    }
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    int res = _flush_locked(cache);
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    return mtd_cache_flush(container_of(mtd, mtd_cache_t, mtd));
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    if (power == MTD_POWER_DOWN) {
+        res = _flush_locked(cache);
+    }
+    if (res == 0) {
+        res = mtd_power(cache->parent, power);
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+void mtd_cache_get_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+void mtd_cache_reset_stats(mtd_cache_t *cache)
+{
+    mutex_lock(&cache->lock);
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .flush = _flush,
+    .power = _power,
+};
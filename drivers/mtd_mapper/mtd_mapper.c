@@ -129,9 +129,20 @@ static int _erase(mtd_dev_t *mtd, uint32_t addr, uint32_t count)
     return res;
 }
 
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_mapper_region_t *region = container_of(mtd, mtd_mapper_region_t, mtd);
+
+    _lock(region);
+    int res = mtd_flush(region->parent->mtd);
+    _unlock(region);
+    return res;
+}
+
 const mtd_desc_t mtd_mapper_driver = {
     .init = _init,
     .read = _read,
     .write = _write,
     .erase = _erase,
+    .flush = _flush,
 };
@@ -23,6 +23,34 @@
 static uint32_t demux = COAP_PORT;
 static gnrc_nettype_t ntype = GNRC_NETTYPE_UDP;
 
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    uint8_t *value;
+    uint32_t blknum, num;
+    unsigned szx;
+
+    /* look up options by number to exercise the option parser */
+    coap_get_content_type(pdu);
+    coap_get_blockopt(pdu, COAP_OPT_BLOCK1, &blknum, &szx);
+    coap_get_blockopt(pdu, COAP_OPT_BLOCK2, &blknum, &szx);
+    coap_opt_get_uint(pdu, COAP_OPT_ACCEPT, &num);
+    coap_opt_get_opaque(pdu, COAP_OPT_URI_QUERY, &value);
+
+    return gcoap_response(pdu, buf, len, COAP_CODE_CHANGED);
+}
+
+static const coap_resource_t _resources[] = {
+    { "/riot/value", COAP_GET | COAP_POST, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources     = &_resources[0],
+    .resources_len = ARRAY_SIZE(_resources),
+    .next          = NULL
+};
+
 void initialize(void)
 {
     if (fuzzing_init(NULL, 0)) {
@@ -30,6 +58,7 @@ void initialize(void)
     }
 
     gcoap_init();
+    gcoap_register_listener(&_listener);
 }
 
 int main(void)
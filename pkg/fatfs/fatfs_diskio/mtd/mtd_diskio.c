@@ -166,8 +166,7 @@ DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
     switch (cmd) {
 #if (FF_FS_READONLY == 0)
         case CTRL_SYNC:
-            /* r/w is always finished within r/w-functions of mtd */
-            return RES_OK;
+            return (mtd_flush(fatfs_mtd_devs[pdrv]) == 0) ? RES_OK : RES_ERROR;
 #endif
 
 #if (FF_USE_MKFS == 1)
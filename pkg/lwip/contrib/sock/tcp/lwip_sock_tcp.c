@@ -268,6 +268,46 @@ int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
     return res;
 }
 
+static int _recv_pbuf(sock_tcp_t *sock, struct pbuf **buf)
+{
+    err_t err;
+
+    if ((err = netconn_recv_tcp_pbuf(sock->base.conn, buf)) < 0) {
+        switch (err) {
+            case ERR_ABRT:
+                return -ECONNABORTED;
+            case ERR_CONN:
+                return -EADDRNOTAVAIL;
+            case ERR_RST:
+            case ERR_CLSD:
+                return -ECONNRESET;
+            case ERR_MEM:
+                return -ENOMEM;
+#if LWIP_SO_RCVTIMEO
+            case ERR_TIMEOUT:
+                return -ETIMEDOUT;
+#endif
+            default:
+                /* no applicable error */
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* returns the contiguous part of buf at offset */
+static uint16_t _pbuf_part(struct pbuf *buf, uint16_t offset, void **data)
+{
+    for (struct pbuf *q = buf; q != NULL; q = q->next) {
+        if (offset < q->len) {
+            *data = (uint8_t *)q->payload + offset;
+            return q->len - offset;
+        }
+        offset -= q->len;
+    }
+    return 0;
+}
+
 ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
                       uint32_t timeout)
 {
@@ -304,32 +344,7 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
             buf = sock->last_buf;
         }
         else {
-            err_t err;
-            if ((err = netconn_recv_tcp_pbuf(sock->base.conn, &buf)) < 0) {
-                switch (err) {
-                    case ERR_ABRT:
-                        res = -ECONNABORTED;
-                        break;
-                    case ERR_CONN:
-                        res = -EADDRNOTAVAIL;
-                        break;
-                    case ERR_RST:
-                    case ERR_CLSD:
-                        res = -ECONNRESET;
-                        break;
-                    case ERR_MEM:
-                        res = -ENOMEM;
-                        break;
-#if LWIP_SO_RCVTIMEO
-                    case ERR_TIMEOUT:
-                        res = -ETIMEDOUT;
-                        break;
-#endif
-                    default:
-                        /* no applicable error */
-                        res = -1;
-                        break;
-                }
+            if ((res = _recv_pbuf(sock, &buf)) < 0) {
                 break;
             }
             sock->last_buf = buf;
@@ -368,6 +383,76 @@ ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
     return res;
 }
 
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout)
+{
+    ssize_t res = 0;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (sock->base.conn == NULL) {
+        *buf_ctx = NULL;
+        return -ENOTCONN;
+    }
+    if (*buf_ctx != NULL) {
+        /* release the part handed out before */
+        mutex_lock(&sock->mutex);
+        if (sock->last_buf != NULL) {
+            void *prev;
+
+            sock->last_offset += _pbuf_part(sock->last_buf, sock->last_offset,
+                                            &prev);
+            if (sock->last_offset < sock->last_buf->tot_len) {
+                res = _pbuf_part(sock->last_buf, sock->last_offset, data);
+            }
+            else {
+                pbuf_free(sock->last_buf);
+                sock->last_buf = NULL;
+                sock->last_offset = 0;
+            }
+        }
+        *buf_ctx = (res > 0) ? sock->last_buf : NULL;
+        mutex_unlock(&sock->mutex);
+        return res;
+    }
+    if (timeout == 0) {
+        if (!mutex_trylock(&sock->mutex)) {
+            return -EAGAIN;
+        }
+    }
+    else {
+        mutex_lock(&sock->mutex);
+    }
+    /* data left over by sock_tcp_read() */
+    if (sock->last_buf == NULL) {
+        struct pbuf *buf;
+
+#if LWIP_SO_RCVTIMEO
+        if ((timeout != 0) && (timeout != SOCK_NO_TIMEOUT)) {
+            netconn_set_recvtimeout(sock->base.conn, timeout / US_PER_MS);
+        }
+        else
+#endif
+        if ((timeout == 0) && !cib_avail(&sock->base.conn->recvmbox.mbox.cib)) {
+            mutex_unlock(&sock->mutex);
+            return -EAGAIN;
+        }
+        res = _recv_pbuf(sock, &buf);
+#if LWIP_SO_RCVTIMEO
+        netconn_set_recvtimeout(sock->base.conn, 0);
+#endif
+        if (res == 0) {
+            sock->last_buf = buf;
+            sock->last_offset = 0;
+        }
+    }
+    if (sock->last_buf != NULL) {
+        res = _pbuf_part(sock->last_buf, sock->last_offset, data);
+    }
+    *buf_ctx = (res > 0) ? sock->last_buf : NULL;
+    mutex_unlock(&sock->mutex);
+    return res;
+}
+
 ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
 {
     struct netconn *conn;
@@ -69,6 +69,36 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep)
                                0)) ? -ENOTCONN : 0;
 }
 
+/**
+ * @brief   Converts the source of a received netbuf to a remote end point
+ */
+static int _get_remote(sock_udp_t *sock, struct netbuf *buf,
+                       sock_udp_ep_t *remote)
+{
+    size_t addr_len;
+
+    if (NETCONNTYPE_ISIPV6(sock->base.conn->type)) {
+        addr_len = sizeof(ipv6_addr_t);
+        remote->family = AF_INET6;
+    }
+    else if (IS_ACTIVE(LWIP_IPV4)) {
+        addr_len = sizeof(ipv4_addr_t);
+        remote->family = AF_INET;
+    }
+    else {
+        return -EPROTO;
+    }
+#if LWIP_NETBUF_RECVINFO
+    remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
+#else
+    remote->netif = SOCK_ADDR_ANY_NETIF;
+#endif
+    /* copy address */
+    memcpy(&remote->addr, &buf->addr, addr_len);
+    remote->port = buf->port;
+    return 0;
+}
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -118,29 +148,9 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **ctx,
     if ((res = lwip_sock_recv(sock->base.conn, timeout, &buf)) < 0) {
         return res;
     }
-    if (remote != NULL) {
-        /* convert remote */
-        size_t addr_len;
-        if (NETCONNTYPE_ISIPV6(sock->base.conn->type)) {
-            addr_len = sizeof(ipv6_addr_t);
-            remote->family = AF_INET6;
-        }
-        else if (IS_ACTIVE(LWIP_IPV4)) {
-            addr_len = sizeof(ipv4_addr_t);
-            remote->family = AF_INET;
-        }
-        else {
-            netbuf_delete(buf);
-            return -EPROTO;
-        }
-#if LWIP_NETBUF_RECVINFO
-        remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
-#else
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-#endif
-        /* copy address */
-        memcpy(&remote->addr, &buf->addr, addr_len);
-        remote->port = buf->port;
+    if ((remote != NULL) && (_get_remote(sock, buf, remote) < 0)) {
+        netbuf_delete(buf);
+        return -EPROTO;
     }
     *data = buf->ptr->payload;
     *ctx = buf;
@@ -160,6 +170,74 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+/* copies the payload of a received netbuf, truncated to the buffer space */
+static void _copy_msg(sock_udp_msg_t *msg, struct netbuf *buf)
+{
+    size_t len = buf->p->tot_len;
+
+    msg->flags = 0;
+    if (len > msg->len) {
+        len = msg->len;
+        msg->flags |= SOCK_UDP_MSG_FLAG_TRUNC;
+    }
+    msg->msg_len = netbuf_copy(buf, msg->data, len);
+}
+
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count, uint32_t timeout)
+{
+    struct netconn *conn;
+    struct netbuf *buf;
+    size_t num = 0;
+    int res;
+
+    assert((sock != NULL) && (msgs != NULL) && (count > 0));
+    conn = sock->base.conn;
+    /* only block for the first message */
+    if ((res = lwip_sock_recv(conn, timeout, &buf)) < 0) {
+        return res;
+    }
+    while (1) {
+        res = _get_remote(sock, buf, &msgs[num].remote);
+        if (res == 0) {
+            _copy_msg(&msgs[num++], buf);
+        }
+        netbuf_delete(buf);
+        if ((res < 0) || (num == count) ||
+            !cib_avail(&conn->recvmbox.mbox.cib)) {
+            break;
+        }
+        /* lwIP has no call to take multiple messages at once, but take the
+         * ones already queued without the timeout handling of
+         * lwip_sock_recv() */
+        if (netconn_recv(conn, &buf) != ERR_OK) {
+            break;
+        }
+    }
+    return (num > 0) ? (ssize_t)num : res;
+}
+
+ssize_t sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count)
+{
+    ssize_t res = 0;
+    size_t num = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (count > 0));
+    while (num < count) {
+        sock_udp_msg_t *msg = &msgs[num];
+
+        res = sock_udp_send(sock, msg->data, msg->len,
+                            (msg->remote.port != 0) ? &msg->remote : NULL);
+        if (res < 0) {
+            break;
+        }
+        msg->msg_len = res;
+        num++;
+    }
+    return (num > 0) ? (ssize_t)num : res;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
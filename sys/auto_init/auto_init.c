@@ -49,6 +49,11 @@ void auto_init(void)
         extern void init_schedstatistics(void);
         init_schedstatistics();
     }
+    if (IS_USED(MODULE_SCHED_LATENCY)) {
+        LOG_DEBUG("Auto init sched_latency.\n");
+        extern void sched_latency_init(void);
+        sched_latency_init();
+    }
     if (IS_USED(MODULE_DUMMY_THREAD)) {
         extern void dummy_thread_create(void);
         dummy_thread_create();
@@ -58,6 +63,11 @@ void auto_init(void)
         extern void auto_init_event_thread(void);
         auto_init_event_thread();
     }
+    if (IS_USED(MODULE_MTD_ASYNC)) {
+        LOG_DEBUG("Auto init mtd_async.\n");
+        extern void mtd_async_init(void);
+        mtd_async_init();
+    }
     if (IS_USED(MODULE_MCI)) {
         LOG_DEBUG("Auto init mci.\n");
         extern void mci_initialize(void);
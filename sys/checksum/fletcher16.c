@@ -18,8 +18,24 @@
  * @}
  */
 
+#include "architecture.h"
 #include "checksum/fletcher16.h"
 
+#if ARCHITECTURE_WORD_BITS >= 32
+/* Largest multiple of 4 bytes that can be added to sums of at most 0x1fe
+ * before sum2 overflows 32 bit: 0x1fe * (n + 1) + 0xff * n * (n + 1) / 2 */
+#define _BLOCK_LEN  (5800U)
+
+/* Reduces x to at most 0x101 while keeping x mod 255. 65535 is a multiple
+ * of 255, so folding 16 bits is fine as well. */
+static inline uint32_t _fold(uint32_t x)
+{
+    x = (x & 0xffff) + (x >> 16);
+    x = (x & 0xff) + (x >> 8);
+    return (x & 0xff) + (x >> 8);
+}
+#endif
+
 static inline void _reduce(fletcher16_ctx_t *ctx)
 {
     ctx->sum1 = (ctx->sum1 & 0xff) + (ctx->sum1 >> 8);
@@ -34,6 +50,24 @@ void fletcher16_init(fletcher16_ctx_t *ctx)
 
 void fletcher16_update(fletcher16_ctx_t *ctx, const uint8_t *data, size_t len)
 {
+#if ARCHITECTURE_WORD_BITS >= 32
+    /* sum up 4 bytes per iteration in 32 bit and only reduce once per block */
+    uint32_t sum1 = ctx->sum1, sum2 = ctx->sum2;
+
+    while (len >= 4) {
+        size_t tlen = len > _BLOCK_LEN ? _BLOCK_LEN : (len & ~0x3U);
+        len -= tlen;
+        do {
+            sum2 += 4 * (sum1 + data[0]) + 3 * data[1] + 2 * data[2] + data[3];
+            sum1 += data[0] + data[1] + data[2] + data[3];
+            data += 4;
+        } while (tlen -= 4);
+        sum1 = _fold(sum1);
+        sum2 = _fold(sum2);
+    }
+    ctx->sum1 = sum1;
+    ctx->sum2 = sum2;
+#endif
     while (len) {
         size_t tlen = len > 20 ? 20 : len;
         len -= tlen;
@@ -18,6 +18,7 @@
  * @}
  */
 
+#include "architecture.h"
 #include "unaligned.h"
 #include "checksum/fletcher32.h"
 
@@ -25,6 +26,23 @@ uint32_t fletcher32(const uint16_t *data, size_t words)
 {
     uint32_t sum1 = 0xffff, sum2 = 0xffff;
 
+#if ARCHITECTURE_WORD_BITS >= 32
+    /* sum up 2 words per iteration, 358 is the largest even number of words
+     * that can be added to sums of at most 0x1fffe before sum2 overflows */
+    while (words >= 2) {
+        unsigned tlen = words > 358 ? 358 : (words & ~0x1U);
+        words -= tlen;
+        do {
+            uint16_t w0 = unaligned_get_u16(data++);
+            uint16_t w1 = unaligned_get_u16(data++);
+
+            sum2 += 2 * (sum1 + w0) + w1;
+            sum1 += w0 + w1;
+        } while (tlen -= 2);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    }
+#endif
     while (words) {
         unsigned tlen = words > 359 ? 359 : words;
         words -= tlen;
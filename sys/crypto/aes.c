@@ -39,6 +39,19 @@
 #include <stdint.h>
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
+
+/* the compiler targets a CPU with the AES instructions, e.g. with
+ * CFLAGS += -maes on native */
+#if defined(__AES__) && defined(__SSE2__)
+#include <immintrin.h>
+#define AES_NI  1
+/* the T-tables are only used for the key schedules then, so the precalculated
+ * ones would only waste ROM */
+#undef MODULE_CRYPTO_AES_PRECALCULATED
+#else
+#define AES_NI  0
+#endif
 
 /**
  * Interface to the aes cipher
@@ -48,7 +61,9 @@ static const cipher_interface_t aes_interface = {
     AES_KEY_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
+    aes_decrypt_blocks
 };
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
 
@@ -480,6 +495,8 @@ static const u32 Td0[256] = {
     #define Td4(n)  (Td4u(n) | (Td4u(n) << 8) | (Td4u(n) << 16) | \
                      (Td4u(n) << 24))
 
+/* only needed for the last round of the decryption with T-tables */
+#if !AES_NI
 static const u8 Td4[256] = {
     0x52U, 0x09U, 0x6aU, 0xd5U, 0x30U, 0x36U, 0xa5U, 0x38U,
     0xbfU, 0x40U, 0xa3U, 0x9eU, 0x81U, 0xf3U, 0xd7U, 0xfbU,
@@ -514,6 +531,7 @@ static const u8 Td4[256] = {
     0x17U, 0x2bU, 0x04U, 0x7eU, 0xbaU, 0x77U, 0xd6U, 0x26U,
     0xe1U, 0x69U, 0x14U, 0x63U, 0x55U, 0x21U, 0x0cU, 0x7dU,
 };
+#endif
 #else
     #define Td0(n)  (Td0[n])
     #define Td1(n)  (Td1[n])
@@ -796,37 +814,6 @@ static const u32 rcon[] = {
 };
 
 
-int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
-{
-    uint8_t i;
-
-    /* This implementation only supports a single key size (defined in AES_KEY_SIZE) */
-    if (keySize != AES_KEY_SIZE) {
-        return CIPHER_ERR_INVALID_KEY_SIZE;
-    }
-
-    /* Make sure that context is large enough. If this is not the case,
-       you should build with -DAES */
-    if (CIPHER_MAX_CONTEXT_SIZE < AES_KEY_SIZE) {
-        return CIPHER_ERR_BAD_CONTEXT_SIZE;
-    }
-
-    /* key must be at least CIPHERS_MAX_KEY_SIZE Bytes long */
-    if (keySize < CIPHERS_MAX_KEY_SIZE) {
-        /* fill up by concatenating key to as long as needed */
-        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
-            context->context[i] = key[(i % keySize)];
-        }
-    }
-    else {
-        for (i = 0; i < CIPHERS_MAX_KEY_SIZE; i++) {
-            context->context[i] = key[i];
-        }
-    }
-
-    return CIPHER_INIT_SUCCESS;
-}
-
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -1023,33 +1010,61 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
     return 0;
 }
 
-#ifndef AES_ASM
 /*
- * Encrypt a single block
- * in and out can overlap
+ * Copies an expanded key schedule into the context. AES-NI expects the round
+ * keys in the byte order of the state, the T-table code as big endian words.
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void aes_store_key(uint32_t *dst, const AES_KEY *key)
+{
+#if AES_NI
+    for (unsigned i = 0; i < 4 * (AES_ROUNDS + 1); i++) {
+        PUTU32((uint8_t *)&dst[i], key->rd_key[i]);
+    }
+#else
+    memcpy(dst, key->rd_key, 4 * (AES_ROUNDS + 1) * sizeof(uint32_t));
+#endif
+}
+
+int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
 {
-    /* setup AES_KEY */
-    int res;
+    aes_context_t *ctx = (aes_context_t *)context->context;
     AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
 
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-    if (res < 0) {
-        return res;
+    /* This implementation only supports a single key size (defined in AES_KEY_SIZE) */
+    if (keySize != AES_KEY_SIZE) {
+        return CIPHER_ERR_INVALID_KEY_SIZE;
     }
 
-    const u32 *rk;
+    /* Make sure that context is large enough. If this is not the case,
+       you should build with -DAES */
+    if (CIPHER_MAX_CONTEXT_SIZE < sizeof(aes_context_t)) {
+        return CIPHER_ERR_BAD_CONTEXT_SIZE;
+    }
+
+    /* expand both key schedules once instead of for every call */
+    aes_set_encrypt_key(key, AES_KEY_SIZE * 8, &aeskey);
+    aes_store_key(ctx->enc_key, &aeskey);
+    aes_set_decrypt_key(key, AES_KEY_SIZE * 8, &aeskey);
+    aes_store_key(ctx->dec_key, &aeskey);
+    crypto_secure_wipe(&aeskey, sizeof(aeskey));
+
+    return CIPHER_INIT_SUCCESS;
+}
+
+#ifndef AES_ASM
+#if !AES_NI
+/*
+ * Encrypt a single block with an expanded key
+ * in and out can overlap
+ */
+static void aes_encrypt_block(const u32 *rk, const int rounds,
+                              const uint8_t *plainBlock, uint8_t *cipherBlock)
+{
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
     int r;
 #endif /* ?MODULE_CRYPTO_AES_UNROLL */
 
-    rk = key->rd_key;
-
     /*
      * map byte array block to cipher state
      * and add initial round key:
@@ -1141,7 +1156,7 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
     t3 = Te0(s3 >> 24) ^ Te1((s0 >> 16) & 0xff) ^ Te2((s1 >>  8) & 0xff) ^
          Te3(s2 & 0xff) ^ rk[39];
 
-    if (key->rounds > 10) {
+    if (rounds > 10) {
         /* round 10: */
         s0 = Te0(t0 >> 24) ^ Te1((t1 >> 16) & 0xff) ^ Te2((t2 >>  8) & 0xff) ^
              Te3(t3 & 0xff) ^ rk[40];
@@ -1161,7 +1176,7 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         t3 = Te0(s3 >> 24) ^ Te1((s0 >> 16) & 0xff) ^ Te2((s1 >>  8) & 0xff) ^
              Te3(s2 & 0xff) ^ rk[47];
 
-        if (key->rounds > 12) {
+        if (rounds > 12) {
             /* round 12: */
             s0 = Te0(t0 >> 24) ^ Te1((t1 >> 16) & 0xff) ^ Te2((t2 >>  8) &
                                                               0xff) ^ Te3(
@@ -1191,12 +1206,12 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         }
     }
 
-    rk += key->rounds << 2;
+    rk += rounds << 2;
 #else  /* !MODULE_CRYPTO_AES_UNROLL */
     /*
      * Nr - 1 full rounds:
      */
-    r = key->rounds >> 1;
+    r = rounds >> 1;
 
     while (1) {
         t0 =
@@ -1289,36 +1304,70 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
+#endif /* !AES_NI */
+
 /*
- * Decrypt a single block
+ * Encrypt a single block
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+/*
+ * Encrypt consecutive blocks with the key schedule of the context
+ * in and out can overlap
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plainBlocks,
+                       uint8_t *cipherBlocks, size_t blocks)
+{
+    const aes_context_t *ctx = (const aes_context_t *)context->context;
 
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
+#if AES_NI
+    __m128i rk[AES_ROUNDS + 1];
+
+    for (unsigned i = 0; i <= AES_ROUNDS; i++) {
+        rk[i] = _mm_loadu_si128((const __m128i *)&ctx->enc_key[4 * i]);
+    }
+    while (blocks--) {
+        __m128i s = _mm_loadu_si128((const __m128i *)plainBlocks);
 
-    if (res < 0) {
-        return res;
+        s = _mm_xor_si128(s, rk[0]);
+        for (unsigned i = 1; i < AES_ROUNDS; i++) {
+            s = _mm_aesenc_si128(s, rk[i]);
+        }
+        s = _mm_aesenclast_si128(s, rk[AES_ROUNDS]);
+        _mm_storeu_si128((__m128i *)cipherBlocks, s);
+        plainBlocks += AES_BLOCK_SIZE;
+        cipherBlocks += AES_BLOCK_SIZE;
+    }
+#else
+    while (blocks--) {
+        aes_encrypt_block(ctx->enc_key, AES_ROUNDS, plainBlocks, cipherBlocks);
+        plainBlocks += AES_BLOCK_SIZE;
+        cipherBlocks += AES_BLOCK_SIZE;
     }
+#endif
+    return 1;
+}
 
-    const u32 *rk;
+#if !AES_NI
+/*
+ * Decrypt a single block with an expanded key
+ * in and out can overlap
+ */
+static void aes_decrypt_block(const u32 *rk, const int rounds,
+                              const uint8_t *cipherBlock, uint8_t *plainBlock)
+{
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
     int r;
 #endif /* ?MODULE_CRYPTO_AES_UNROLL */
 
-    rk = key->rd_key;
-
     /*
      * map byte array block to cipher state
      * and add initial round key:
@@ -1410,7 +1459,7 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
     t3 = Td0(s3 >> 24) ^ Td1((s2 >> 16) & 0xff) ^ Td2((s1 >>  8) & 0xff) ^
          Td3(s0 & 0xff) ^ rk[39];
 
-    if (key->rounds > 10) {
+    if (rounds > 10) {
         /* round 10: */
         s0 = Td0(t0 >> 24) ^ Td1((t3 >> 16) & 0xff) ^ Td2((t2 >>  8) & 0xff) ^
              Td3(t1 & 0xff) ^ rk[40];
@@ -1430,7 +1479,7 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         t3 = Td0(s3 >> 24) ^ Td1((s2 >> 16) & 0xff) ^ Td2((s1 >>  8) & 0xff) ^
              Td3(s0 & 0xff) ^ rk[47];
 
-        if (key->rounds > 12) {
+        if (rounds > 12) {
             /* round 12: */
             s0 = Td0(t0 >> 24) ^ Td1((t3 >> 16) & 0xff) ^ Td2((t2 >>  8) & 0xff)
                  ^ Td3(t1 & 0xff) ^ rk[48];
@@ -1452,12 +1501,12 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         }
     }
 
-    rk += key->rounds << 2;
+    rk += rounds << 2;
 #else  /* !MODULE_CRYPTO_AES_UNROLL */
     /*
      * Nr - 1 full rounds:
      */
-    r = key->rounds >> 1;
+    r = rounds >> 1;
 
     while (1) {
         t0 =
@@ -1550,6 +1599,56 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
+}
+
+#endif /* !AES_NI */
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    return aes_decrypt_blocks(context, cipherBlock, plainBlock, 1);
+}
+
+/*
+ * Decrypt consecutive blocks with the key schedule of the context
+ * in and out can overlap
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *cipherBlocks,
+                       uint8_t *plainBlocks, size_t blocks)
+{
+    const aes_context_t *ctx = (const aes_context_t *)context->context;
+
+#if AES_NI
+    /* the decryption key schedule is the one of the equivalent inverse
+     * cipher, which is what AESDEC expects */
+    __m128i rk[AES_ROUNDS + 1];
+
+    for (unsigned i = 0; i <= AES_ROUNDS; i++) {
+        rk[i] = _mm_loadu_si128((const __m128i *)&ctx->dec_key[4 * i]);
+    }
+    while (blocks--) {
+        __m128i s = _mm_loadu_si128((const __m128i *)cipherBlocks);
+
+        s = _mm_xor_si128(s, rk[0]);
+        for (unsigned i = 1; i < AES_ROUNDS; i++) {
+            s = _mm_aesdec_si128(s, rk[i]);
+        }
+        s = _mm_aesdeclast_si128(s, rk[AES_ROUNDS]);
+        _mm_storeu_si128((__m128i *)plainBlocks, s);
+        cipherBlocks += AES_BLOCK_SIZE;
+        plainBlocks += AES_BLOCK_SIZE;
+    }
+#else
+    while (blocks--) {
+        aes_decrypt_block(ctx->dec_key, AES_ROUNDS, cipherBlocks, plainBlocks);
+        cipherBlocks += AES_BLOCK_SIZE;
+        plainBlocks += AES_BLOCK_SIZE;
+    }
+#endif
     return 1;
 }
 
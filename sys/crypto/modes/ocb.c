@@ -24,6 +24,9 @@
 #define OCB_MODE_ENCRYPT 1
 #define OCB_MODE_DECRYPT 2
 
+/* number of blocks passed to the cipher at once */
+#define OCB_BULK_BLOCKS 4
+
 struct ocb_state {
     const cipher_t *cipher;
     uint8_t l_star[16];
@@ -77,34 +80,48 @@ static void xor_block(const uint8_t block1[16], const uint8_t block2[16],
     }
 }
 
-static void processBlock(ocb_state_t *state, size_t blockNumber,
-                         const uint8_t input[16], uint8_t output[16],
-                         uint8_t mode)
+static int processBlocks(ocb_state_t *state, size_t blockNumber,
+                         const uint8_t *input, uint8_t *output,
+                         size_t blocks, uint8_t mode)
 {
-    /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
-    uint8_t l_i[16];
-
-    calculate_l_i(state->l_zero, ntz(blockNumber + 1), l_i);
-    xor_block(state->offset, l_i, state->offset);
-    /* Sum_i = Sum_{i-1} xor ENCIPHER(K, A_i xor Offset_i) */
-    uint8_t cipher_output[16], cipher_input[16];
-    xor_block(input, state->offset, cipher_input);
+    uint8_t offsets[OCB_BULK_BLOCKS][16];
+    uint8_t cipher_buf[OCB_BULK_BLOCKS * 16];
+    int res;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
+        uint8_t l_i[16];
+
+        calculate_l_i(state->l_zero, ntz(blockNumber + i + 1), l_i);
+        xor_block(state->offset, l_i, state->offset);
+        memcpy(offsets[i], state->offset, 16);
+        xor_block(input + i * 16, offsets[i], cipher_buf + i * 16);
+    }
+
+    /* all blocks of the chunk go through the cipher at once */
     if (mode == OCB_MODE_ENCRYPT) {
-        state->cipher->interface->encrypt(&(state->cipher->context),
-                                          cipher_input, cipher_output);
+        res = cipher_encrypt_blocks(state->cipher, cipher_buf, cipher_buf,
+                                    blocks);
     }
-    else if (mode == OCB_MODE_DECRYPT) {
-        state->cipher->interface->decrypt(&(state->cipher->context),
-                                          cipher_input, cipher_output);
+    else {
+        res = cipher_decrypt_blocks(state->cipher, cipher_buf, cipher_buf,
+                                    blocks);
     }
-    xor_block(state->offset, cipher_output, output);
-    /* Checksum_i = Checksum_{i-1} xor P_i */
-    if (mode == OCB_MODE_ENCRYPT) {
-        xor_block(state->checksum, input, state->checksum);
+    if (res != 1) {
+        return res;
     }
-    else if (mode == OCB_MODE_DECRYPT) {
-        xor_block(state->checksum, output, state->checksum);
+
+    for (size_t i = 0; i < blocks; ++i) {
+        /* Checksum_i = Checksum_{i-1} xor P_i */
+        if (mode == OCB_MODE_ENCRYPT) {
+            xor_block(state->checksum, input + i * 16, state->checksum);
+        }
+        xor_block(offsets[i], cipher_buf + i * 16, output + i * 16);
+        if (mode == OCB_MODE_DECRYPT) {
+            xor_block(state->checksum, output + i * 16, state->checksum);
+        }
     }
+    return 1;
 }
 
 static void hash(ocb_state_t *state, const uint8_t *data, size_t data_len,
@@ -119,19 +136,23 @@ static void hash(ocb_state_t *state, const uint8_t *data, size_t data_len,
     /* Offset_0 = zeros(128) */
     uint8_t offset[16];
     memset(offset, 0, 16);
-    for (size_t i = 0; i < m; ++i) {
-        /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
-        uint8_t l_i[16];
-        calculate_l_i(state->l_zero, ntz(i + 1), l_i);
-        xor_block(offset, l_i, offset);
+    for (size_t i = 0; i < m; i += OCB_BULK_BLOCKS) {
+        size_t blocks = (m - i > OCB_BULK_BLOCKS) ? OCB_BULK_BLOCKS : m - i;
+        uint8_t cipher_buf[OCB_BULK_BLOCKS * 16];
+
+        for (size_t j = 0; j < blocks; ++j) {
+            /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
+            uint8_t l_i[16];
+            calculate_l_i(state->l_zero, ntz(i + j + 1), l_i);
+            xor_block(offset, l_i, offset);
+            xor_block(data, offset, cipher_buf + j * 16);
+            data += 16;
+        }
         /* Sum_i = Sum_{i-1} xor ENCIPHER(K, A_i xor Offset_i) */
-        uint8_t enciphered_block[16], cipher_input[16];
-        xor_block(data, offset, cipher_input);
-        state->cipher->interface->encrypt(&(state->cipher->context),
-                                          cipher_input, enciphered_block);
-        xor_block(output, enciphered_block, output);
-
-        data += 16;
+        cipher_encrypt_blocks(state->cipher, cipher_buf, cipher_buf, blocks);
+        for (size_t j = 0; j < blocks; ++j) {
+            xor_block(output, cipher_buf + j * 16, output);
+        }
     }
     if (remaining_data_len > 0) {
         /* Offset_* = Offset_m xor L_* */
@@ -237,10 +258,16 @@ static int32_t run_ocb(const cipher_t *cipher,
 
     /* Process any whole blocks */
     size_t output_pos = 0;
-    for (size_t i = 0; i < m; ++i) {
-        processBlock(&state, i, input, output + output_pos, mode);
-        output_pos += 16;
-        input += 16;
+    for (size_t i = 0; i < m; i += OCB_BULK_BLOCKS) {
+        size_t blocks = (m - i > OCB_BULK_BLOCKS) ? OCB_BULK_BLOCKS : m - i;
+
+        if (processBlocks(&state, i, input, output + output_pos, blocks,
+                          mode) != 1) {
+            return (mode == OCB_MODE_ENCRYPT) ? CIPHER_ERR_ENC_FAILED
+                                              : CIPHER_ERR_DEC_FAILED;
+        }
+        output_pos += blocks * 16;
+        input += blocks * 16;
     }
 
     /* Process any final partial block and compute raw tag */
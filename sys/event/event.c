@@ -22,7 +22,7 @@
  */
 
 #include <assert.h>
-
+#include <stdbool.h>
 #include <string.h>
 
 #include "event.h"
@@ -33,21 +33,112 @@
 #include "xtimer.h"
 #endif
 
+#if defined(MODULE_EVENT_MPSC) && (__GCC_ATOMIC_POINTER_LOCK_FREE == 2)
+/* Producers push onto queue->pending, a lock-free LIFO. The consumer moves
+ * all pending events in FIFO order to queue->event_list once the latter is
+ * empty.
+ *
+ * The list_node.next pointer of an event is non-NULL as long as the event is
+ * queued. It is claimed first by setting it to _end, which also terminates
+ * the pending stack. */
+#define EVENT_MPSC_LOCKFREE     1
+
+static clist_node_t _end;
+
+/* returns true if the pending stack was empty before */
+static bool _pending_push(event_queue_t *queue, event_t *event)
+{
+    clist_node_t *node = &event->list_node;
+    clist_node_t *head = NULL;
+
+    if (!__atomic_compare_exchange_n(&node->next, &head, &_end, false,
+                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        /* already queued */
+        return false;
+    }
+    head = __atomic_load_n(&queue->pending, __ATOMIC_RELAXED);
+    do {
+        __atomic_store_n(&node->next, (head) ? head : &_end, __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&queue->pending, &head, node, true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    return (head == NULL);
+}
+
+/* must be called with interrupts disabled */
+static void _pending_drain(event_queue_t *queue)
+{
+    clist_node_t *node = __atomic_exchange_n(&queue->pending, NULL,
+                                             __ATOMIC_ACQUIRE);
+    clist_node_t *fifo = NULL;
+
+    /* the pending stack is in reverse order of posting */
+    while (node) {
+        clist_node_t *next = node->next;
+
+        node->next = fifo;
+        fifo = node;
+        node = (next == &_end) ? NULL : next;
+    }
+    while (fifo) {
+        clist_node_t *next = fifo->next;
+
+        clist_rpush(&queue->event_list, fifo);
+        fifo = next;
+    }
+}
+
+/* must be called with interrupts disabled */
+static event_t *_lpop(event_queue_t *queue)
+{
+    if (!queue->event_list.next) {
+        _pending_drain(queue);
+    }
+    return (event_t *)clist_lpop(&queue->event_list);
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
+    /* The owner drains the pending stack whenever event_list runs empty and
+     * only waits for the flag after it found both empty. Every event pushed
+     * onto a non-empty stack is therefore seen without another wake up. */
+    if (!_pending_push(queue, event)) {
+        return;
+    }
+
+    thread_t *waiter = __atomic_load_n(&queue->waiter, __ATOMIC_RELAXED);
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+#else
+/* must be called with interrupts disabled */
+static event_t *_lpop(event_queue_t *queue)
+{
+    return (event_t *)clist_lpop(&queue->event_list);
+}
+
+void event_post(event_queue_t *queue, event_t *event)
+{
+    assert(queue && event);
+
+    bool wake = false;
     unsigned state = irq_disable();
     if (!event->list_node.next) {
+        /* the owner only waits for the flag after it found the queue empty,
+         * so only the first event of a burst needs to wake it */
+        wake = !queue->event_list.next;
         clist_rpush(&queue->event_list, &event->list_node);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
 
-    if (waiter) {
+    if (wake && waiter) {
         thread_flags_set(waiter, THREAD_FLAG_EVENT);
     }
 }
+#endif
 
 void event_cancel(event_queue_t *queue, event_t *event)
 {
@@ -55,6 +146,9 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
+#ifdef EVENT_MPSC_LOCKFREE
+    _pending_drain(queue);
+#endif
     clist_remove(&queue->event_list, &event->list_node);
     event->list_node.next = NULL;
     irq_restore(state);
@@ -63,7 +157,7 @@ void event_cancel(event_queue_t *queue, event_t *event)
 event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
-    event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    event_t *result = _lpop(queue);
     irq_restore(state);
 
     if (result) {
@@ -80,8 +174,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     do {
         unsigned state = irq_disable();
         for (size_t i = 0; i < n_queues; i++) {
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
+            result = _lpop(&queues[i]);
             if (result) {
                 break;
             }
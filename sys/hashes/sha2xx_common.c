@@ -49,6 +49,10 @@
 #include <stdint.h>
 #include <assert.h>
 
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
 #include "hashes/sha2xx_common.h"
 
 
@@ -97,43 +101,126 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#if defined(__SHA__) && defined(__SSE4_1__)
 /*
- * SHA256 block compression function.  The 256-bit state is transformed via
- * the 512-bit input block to produce a new state.
+ * SHA256 block compression function using the x86 SHA extensions.  The
+ * 256-bit state is transformed via num 512-bit input blocks.  Only built
+ * when the compiler targets a CPU with these extensions, e.g. with
+ * CFLAGS += -msha -msse4.1 on native.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+static void sha2xx_transform(uint32_t *state, const unsigned char *blocks,
+                             size_t num)
 {
-    uint32_t W[64];
-    uint32_t S[8];
+    /* byte order of each 32 bit word of the message is swapped */
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                        0x0405060700010203ULL);
+    __m128i state0, state1, tmp;
+
+    /* the instructions work on the state in the order ABEF and CDGH */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    while (num--) {
+        __m128i abef = state0, cdgh = state1;
+        __m128i w[4];
+
+        for (int i = 0; i < 4; i++) {
+            w[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)(blocks + 16 * i)), mask);
+        }
 
-    /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
-    for (int i = 16; i < 64; i++) {
-        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
-    }
+        /* four rounds per iteration, w[i & 3] holds W[4 * i .. 4 * i + 3] */
+        for (int i = 0; i < 16; i++) {
+            __m128i msg = _mm_add_epi32(w[i & 3],
+                              _mm_loadu_si128((const __m128i *)&K[4 * i]));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            state0 = _mm_sha256rnds2_epu32(state0, state1,
+                                           _mm_shuffle_epi32(msg, 0x0E));
+            if (i < 12) {
+                tmp = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+                tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(i + 3) & 3],
+                                                         w[(i + 2) & 3], 4));
+                w[i & 3] = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+            }
+        }
 
-    /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        blocks += 64;
+    }
 
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+#else /* !__SHA__ */
 
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
+/*
+ * A single round.  Instead of moving the working variables, the callers
+ * rotate the arguments.
+ */
+#define SHA2XX_ROUND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[(i) & 15] + K[(i)]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
 
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
-    }
+/*
+ * SHA256 block compression function.  The 256-bit state is transformed via
+ * num 512-bit input blocks.
+ */
+static void sha2xx_transform(uint32_t *state, const unsigned char *blocks,
+                             size_t num)
+{
+    uint32_t W[16];
+
+    while (num--) {
+        /* 1. Prepare message schedule W. */
+        be32dec_vect(W, blocks, 64);
+
+        /* 2. Initialize working variables. */
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        /* 3. Mix. */
+        for (int i = 0; i < 64; i += 8) {
+            /* only the last 16 words of the message schedule are kept,
+             * W[j] replaces W[j - 16] */
+            if (i >= 16) {
+                for (int j = i; j < i + 8; j++) {
+                    W[j & 15] += s1(W[(j - 2) & 15]) + W[(j - 7) & 15] +
+                                 s0(W[(j - 15) & 15]);
+                }
+            }
+            SHA2XX_ROUND(a, b, c, d, e, f, g, h, i);
+            SHA2XX_ROUND(h, a, b, c, d, e, f, g, i + 1);
+            SHA2XX_ROUND(g, h, a, b, c, d, e, f, i + 2);
+            SHA2XX_ROUND(f, g, h, a, b, c, d, e, i + 3);
+            SHA2XX_ROUND(e, f, g, h, a, b, c, d, i + 4);
+            SHA2XX_ROUND(d, e, f, g, h, a, b, c, i + 5);
+            SHA2XX_ROUND(c, d, e, f, g, h, a, b, i + 6);
+            SHA2XX_ROUND(b, c, d, e, f, g, h, a, i + 7);
+        }
 
-    /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
+        /* 4. Mix local working variables into global state */
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+
+        blocks += 64;
     }
 }
+#endif /* __SHA__ */
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -191,15 +278,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    if (len >= 64) {
+        sha2xx_transform(ctx->state, src, len / 64);
+        src += len & ~(size_t)63;
+        len &= 63;
     }
 
     /* Copy left over data into buffer */
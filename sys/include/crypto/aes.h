@@ -61,12 +61,24 @@ struct aes_key_st {
 
 typedef struct aes_key_st AES_KEY;
 
+#define AES_ROUNDS        10    /**< number of rounds for AES_KEY_SIZE */
+
 /**
  * @brief the cipher_context_t-struct adapted for AES
+ *
+ * aes_init() expands the key schedules into the context once, so the
+ * encryption and decryption functions only run the cipher rounds.
  */
 typedef struct {
-    /** context data buffer */
-    uint32_t context[(4 * (AES_MAXNR + 1)) + 1];
+#if defined(MODULE_CRYPTO_AES_CT) || defined(DOXYGEN)
+    /** bitsliced round keys, used for both encryption and decryption */
+    uint32_t skey[8 * (AES_ROUNDS + 1)];
+#else
+    /** encryption key schedule */
+    uint32_t enc_key[4 * (AES_ROUNDS + 1)];
+    /** decryption key schedule */
+    uint32_t dec_key[4 * (AES_ROUNDS + 1)];
+#endif
 } aes_context_t;
 
 /**
@@ -100,8 +112,6 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
  *                            be stored
  *
  * @return  1 on success
- * @return  A negative value if the cipher key cannot be expanded with the
- *          AES key schedule
  */
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
@@ -120,12 +130,52 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
  *                            plaintext will be stored
  *
  * @return  1 on success
- * @return  A negative value if the cipher key cannot be expanded with the
- *          AES key schedule
  */
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts consecutive blocks of plaintext
+ *
+ * Like aes_encrypt(), but the function call overhead is paid only once for
+ * all blocks. The constant-time implementation (`crypto_aes_ct`) encrypts two
+ * blocks at once.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain_blocks  a pointer to the plaintext (of size
+ *                            blocks * blocksize)
+ * @param       cipher_blocks a pointer to the place where the ciphertext will
+ *                            be stored, may be the same as @p plain_blocks
+ * @param       blocks        the number of blocks to encrypt
+ *
+ * @return  1 on success
+ */
+int aes_encrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                       size_t blocks);
+
+/**
+ * @brief   decrypts consecutive blocks of ciphertext
+ *
+ * Like aes_decrypt(), but the function call overhead is paid only once for
+ * all blocks. The constant-time implementation (`crypto_aes_ct`) decrypts two
+ * blocks at once.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            decryption
+ * @param       cipher_blocks a pointer to the ciphertext (of size
+ *                            blocks * blocksize)
+ * @param       plain_blocks  a pointer to the place where the plaintext will
+ *                            be stored, may be the same as @p cipher_blocks
+ * @param       blocks        the number of blocks to decrypt
+ *
+ * @return  1 on success
+ */
+int aes_decrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *cipher_blocks, uint8_t *plain_blocks,
+                       size_t blocks);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -38,13 +39,13 @@ extern "C" {
  * Context sizes needed for the different ciphers.
  * Always order by number of bytes descending!!! <br><br>
  *
+ * aes          needs 352 bytes (the expanded key schedules) <br>
  * threedes     needs 24  bytes                           <br>
- * aes          needs CIPHERS_MAX_KEY_SIZE bytes          <br>
  */
-#if defined(MODULE_CRYPTO_3DES)
+#if defined(MODULE_CRYPTO_AES)
+    #define CIPHER_MAX_CONTEXT_SIZE 352
+#elif defined(MODULE_CRYPTO_3DES)
     #define CIPHER_MAX_CONTEXT_SIZE 24
-#elif defined(MODULE_CRYPTO_AES)
-    #define CIPHER_MAX_CONTEXT_SIZE CIPHERS_MAX_KEY_SIZE
 #else
 /* 0 is not a possibility because 0-sized arrays are not allowed in ISO C */
     #define CIPHER_MAX_CONTEXT_SIZE 1
@@ -65,7 +66,8 @@ extern "C" {
  * @brief   the context for cipher-operations
  */
 typedef struct {
-    uint8_t context[CIPHER_MAX_CONTEXT_SIZE];  /**< buffer for cipher operations */
+    /** buffer for cipher operations, aligned for the AES key schedules */
+    uint8_t context[CIPHER_MAX_CONTEXT_SIZE] __attribute__((aligned(4)));
 } cipher_context_t;
 
 
@@ -89,6 +91,16 @@ typedef struct cipher_interface_st {
     /** the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /** encrypts consecutive blocks, NULL if not supported by the cipher */
+    int (*encrypt_blocks)(const cipher_context_t *ctx,
+                          const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                          size_t blocks);
+
+    /** decrypts consecutive blocks, NULL if not supported by the cipher */
+    int (*decrypt_blocks)(const cipher_context_t *ctx,
+                          const uint8_t *cipher_blocks, uint8_t *plain_blocks,
+                          size_t blocks);
 } cipher_interface_t;
 
 
@@ -162,6 +174,48 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt consecutive blocks of data
+ *
+ * Equivalent to calling cipher_encrypt() for each block, but ciphers with
+ * an expensive setup per call (like the AES key schedule) only do it once.
+ * Modes of operation should use this whenever several blocks can be
+ * processed independently.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt, of size
+ *                   blocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for encrypted data, of size
+ *                   blocks * BLOCK_SIZE. May be the same as @p input.
+ * @param blocks     number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+
+/**
+ * @brief Decrypt consecutive blocks of data
+ *
+ * Equivalent to calling cipher_decrypt() for each block, see
+ * cipher_encrypt_blocks().
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to decrypt, of size
+ *                   blocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for decrypted data, of size
+ *                   blocks * BLOCK_SIZE. May be the same as @p input.
+ * @param blocks     number of blocks to decrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+
 /**
  * @brief Get block size of cipher
  * *
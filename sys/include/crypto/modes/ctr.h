@@ -26,6 +26,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of key stream blocks computed with a single call of the
+ *          cipher
+ *
+ * The key stream is kept on the stack, so this costs
+ * CIPHER_CTR_STREAM_BLOCKS * CIPHER_MAX_BLOCK_SIZE bytes of stack.
+ */
+#ifndef CIPHER_CTR_STREAM_BLOCKS
+#define CIPHER_CTR_STREAM_BLOCKS    (4U)
+#endif
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
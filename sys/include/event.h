@@ -47,6 +47,15 @@
  * to be queued. Thus event queues can be used safely and efficiently in combination
  * with thread flags and msg queues.
  *
+ * By default, event_post() disables interrupts while adding the event to the
+ * queue. When many ISRs post to the same queue at a high rate, this adds to
+ * the interrupt latency. With the `event_mpsc` module, events are instead
+ * posted to a lock-free multi-producer single-consumer stack, from which the
+ * owning thread moves them to the queue in FIFO order. This requires lock-free
+ * atomic pointer operations; on CPUs without them (e.g. Cortex-M0), the
+ * module has no effect. With `event_mpsc`, event_cancel() does not remove an
+ * event that is being posted concurrently from a context it has preempted.
+ *
  * Examples:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -150,6 +159,10 @@ struct event {
 typedef struct {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread ownning event queue         */
+#if defined(MODULE_EVENT_MPSC) || defined(DOXYGEN)
+    clist_node_t *pending;      /**< events posted but not yet in
+                                     event_list, newest first           */
+#endif
 } event_queue_t;
 
 
@@ -253,6 +266,11 @@ static inline void event_queue_claim(event_queue_t *queue)
  * in the previous position on the queue. So reposting an event while it is
  * already on the queue will have no effect.
  *
+ * The owner of @p queue is only woken up with @ref THREAD_FLAG_EVENT when the
+ * queue was empty before. A thread that waits for the flag itself instead of
+ * using event_wait() must thus call event_get() until the queue is empty
+ * before it waits again.
+ *
  * @param[in]   queue   event queue to queue event in
  * @param[in]   event   event to queue in event queue
  */
@@ -34,6 +34,16 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The block compression function is selected at build time. When the
+ * compiler targets a x86 CPU with the SHA extensions, e.g. on `native` with
+ *
+ *     CFLAGS += -msha -msse4.1
+ *
+ * the SHA instructions of the CPU are used. Otherwise, a portable C
+ * implementation is used. The resulting binary only runs on CPUs that
+ * support the selected instructions.
+ *
  * @{
  *
  * @file
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_frag_ints    Fragment intervals
+ * @ingroup     net
+ * @brief   Bookkeeping of the byte intervals received for a datagram under
+ *          reassembly
+ *
+ * The intervals of a datagram are kept in a small array, sorted by their
+ * start and merged with adjacent intervals, so an array entry is only needed
+ * for every gap in the received data rather than for every fragment. Adding a
+ * fragment finds its neighbors with a binary search, and a datagram is
+ * complete when exactly one interval covering the whole datagram is left.
+ *
+ * As adjacent intervals are merged, the limits of the individual fragments
+ * are not kept: a fragment fully within the data already received is always
+ * considered a duplicate, even if it was not received with the same limits
+ * before.
+ *
+ * Reassembly that must tell an exact duplicate from an overlapping fragment,
+ * like IPv6 reassembly following [RFC 5722], initializes the intervals with
+ * @ref frag_ints_init_exact() instead. Intervals are then never merged and
+ * every fragment takes an array entry of its own.
+ *
+ * [RFC 5722]: https://tools.ietf.org/html/rfc5722
+ *
+ * Used by both the [6LoWPAN reassembly buffer](@ref net_gnrc_sixlowpan_frag_rb)
+ * and [IPv6 reassembly](@ref net_gnrc_ipv6_ext_frag).
+ * @{
+ *
+ * @file
+ * @brief   Fragment interval definitions
+ */
+#ifndef NET_FRAG_INTS_H
+#define NET_FRAG_INTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_frag_ints_conf Fragment intervals compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum number of disjoint intervals per datagram
+ *
+ * A datagram can be reassembled with up to `CONFIG_FRAG_INTS_NUMOF - 1`
+ * gaps in the data received at any time. With @ref frag_ints_init_exact(),
+ * this is the maximum number of fragments per datagram.
+ *
+ * @note    Every reassembly buffer entry holds a @ref frag_ints_t, i.e.
+ *          `4 * CONFIG_FRAG_INTS_NUMOF + 4` bytes (36 bytes by default).
+ *          This also applies to each entry of the
+ *          [virtual reassembly buffer](@ref net_gnrc_sixlowpan_frag_vrb), so
+ *          the intervals of its 16 entries in the default configuration take
+ *          576 bytes.
+ */
+#ifndef CONFIG_FRAG_INTS_NUMOF
+#define CONFIG_FRAG_INTS_NUMOF      (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   A byte interval of a datagram
+ */
+typedef struct {
+    uint16_t start;     /**< first byte of the interval */
+    uint16_t end;       /**< first byte after the interval */
+} frag_ints_int_t;
+
+/**
+ * @brief   The intervals received of a datagram
+ */
+typedef struct {
+    /**
+     * @brief   Disjoint and non-adjacent intervals, sorted by their start
+     */
+    frag_ints_int_t ints[CONFIG_FRAG_INTS_NUMOF];
+    uint16_t frags;     /**< number of fragments added so far */
+    uint8_t numof;      /**< number of intervals in frag_ints_t::ints */
+    bool exact;         /**< intervals are kept with the fragment limits */
+} frag_ints_t;
+
+/**
+ * @brief   Initializes (or empties) the intervals of a datagram
+ *
+ * @param[out] ints The intervals of a datagram. Must not be NULL.
+ */
+static inline void frag_ints_init(frag_ints_t *ints)
+{
+    ints->numof = 0;
+    ints->frags = 0;
+    ints->exact = false;
+}
+
+/**
+ * @brief   Initializes (or empties) the intervals of a datagram, keeping the
+ *          limits of every fragment
+ *
+ * Adjacent intervals are not merged, so only a fragment with exactly the
+ * limits of a fragment added before is considered a duplicate by
+ * @ref frag_ints_add().
+ *
+ * @param[out] ints The intervals of a datagram. Must not be NULL.
+ */
+static inline void frag_ints_init_exact(frag_ints_t *ints)
+{
+    ints->numof = 0;
+    ints->frags = 0;
+    ints->exact = true;
+}
+
+/**
+ * @brief   Adds the interval of a fragment to the intervals of a datagram
+ *
+ * @param[in,out] ints  The intervals of a datagram. Must not be NULL.
+ * @param[in] start     First byte of the fragment in the datagram.
+ * @param[in] end       First byte after the fragment in the datagram.
+ *
+ * @return  0, if the interval was added.
+ * @return  -EEXIST, if the interval was already received completely (this
+ *          includes empty intervals). With @ref frag_ints_init_exact(), only
+ *          if an interval with the same limits was added before.
+ *          @p ints is not changed.
+ * @return  -EINVAL, if the interval overlaps partially with data already
+ *          received or if @p start > @p end. With
+ *          @ref frag_ints_init_exact(), also if it overlaps in any other way
+ *          with data already received or if @p start == @p end.
+ *          @p ints is not changed.
+ * @return  -ENOBUFS, if the interval would create more than
+ *          @ref CONFIG_FRAG_INTS_NUMOF intervals. @p ints is not changed.
+ */
+int frag_ints_add(frag_ints_t *ints, uint16_t start, uint16_t end);
+
+/**
+ * @brief   Checks if all bytes of a datagram were received
+ *
+ * @param[in] ints  The intervals of a datagram. Must not be NULL.
+ * @param[in] size  Size of the datagram.
+ *
+ * @return  true, if the intervals in @p ints cover [0, @p size) without gaps.
+ * @return  false, otherwise.
+ */
+bool frag_ints_complete(const frag_ints_t *ints, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_FRAG_INTS_H */
+/** @} */
@@ -100,6 +100,17 @@
  * add parameters to provide more information about the resource, as described
  * in RFC 6690. See the gcoap example for use of a custom encoder function.
  *
+ * ### Resource lookup ###
+ *
+ * By default gcoap compares the path of a request with every resource of every
+ * listener. For servers with many resources, the `gcoap_index` module finds
+ * the matching resources of a listener with a binary search instead. This
+ * relies on the alphabetical order of the resources, which is checked by
+ * gcoap_register_listener(). Listeners with unordered resources or with a
+ * custom gcoap_listener_t::request_matcher are still searched linearly. The
+ * module also keeps the observe registrations ordered by resource and the
+ * observers ordered by endpoint, so these are found with a binary search, too.
+ *
  * ## Client Operation ##
  *
  * Client operation includes two phases: creating and sending a request, and
@@ -154,7 +165,8 @@
  * A CoAP client may register for Observe notifications for any resource that
  * an application has registered with gcoap. An application does not need to
  * take any action to support Observe client registration. However, gcoap
- * limits registration for a given resource to a _single_ observer.
+ * limits registration for a given resource to a _single_ observer, unless the
+ * `gcoap_obs_fanout` module is used (see "Notifying many observers" below).
  *
  * It is [suggested](https://tools.ietf.org/html/rfc7641#section-6) that a
  * server adds the 'obs' attribute to resources that are useful for observation
@@ -190,6 +202,28 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Notifying many observers ###
+ *
+ * With the `gcoap_obs_fanout` module, any number of endpoints may observe a
+ * resource, limited only by CONFIG_GCOAP_OBS_CLIENTS_MAX and
+ * CONFIG_GCOAP_OBS_REGISTRATIONS_MAX. A notification for all of them is
+ * created once: follow the steps above, but call gcoap_obs_fanout_init()
+ * instead of gcoap_obs_init() and gcoap_obs_fanout_send() instead of
+ * gcoap_obs_send(). gcoap then only sets the token and the message ID for
+ * each observer.
+ *
+ * gcoap_obs_fanout_send() also limits the rate of notifications for a resource
+ * to one per CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS. A notification sent faster
+ * than that is held back until the end of the interval, and replaced by any
+ * newer notification sent in the meantime. So observers always receive the
+ * latest representation, but not every intermediate one. The held back
+ * notifications are stored in a pool of CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX
+ * buffers, shared by all resources. A resource takes a buffer when its
+ * interval starts and returns it when an interval ends without a held back
+ * notification, or once its last observer is gone. If the pool is exhausted,
+ * gcoap_obs_fanout_send() fails with -ENOMEM and the notification is not
+ * sent.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -510,6 +544,24 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Minimum interval between notifications for a resource in
+ *          milliseconds, see gcoap_obs_fanout_send()
+ */
+#ifndef CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS
+#define CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS    (1000U)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of resources with a rate limited notification,
+ *          see gcoap_obs_fanout_send()
+ */
+#ifndef CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX
+#define CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX    (2)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -872,6 +924,50 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+/**
+ * @brief   Initializes a CoAP Observe notification packet on a buffer, for
+ *          all observers registered for a resource
+ *
+ * Same as gcoap_obs_init(), but leaves room for the longest token in the
+ * header. The notification must be sent with gcoap_obs_fanout_send().
+ *
+ * @note    Only available with the `gcoap_obs_fanout` module.
+ *
+ * @param[out] pdu      Notification metadata
+ * @param[out] buf      Buffer containing the PDU
+ * @param[in] len       Length of the buffer
+ * @param[in] resource  Resource for the notification
+ *
+ * @return  GCOAP_OBS_INIT_OK     on success
+ * @return  GCOAP_OBS_INIT_ERR    on error
+ * @return  GCOAP_OBS_INIT_UNUSED if no observer for resource
+ */
+int gcoap_obs_fanout_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                          const coap_resource_t *resource);
+
+/**
+ * @brief   Sends a buffer containing a CoAP Observe notification to all
+ *          observers registered for a resource
+ *
+ * Only the token and the message ID in @p buf are changed for each observer.
+ * If the last notification for @p resource was sent less than
+ * CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS ago, the notification is copied and
+ * sent at the end of the interval, unless a newer one replaces it.
+ *
+ * @note    Only available with the `gcoap_obs_fanout` module.
+ *
+ * @param[in] buf       Buffer containing the PDU, initialized with
+ *                      gcoap_obs_fanout_init(). Modified by the function.
+ * @param[in] len       Length of the PDU
+ * @param[in] resource  Resource to send
+ *
+ * @return  number of observers the notification was sent to
+ * @return  0 if the notification is held back or cannot be sent
+ * @return  -ENOMEM if no buffer is left to rate limit @p resource
+ */
+ssize_t gcoap_obs_fanout_send(uint8_t *buf, size_t len,
+                              const coap_resource_t *resource);
+
 /**
  * @brief   Provides important operational statistics
  *
@@ -67,18 +67,6 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE        (1U)
 #endif
 
-/**
- * @brief   The number of total allocatable @ref gnrc_ipv6_ext_frag_limits_t objects
- *
- * This is the maximum number of receivable fragments, shared between all
- * fragmented datagrams
- *
- * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
- */
-#ifndef CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE
-#define CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE (CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE * 2U)
-#endif
-
 /**
  * @brief   Timeout for IPv6 fragmentation reassembly buffer entries in microseconds
  *
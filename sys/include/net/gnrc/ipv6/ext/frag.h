@@ -23,7 +23,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "clist.h"
+#include "net/frag_ints.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/ipv6/hdr.h"
@@ -52,17 +52,6 @@ extern "C" {
  */
 #define GNRC_IPV6_EXT_FRAG_SEND         (0xfe02U)
 
-/**
- * @brief   Data type to describe limits of a single fragment in the reassembly
- *          buffer
- */
-typedef struct gnrc_ipv6_ext_frag_limits {
-    struct gnrc_ipv6_ext_frag_limits *next; /**< limits of next fragment */
-    uint16_t start;                         /**< the start (= offset) of the fragment */
-    uint16_t end;                           /**< the exclusive end (= offset + length) of the
-                                             *   fragment */
-} gnrc_ipv6_ext_frag_limits_t;
-
 /**
  * @brief   Fragmentation send buffer type
  */
@@ -83,10 +72,8 @@ typedef struct {
     ipv6_hdr_t *ipv6;       /**< the IPv6 header of gnrc_ipv6_ext_frag_rbuf_t::pkt */
     /**
      * @brief   The limits of the fragments in the reassembled packet
-     *
-     * @note    Members of this list can be cast to gnrc_ipv6_ext_frag_limits_t.
      */
-    clist_node_t limits;
+    frag_ints_t limits;
     uint32_t id;            /**< the identification from the fragment headers */
     uint32_t arrival;       /**< arrival time of last received fragment */
     uint16_t pkt_len;       /**< length of gnrc_ipv6_ext_frag_rbuf_t::pkt */
@@ -214,6 +214,33 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Index off-link entries in a path-compressed binary trie
+ *
+ * With this, the longest-prefix match for a destination (i.e. the
+ * forwarding table lookup for every forwarded packet) only walks the bits of
+ * the destination address instead of comparing it with every off-link entry.
+ * This is useful for routers with a large
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of about
+ * 2 * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF trie nodes of RAM.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
+
+/**
+ * @brief   Index on-link entries in a hash table by their IPv6 address
+ *
+ * With this, getting the neighbor cache entry for a destination (i.e. the
+ * address resolution for every transmitted unicast packet) does not need to
+ * compare the address with every on-link entry. This is useful for routers
+ * with a large @ref CONFIG_GNRC_IPV6_NIB_NUMOF, at the cost of
+ * 2 * @ref CONFIG_GNRC_IPV6_NIB_NUMOF hash table slots of RAM.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH                 0
+#endif
 /** @} */
 
 /**
@@ -309,6 +309,32 @@ bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
  */
 void gnrc_ipv6_nib_nc_print(gnrc_ipv6_nib_nc_t *nce);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of the on-link entry hash table
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t probes;        /**< occupied slots compared over all lookups */
+    uint16_t max_probes;    /**< most occupied slots compared in one lookup */
+    uint16_t used;          /**< currently occupied slots */
+} gnrc_ipv6_nib_nc_hash_stats_t;
+
+/**
+ * @brief   Gets the statistics of the on-link entry hash table
+ *
+ * @pre `stats != NULL`
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ *
+ * @param[out] stats    The statistics.
+ */
+void gnrc_ipv6_nib_nc_get_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 #ifdef __cplusplus
 }
 #endif
@@ -93,6 +93,20 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of received
+ *          @ref net_gnrc_pkt up the network stack
+ *
+ * `content.ptr` points to the first packet of the batch. The following packets
+ * are retrieved using gnrc_netif_hdr_rx_batch_next(). The receiver holds one
+ * reference to each packet of the batch.
+ *
+ * Only sent to subscribers registered with @ref GNRC_NETREG_TYPE_RX_BATCH.
+ *
+ * @note    Only available with `gnrc_netif_rx_batch`.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0206)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -185,6 +199,49 @@ static inline int gnrc_netapi_dispatch_send(gnrc_nettype_t type, uint32_t demux_
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_SND, pkt);
 }
 
+/**
+ * @brief   Sends @p cmd for each of @p num packets to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Equivalent to calling @ref gnrc_netapi_dispatch() for each packet in
+ * @p pkts, but subscribers of type @ref GNRC_NETREG_TYPE_DEFAULT get all
+ * packets with @ref msg_send_many(), i.e. within a single critical section
+ * and with at most one wake-up of the subscriber's thread.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] cmd       command for all subscribers
+ * @param[in] pkts      array of @p num pointers into the packet buffer
+ * @param[in] num       number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_many(gnrc_nettype_t type, uint32_t demux_ctx,
+                              uint16_t cmd, gnrc_pktsnip_t **pkts,
+                              unsigned num);
+
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_SND command for each of @p num
+ *          packets to all subscribers to (@p type, @p demux_ctx).
+ *
+ * @see     gnrc_netapi_dispatch_many()
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      array of @p num pointers into the packet buffer
+ * @param[in] num       number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+static inline int gnrc_netapi_dispatch_send_many(gnrc_nettype_t type,
+                                                 uint32_t demux_ctx,
+                                                 gnrc_pktsnip_t **pkts,
+                                                 unsigned num)
+{
+    return gnrc_netapi_dispatch_many(type, demux_ctx,
+                                     GNRC_NETAPI_MSG_TYPE_SND, pkts, num);
+}
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_RCV messages
  *
@@ -215,6 +272,31 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+#if defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Sends a batch of received packets to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Subscribers registered with @ref GNRC_NETREG_TYPE_RX_BATCH get the whole
+ * batch in a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message, all other
+ * subscribers get one @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      first packet of a batch linked by the
+ *                      gnrc_netif_hdr_t::rx_batch_next field of the packets'
+ *                      network interface headers
+ *
+ * @note    The reference of the caller to the packets in @p pkts is always
+ *          consumed, packets no one is interested in are released.
+ * @note    Only available with `gnrc_netif_rx_batch`.
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkts);
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
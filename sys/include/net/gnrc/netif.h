@@ -68,6 +68,9 @@
 #ifdef MODULE_NETSTATS_L2
 #include "net/netstats.h"
 #endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+#include "net/netstats/neighbor.h"
+#endif
 #include "rmutex.h"
 #include "net/netif.h"
 
@@ -120,6 +123,9 @@ typedef struct {
 #ifdef MODULE_NETSTATS_L2
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR) || defined(DOXYGEN)
+    netstats_nb_table_t neighbors;          /**< per neighbor link statistics */
+#endif
 #if IS_USED(MODULE_GNRC_NETIF_LORAWAN) || defined(DOXYGEN)
     gnrc_netif_lorawan_t lorawan;           /**< LoRaWAN component */
 #endif
@@ -182,6 +188,35 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not yet passed up the network stack
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    gnrc_pktsnip_t *rx_batch;
+    /**
+     * @brief   Network interface header of the last packet in
+     *          gnrc_netif_t::rx_batch
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    gnrc_pktsnip_t *rx_batch_last;
+    /**
+     * @brief   Number of packets in gnrc_netif_t::rx_batch
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    uint8_t rx_batch_len;
+    /**
+     * @brief   True while the ISR handler of the device runs
+     *
+     * Packets received outside of the ISR handler are passed up right away.
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    bool rx_batch_isr;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -78,6 +78,20 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Maximum number of received packets passed up the network stack
+ *              in one batch
+ *
+ * Packets received while handling a single device interrupt are collected and
+ * dispatched with @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH, so the network layer is
+ * woken up once per batch instead of once per packet.
+ *
+ * @note        Only used with the `gnrc_netif_rx_batch` module.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_BATCH_SIZE
+#define CONFIG_GNRC_NETIF_RX_BATCH_SIZE       (8U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -105,6 +105,16 @@ typedef struct {
     uint8_t flags;              /**< flags as defined above */
     uint8_t lqi;                /**< lqi of received packet (optional) */
     int16_t rssi;               /**< rssi of received packet in dBm (optional) */
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Next packet of a received batch
+     *
+     * @see     @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+     *
+     * @note    Only available with `gnrc_netif_rx_batch`.
+     */
+    gnrc_pktsnip_t *rx_batch_next;
+#endif
 } gnrc_netif_hdr_t;
 
 /**
@@ -123,6 +133,9 @@ static inline void gnrc_netif_hdr_init(gnrc_netif_hdr_t *hdr, uint8_t src_l2addr
     hdr->rssi = 0;
     hdr->lqi = 0;
     hdr->flags = 0;
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    hdr->rx_batch_next = NULL;
+#endif
 }
 
 /**
@@ -307,6 +320,28 @@ static inline void gnrc_netif_hdr_set_netif(gnrc_netif_hdr_t *hdr,
     hdr->if_pid = (netif != NULL) ? netif->pid : KERNEL_PID_UNDEF;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Get the packet following @p pkt in a received batch
+ *
+ * @see     @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *
+ * @param[in] pkt   A packet of a received batch.
+ *
+ * @note    Only available with `gnrc_netif_rx_batch`.
+ *
+ * @return  The next packet of the batch.
+ * @return  NULL, if @p pkt is the last packet of the batch.
+ */
+static inline gnrc_pktsnip_t *gnrc_netif_hdr_rx_batch_next(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+
+    return (netif != NULL) ? ((gnrc_netif_hdr_t *)netif->data)->rx_batch_next
+                           : NULL;
+}
+#endif
+
 /**
  * @brief   Outputs a generic interface header to stdout.
  *
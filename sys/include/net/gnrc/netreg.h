@@ -36,7 +36,7 @@ extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -69,6 +69,17 @@ typedef enum {
      */
     GNRC_NETREG_TYPE_CB,
 #endif
+#if defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Use [default IPC](@ref core_msg) for
+     *          [netapi](@ref net_gnrc_netapi) operations, but receive
+     *          packets from network interfaces in batches via
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH.
+     *
+     * @note    Only available with `gnrc_netif_rx_batch` module.
+     */
+    GNRC_NETREG_TYPE_RX_BATCH,
+#endif
 } gnrc_netreg_type_t;
 #endif
 
@@ -93,7 +104,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETIF_RX_BATCH)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -181,12 +193,12 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks, or `gnrc_netif_rx_batch`.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -237,12 +249,36 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETIF_RX_BATCH)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
 }
 
+#if defined(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with PID for a thread that
+ *          accepts @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with `gnrc_netif_rx_batch`.
+ */
+static inline void gnrc_netreg_entry_init_rx_batch(gnrc_netreg_entry_t *entry,
+                                                   uint32_t demux_ctx,
+                                                   kernel_pid_t pid)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_RX_BATCH;
+    entry->target.pid = pid;
+}
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry dynamically with mbox
@@ -35,6 +35,7 @@
 #include <string.h>
 
 #include "cpu_conf.h"
+#include "kernel_defines.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/neterr.h"
 #include "net/gnrc/nettype.h"
@@ -62,6 +63,62 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Slot size of the smallest pool of `gnrc_pktbuf_slab`.
+ *
+ * @details This pool holds the @ref gnrc_pktsnip_t descriptors and small
+ *          protocol headers, so it must be at least
+ *          `sizeof(gnrc_pktsnip_t)`.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE        (48)
+#endif
+
+/**
+ * @brief   Number of slots in the smallest pool of `gnrc_pktbuf_slab`.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF       (32)
+#endif
+
+/**
+ * @brief   Slot size of the link-layer frame pool of `gnrc_pktbuf_slab`.
+ *
+ * @details The default fits a full IEEE 802.15.4 frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE      (128)
+#endif
+
+/**
+ * @brief   Number of slots in the link-layer frame pool of `gnrc_pktbuf_slab`.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF     (12)
+#endif
+
+/**
+ * @brief   Slot size of the full-MTU pool of `gnrc_pktbuf_slab`.
+ *
+ * @details This is the largest chunk `gnrc_pktbuf_slab` is able to allocate.
+ *          The default fits an IPv6 minimum MTU sized packet or, if an
+ *          Ethernet device is compiled in, a full Ethernet frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE
+#if IS_USED(MODULE_NETDEV_ETH)
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE        (1536)
+#else
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE        (1280)
+#endif
+#endif
+
+/**
+ * @brief   Number of slots in the full-MTU pool of `gnrc_pktbuf_slab`.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF       (3)
+#endif
 /** @} */
 
 /**
@@ -108,7 +108,9 @@
  * ------
  *
  * The GNRC RPL implementation only implements storing mode
- * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)).
+ * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)) and, with the
+ * [@c gnrc_rpl_mrhof](@ref net_gnrc_rpl_mrhof) module, MRHOF
+ * ([RFC6719](https://tools.ietf.org/html/rfc6719)) using the ETX metric.
  * The RPL routing header is parsed by the nodes when the [@c gnrc_rpl_srh](@ref net_gnrc_rpl_srh)
  * module is used, but anything else
  * for non-storing mode is missing.
@@ -116,12 +118,10 @@
  *
  * - IPv6 Hop-by-hop RPL option
  *   (see [#7231](https://github.com/RIOT-OS/RIOT/pull/7231#issuecomment-651237343))
- * - Metric based routing ([RFC6551](https://tools.ietf.org/html/rfc6551)
- *   and [RFC6719](https://tools.ietf.org/html/rfc6719))
- *   (see [14448](https://github.com/RIOT-OS/RIOT/pull/14448) and
- *   [#14623](https://github.com/RIOT-OS/RIOT/pull/14623))
+ * - Metrics other than ETX ([RFC6551](https://tools.ietf.org/html/rfc6551))
  * - Non-Storing mode
- * - DAG-Metric Container ([RFC6550#6.7.4](https://tools.ietf.org/html/rfc6550#section-6.7.4)
+ * - DAG-Metric Container objects other than ETX
+ *   ([RFC6550#6.7.4](https://tools.ietf.org/html/rfc6550#section-6.7.4)
  *   and [RFC6551](https://tools.ietf.org/html/rfc6551))
  *
  * @{
@@ -249,12 +249,31 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
+#ifdef MODULE_GNRC_RPL_MRHOF
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (2)
+#else
 #define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Default Objective Code Point
+ *
+ * OF0 (0), or MRHOF (1) when the [@c gnrc_rpl_mrhof](@ref net_gnrc_rpl_mrhof)
+ * module is used. A node joining a DODAG uses the objective function the root
+ * announces in its DODAG Configuration option.
  */
-#define GNRC_RPL_DEFAULT_OCP (0)
+#ifndef CONFIG_GNRC_RPL_DEFAULT_OCP
+#ifdef MODULE_GNRC_RPL_MRHOF
+#define CONFIG_GNRC_RPL_DEFAULT_OCP (1)
+#else
+#define CONFIG_GNRC_RPL_DEFAULT_OCP (0)
+#endif
+#endif
+
+/**
+ * @brief   Default Objective Code Point, see @ref CONFIG_GNRC_RPL_DEFAULT_OCP
+ */
+#define GNRC_RPL_DEFAULT_OCP (CONFIG_GNRC_RPL_DEFAULT_OCP)
 
 /**
  * @brief   Default Instance ID
@@ -416,6 +435,36 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
  */
 #define CONFIG_GNRC_RPL_DAO_DELAY_JITTER   (1000UL)
 #endif
+#ifndef CONFIG_GNRC_RPL_DAO_COALESCE_DELAY
+/**
+ * @brief Delay for DAOs triggered by a DAO of a child in milli seconds
+ *
+ * DAOs of further children received within this delay are announced in the
+ * same DAO. The pending DAO-ACKs to the children are sent when this delay
+ * expires.
+ */
+#define CONFIG_GNRC_RPL_DAO_COALESCE_DELAY (500UL)
+#endif
+#ifndef CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF
+/**
+ * @brief Maximum number of children with a pending DAO-ACK
+ *
+ * A DAO-ACK is sent immediately if no slot is left for it.
+ */
+#define CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF  (4)
+#endif
+#ifndef CONFIG_GNRC_RPL_ROUTE_AGGREGATION_MIN_PREFIX_LEN
+/**
+ * @brief Shortest prefix routes to DAO targets are aggregated to
+ *
+ * Two routes via the same child to both halves of a prefix are replaced by
+ * a route to the prefix, which is lossless since their union is exactly the
+ * prefix. The default keeps aggregated routes within the interface
+ * identifiers, so they never replace a route to a /64 prefix. Set to 128 to
+ * disable the aggregation.
+ */
+#define CONFIG_GNRC_RPL_ROUTE_AGGREGATION_MIN_PREFIX_LEN   (96U)
+#endif
 /** @} */
 
 /**
@@ -454,6 +503,16 @@ static inline bool GNRC_RPL_COUNTER_GREATER_THAN(uint8_t A, uint8_t B)
 #define GNRC_RPL_OPT_TARGET_DESC          (9)
 /** @} */
 
+/**
+ * @name DAG Metric Container object types
+ *  @see <a href="https://tools.ietf.org/html/rfc6551#section-6.1">
+ *          Routing Metric/Constraint Type
+ *      </a>
+ * @{
+ */
+#define GNRC_RPL_MC_ETX                   (7)
+/** @} */
+
 /**
  * @brief Rank of the root node
  */
@@ -624,6 +683,13 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *instance, ipv6_addr_t *destination,
  */
 void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *instance, ipv6_addr_t *destination, uint8_t seq);
 
+/**
+ * @brief   Send the pending DAO-ACKs of the @p instance.
+ *
+ * @param[in] instance          Pointer to the RPL instance.
+ */
+void gnrc_rpl_send_pending_DAO_ACKs(gnrc_rpl_instance_t *instance);
+
 /**
  * @brief   Parse a DIS.
  *
@@ -679,6 +745,17 @@ void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6
  */
 void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag);
 
+/**
+ * @brief   Schedule a DAO in reaction to a DAO of a child
+ *
+ * Other than @ref gnrc_rpl_delay_dao(), this does not postpone a DAO that was
+ * already scheduled by this function, so the DAOs of several children are
+ * announced with a single DAO.
+ *
+ * @param[in] dodag     The DODAG of the DAO
+ */
+void gnrc_rpl_coalesce_dao(gnrc_rpl_dodag_t *dodag);
+
 /**
  * @brief   Long delay the DAO sending interval
  *
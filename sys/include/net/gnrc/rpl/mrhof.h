@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_rpl_mrhof RPL Minimum Rank with Hysteresis Objective Function
+ * @ingroup     net_gnrc_rpl
+ * @brief       Implementation of MRHOF using the ETX metric
+ * @see <a href="https://tools.ietf.org/html/rfc6719">
+ *          RFC 6719
+ *      </a>
+ *
+ * The ETX of the link to a parent is taken from the
+ * [per neighbor link statistics](@ref net_netstats_neighbor) of the interface
+ * the DODAG runs on, i.e. it is estimated from the number of retransmissions
+ * and missing acknowledgements the device reports for the frames sent to the
+ * parent. Until the first frame to a parent was sent,
+ * @ref CONFIG_NETSTATS_NB_ETX_INIT is assumed.
+ *
+ * The path cost via a parent is the ETX the parent advertises in the DAG
+ * Metric Container of its DIOs, or its rank if it advertises none, plus the
+ * ETX of the link to the parent. The preferred parent is only replaced when
+ * the path cost via another parent is lower by more than
+ * @ref CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD.
+ *
+ * This node advertises its own path cost in a DAG Metric Container in its
+ * DIOs unless @ref CONFIG_GNRC_RPL_MRHOF_WITHOUT_MC is set.
+ *
+ * @note    Deviating from RFC 6719, section 3.2.2, parents with a link metric
+ *          above @ref CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC are not excluded
+ *          from the parent set, but only preferred over no other parent, so a
+ *          node with only bad links does not lose its connection to the DODAG.
+ *
+ * @{
+ *
+ * @file
+ * @brief       MRHOF definitions
+ */
+#ifndef NET_GNRC_RPL_MRHOF_H
+#define NET_GNRC_RPL_MRHOF_H
+
+#include <stdint.h>
+
+#include "net/gnrc/rpl/structs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_rpl_mrhof_conf MRHOF compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Minimum difference in path cost to switch the preferred parent
+ *          in units of 1/128 ETX
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5 (PARENT_SWITCH_THRESHOLD)
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD   (192U)
+#endif
+
+/**
+ * @brief   Maximum link metric of a parent in units of 1/128 ETX
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5 (MAX_LINK_METRIC)
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC           (512U)
+#endif
+
+/**
+ * @brief   Do not advertise the path cost in a DAG Metric Container
+ *
+ * Other nodes then use the rank of this node as path cost.
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_RPL_MRHOF_WITHOUT_MC
+#endif
+/** @} */
+
+/**
+ * @brief   Objective Code Point of MRHOF
+ */
+#define GNRC_RPL_MRHOF_OCP          (1)
+
+/**
+ * @brief   Return the address of the MRHOF objective function
+ *
+ * @return  Address of the MRHOF objective function
+ */
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void);
+
+/**
+ * @brief   Get the ETX of the link to a parent
+ *
+ * @param[in] parent    A parent. Must not be NULL.
+ *
+ * @return  The ETX of the link to @p parent in units of 1/128.
+ */
+uint16_t gnrc_rpl_mrhof_link_metric(const gnrc_rpl_parent_t *parent);
+
+/**
+ * @brief   Get the path cost via a parent
+ *
+ * @param[in] parent    A parent. Must not be NULL.
+ *
+ * @return  The ETX of the path to the root via @p parent in units of 1/128.
+ */
+uint16_t gnrc_rpl_mrhof_path_cost(const gnrc_rpl_parent_t *parent);
+
+/**
+ * @brief   Get the path cost of this node to advertise in its DIOs
+ *
+ * @param[in] dodag     A DODAG. Must not be NULL.
+ *
+ * @return  0, if this node is the root of @p dodag.
+ * @return  The path cost via the preferred parent, otherwise.
+ */
+uint16_t gnrc_rpl_mrhof_dodag_path_cost(const gnrc_rpl_dodag_t *dodag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_RPL_MRHOF_H */
+/** @} */
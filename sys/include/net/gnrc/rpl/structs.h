@@ -28,6 +28,8 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
+
 #include "byteorder.h"
 #include "net/ipv6/addr.h"
 #include "evtimer.h"
@@ -42,6 +44,7 @@ extern "C" {
 #define GNRC_RPL_OPT_PREFIX_INFO_LEN        (30)
 #define GNRC_RPL_OPT_TARGET_LEN             (18)
 #define GNRC_RPL_OPT_TRANSIT_INFO_LEN       (4)
+#define GNRC_RPL_OPT_MC_ETX_LEN             (6)
 /** @} */
 
 /**
@@ -219,6 +222,31 @@ typedef struct __attribute__((packed)) {
                                          *   Autoconfiguration */
 } gnrc_rpl_opt_prefix_info_t;
 
+/**
+ * @brief DAG Metric Container object header
+ * @see <a href="https://tools.ietf.org/html/rfc6551#section-2.1">
+ *          RFC6551, section 2.1, DAG Metric Container
+ *      </a>
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;               /**< Routing-MC-Type */
+    network_uint16_t flags;     /**< P, C, O, R flags, A and Prec fields */
+    uint8_t length;             /**< length of the object body */
+} gnrc_rpl_mc_obj_t;
+
+/**
+ * @brief DAG Metric Container option carrying an ETX object
+ * @see <a href="https://tools.ietf.org/html/rfc6551#section-4.3.2">
+ *          RFC6551, section 4.3.2, Link ETX Reliability Object
+ *      </a>
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t type;               /**< option type */
+    uint8_t length;             /**< option length without the first two bytes */
+    gnrc_rpl_mc_obj_t obj;      /**< object header */
+    network_uint16_t etx;       /**< ETX in units of 1/128 */
+} gnrc_rpl_opt_mc_etx_t;
+
 /**
  * @brief DODAG representation
  */
@@ -243,8 +271,12 @@ struct gnrc_rpl_parent {
     uint8_t dtsn;                   /**< last seen dtsn of this parent */
     uint16_t rank;                  /**< rank of the parent */
     gnrc_rpl_dodag_t *dodag;        /**< DODAG the parent belongs to */
-    double link_metric;             /**< metric of the link */
-    uint8_t link_metric_type;       /**< type of the metric */
+    uint16_t metric;                /**< path metric advertised by the parent */
+    /**
+     * @brief   Routing-MC-Type of gnrc_rpl_parent_t::metric, 0 if the parent
+     *          did not advertise a metric in its last DIO
+     */
+    uint8_t metric_type;
     /**
      * @brief Parent timeout events (see @ref GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT)
      */
@@ -304,6 +336,21 @@ typedef struct {
      */
     void (*init)(gnrc_rpl_dodag_t *dodag);
     void (*process_dio)(void);  /**< DIO processing callback (acc. to OF0 spec, chpt 5) */
+
+    /**
+     * @brief   Decide whether to switch the preferred parent.
+     *
+     * Called when gnrc_rpl_of_t::parent_cmp prefers another parent than the
+     * current preferred parent. May be NULL, then the preferred parent is
+     * always switched.
+     *
+     * @param[in] cur   The current preferred parent.
+     * @param[in] cand  The parent preferred by gnrc_rpl_of_t::parent_cmp.
+     *
+     * @return  true, if @p cand becomes the preferred parent.
+     * @return  false, if @p cur stays the preferred parent.
+     */
+    bool (*parent_switch)(gnrc_rpl_parent_t *cur, gnrc_rpl_parent_t *cand);
 } gnrc_rpl_of_t;
 
 /**
@@ -328,6 +375,7 @@ struct gnrc_rpl_dodag {
     uint8_t dao_seq;                /**< dao sequence number */
     uint8_t dao_counter;            /**< amount of retried DAOs */
     bool dao_ack_received;          /**< flag to check for DAO-ACK */
+    bool dao_coalescing;            /**< DAO triggered by a child is scheduled */
     uint8_t dio_opts;               /**< options in the next DIO
                                          (see @ref GNRC_RPL_REQ_DIO_OPTS "DIO Options") */
     evtimer_msg_event_t dao_event;  /**< DAO TX events (see @ref GNRC_RPL_MSG_TYPE_DODAG_DAO_TX) */
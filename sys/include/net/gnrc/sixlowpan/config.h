@@ -141,9 +141,7 @@ extern "C" {
  * @see     https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  *
  * @note    Only applicable with
- *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module,
- *          but has also a direct influence on the number of available
- *          gnrc_sixlowpan_frag_rb_int_t entries.
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
  */
 #ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
@@ -25,6 +25,9 @@
 
 #include "msg.h"
 #include "net/gnrc/pkt.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr_types.h"
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,6 +54,12 @@ typedef struct {
      */
     gnrc_sixlowpan_frag_hint_t hint;
 #endif /* MODULE_GNRC_SIXLOWPAN_FRAG_HINT */
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    /**
+     * @brief   Selective fragment recovery state of the datagram
+     */
+    gnrc_sixlowpan_frag_sfr_fb_t sfr;
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 } gnrc_sixlowpan_frag_fb_t;
 
 #ifdef TEST_SUITES
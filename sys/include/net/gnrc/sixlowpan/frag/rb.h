@@ -23,8 +23,12 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "net/frag_ints.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/sixlowpan/sfr.h"
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 
 #include "net/gnrc/sixlowpan/config.h"
 
@@ -36,25 +40,6 @@ extern "C" {
  */
 #define GNRC_SIXLOWPAN_FRAG_RB_GC_MSG       (0x0226)
 
-/**
- * @brief   Fragment intervals to identify limits of fragments and duplicates.
- *
- * @note    Fragments MUST NOT overlap and overlapping fragments are to be
- *          discarded
- *
- * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
- *          RFC 4944, section 5.3
- *      </a>
- */
-typedef struct gnrc_sixlowpan_frag_rb_int {
-    /**
-     * @brief   next element in fragment interval list
-     */
-    struct gnrc_sixlowpan_frag_rb_int *next;
-    uint16_t start;             /**< start byte of the fragment interval */
-    uint16_t end;               /**< end byte of the fragment interval */
-} gnrc_sixlowpan_frag_rb_int_t;
-
 /**
  * @brief   Base class for both reassembly buffer and virtual reassembly buffer
  *
@@ -69,7 +54,15 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
  * @see https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  */
 typedef struct {
-    gnrc_sixlowpan_frag_rb_int_t *ints;         /**< intervals of already received fragments */
+    /**
+     * @brief   Intervals of already received fragments
+     *
+     * @note    Fragments MUST NOT overlap and overlapping fragments are to be
+     *          discarded
+     *
+     * @see [RFC 4944, section 5.3](https://tools.ietf.org/html/rfc4944#section-5.3)
+     */
+    frag_ints_t ints;
     uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
     uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
     uint8_t src_len;                            /**< length of gnrc_sixlowpan_frag_rb_t::src */
@@ -82,6 +75,27 @@ typedef struct {
     uint16_t current_size;
     uint32_t arrival;                           /**< time in microseconds of arrival of
                                                  *   last received fragment */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
+    /**
+     * @brief   Sequence numbers of the recoverable fragments received so far,
+     *          in the format of the bitmap of an RFRAG acknowledgment
+     *
+     * @note    Only available with the `gnrc_sixlowpan_frag_sfr` module.
+     */
+    BITFIELD(received, SIXLOWPAN_SFR_ACK_BITMAP_SIZE);
+    /**
+     * @brief   Difference between the offset of a byte in the reassembled
+     *          datagram and its offset in the recoverable fragments
+     *
+     * Recoverable fragments use offsets into the compressed datagram, so this
+     * is set once the header in the first fragment is decompressed. For a
+     * virtual reassembly buffer entry it is the difference caused by
+     * recompressing the header for the next hop instead.
+     *
+     * @note    Only available with the `gnrc_sixlowpan_frag_sfr` module.
+     */
+    int16_t offset_diff;
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 } gnrc_sixlowpan_frag_rb_base_t;
 
 /**
@@ -139,6 +153,27 @@ gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr
 bool gnrc_sixlowpan_frag_rb_exists(const gnrc_netif_hdr_t *netif_hdr,
                                    uint16_t tag);
 
+/**
+ * @brief   Gets a reassembly buffer entry with a given link-layer address pair
+ *          and tag
+ *
+ * @pre     `netif_hdr != NULL`
+ *
+ * @param[in] netif_hdr An interface header to provide the (source, destination)
+ *                      link-layer address pair. Must not be NULL.
+ * @param[in] tag       Tag to search for.
+ *
+ * @note    datagram_size is not a search parameter as the primary use case
+ *          for this function is [Selective Fragment Recovery]
+ *          (https://tools.ietf.org/html/draft-ietf-6lo-fragment-recovery-05)
+ *          where this information only exists in the first fragment.
+ *
+ * @return  The reassembly buffer entry with the given tuple.
+ * @return  NULL, if no entry with the given tuple exist.
+ */
+gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_get_by_datagram(
+        const gnrc_netif_hdr_t *netif_hdr, uint16_t tag);
+
 /**
  * @brief   Removes a reassembly buffer entry with a given link-layer address
  *          pair and tag
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup net_gnrc_sixlowpan_frag_sfr 6LoWPAN selective fragment recovery
+ * @ingroup  net_gnrc_sixlowpan_frag
+ * @brief   6LoWPAN selective fragment recovery implementation for GNRC
+ * @see     [RFC 8931](https://tools.ietf.org/html/rfc8931)
+ *
+ * With the `gnrc_sixlowpan_frag_sfr` module, datagrams that do not fit into a
+ * single frame are sent as recoverable fragments (RFRAG) instead of the
+ * fragments of [RFC 4944](https://tools.ietf.org/html/rfc4944#section-5.3).
+ * The receiver acknowledges the fragments it received with a bitmap, so the
+ * sender only needs to resend the fragments that were lost.
+ *
+ * The sender keeps the datagram in its
+ * [fragmentation buffer](@ref net_gnrc_sixlowpan_frag_fb) until all fragments
+ * are acknowledged. It sends the fragments in windows of
+ * @ref GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE fragments, paced by
+ * @ref GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US, and requests an acknowledgment
+ * with the last fragment of each window. Fragments missing in the
+ * acknowledgment are sent again in the next window. Without an acknowledgment
+ * within @ref GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS, the last fragment is
+ * sent again (or all fragments sent so far, if none was acknowledged yet).
+ * After @ref GNRC_SIXLOWPAN_SFR_FRAG_RETRIES acknowledgment
+ * requests without progress, the datagram is sent again from scratch
+ * (@ref GNRC_SIXLOWPAN_SFR_DG_RETRIES times) or dropped.
+ *
+ * The receiver reassembles the datagram in its
+ * [reassembly buffer](@ref net_gnrc_sixlowpan_frag_rb). With the
+ * [virtual reassembly buffer](@ref net_gnrc_sixlowpan_frag_vrb), a node that
+ * has a route to the destination of the datagram forwards the fragments to
+ * the next hop instead and the acknowledgments back to the previous hop.
+ *
+ * @note    The window size does not adapt to explicit congestion notification
+ *          (see @ref GNRC_SIXLOWPAN_SFR_USE_ECN).
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN selective fragment recovery definitions for GNRC
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
+#include "net/sixlowpan/sfr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Message type for an ARQ timeout of a fragmentation buffer entry
+ */
+#define GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG (0x0227)
+
+/**
+ * @brief   Sends a packet as recoverable fragments
+ *
+ * Sends the next fragment of the current window and schedules the fragment
+ * after it.
+ *
+ * @pre `ctx != NULL`
+ * @pre gnrc_sixlowpan_frag_fb_t::pkt of @p ctx is equal to @p pkt or
+ *      `pkt == NULL`.
+ *
+ * @param[in] pkt       A packet. May be NULL.
+ * @param[in] ctx       A fragmentation buffer entry. Expected to be of type
+ *                      @ref gnrc_sixlowpan_frag_fb_t, with
+ *                      gnrc_sixlowpan_frag_fb_t::pkt set to @p pkt. Must not
+ *                      be NULL.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ */
+void gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page);
+
+/**
+ * @brief   Handles a packet containing a selective fragment recovery header
+ *          (RFRAG or RFRAG acknowledgment)
+ *
+ * @param[in] pkt       The packet to handle
+ * @param[in] ctx       Context for the packet. May be NULL.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ */
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page);
+
+/**
+ * @brief   Handles an ARQ timeout of a fragmentation buffer entry
+ *
+ * @see GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG
+ *
+ * @param[in] fbuf  A fragmentation buffer entry. Must not be NULL.
+ */
+void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf);
+
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || defined(DOXYGEN)
+/**
+ * @brief   Forwards the first recoverable fragment of a datagram to the next
+ *          hop in a virtual reassembly buffer entry
+ *
+ * The offsets of all further fragments of the datagram are adapted by the
+ * difference in size between @p pkt and the original first fragment, as the
+ * header of the datagram may be compressed differently for the next hop.
+ *
+ * @note    Only available with the `gnrc_sixlowpan_frag_vrb` module.
+ *
+ * @param[in] pkt       The recompressed payload of the first fragment, with
+ *                      a @ref gnrc_netif_hdr_t as first snip. Will be
+ *                      released by the function.
+ * @param[in] rfrag     The recoverable fragment header of the first fragment
+ *                      as received.
+ * @param[in] vrbe      The virtual reassembly buffer entry to forward to.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ *
+ * @return  0, on success.
+ * @return  -ENOMEM, if the packet buffer is full.
+ * @return  -EMSGSIZE, if the recompressed fragment does not fit the link to
+ *          the next hop.
+ */
+int gnrc_sixlowpan_frag_sfr_forward(gnrc_pktsnip_t *pkt,
+                                    const sixlowpan_sfr_rfrag_t *rfrag,
+                                    gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    unsigned page);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_H */
+/** @} */
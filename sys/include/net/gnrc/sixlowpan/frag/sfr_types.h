@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_sixlowpan_frag_sfr
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN selective fragment recovery type definitions for GNRC
+ *
+ * Separate from @ref net/gnrc/sixlowpan/frag/sfr.h, so it can be included by
+ * @ref net/gnrc/sixlowpan/frag/fb.h without a cyclical include.
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+
+#include <stdint.h>
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Selective fragment recovery state of a fragmentation buffer entry
+ *
+ * The fragments of a datagram are numbered by their sequence number. Bit `i`
+ * of the bitmaps (counted from the most significant bit) represents the
+ * fragment with sequence number `i`, as in the bitmap of an RFRAG
+ * acknowledgment.
+ */
+typedef struct {
+    xtimer_t arq_timer;         /**< Timer for the ARQ timeout */
+    msg_t arq_timer_msg;        /**< Message for gnrc_sixlowpan_frag_sfr_fb_t::arq_timer */
+    xtimer_t gap_timer;         /**< Timer for the inter-frame gap */
+    msg_t gap_timer_msg;        /**< Message for gnrc_sixlowpan_frag_sfr_fb_t::gap_timer */
+    uint32_t acked;             /**< Fragments acknowledged by the receiver */
+    uint32_t resend;            /**< Fragments to resend in the current window */
+    uint16_t frag_size;         /**< Payload size of all fragments but the last */
+    uint8_t frags;              /**< Number of fragments of the datagram */
+    uint8_t next_seq;           /**< Sequence number of the next fragment not
+                                 *   sent yet */
+    uint8_t window_left;        /**< Fragments left to send in the current
+                                 *   window */
+    uint8_t last_seq;           /**< Sequence number of the fragment that
+                                 *   requested the last acknowledgment */
+    uint8_t retries;            /**< Acknowledgment requests without progress */
+    uint8_t dg_retries;         /**< Retries of the datagram from scratch */
+} gnrc_sixlowpan_frag_sfr_fb_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H */
+/** @} */
@@ -117,6 +117,32 @@ void gnrc_sixlowpan_frag_vrb_gc(void);
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
         const uint8_t *src, size_t src_len, unsigned src_tag);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
+/**
+ * @brief   Reverse VRB lookup
+ *
+ * Used to route RFRAG acknowledgments of the next hop back to the previous
+ * hop of a datagram.
+ *
+ * @note    Only available with the `gnrc_sixlowpan_frag_sfr` module.
+ *
+ * @param[in] netif         Network interface the acknowledgment was received
+ *                          on.
+ * @param[in] src           Link-layer source address of the acknowledgment,
+ *                          i.e. the next hop of the datagram.
+ * @param[in] src_len       Length of @p src.
+ * @param[in] tag           Tag of the acknowledgment, i.e. the tag of the
+ *                          forwarded fragments.
+ *
+ * @return  The VRB entry the forwarded fragments with @p tag originate from.
+ * @return  NULL, if there is no entry in the VRB that could be identified
+ *          by the given parameters.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
+        const gnrc_netif_t *netif, const uint8_t *src, size_t src_len,
+        unsigned tag);
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+
 /**
  * @brief   Removes an entry from the VRB
  *
@@ -161,7 +161,10 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Blocks until @p len bytes were transmitted and acknowledged by the peer or
+ *       an error occurred. As many segments are sent at once as the window of the
+ *       peer, the congestion window and @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+ *       allow, so large buffers are transmitted faster than small ones.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -179,6 +182,37 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Transmit data from packet buffer snips to connected peer without copying.
+ *
+ * The application allocates the payload, e.g. with
+ * `gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF)`, and fills it
+ * directly. Each snip of @p pkt is split into segments in place, so a segment
+ * never spans multiple snips.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p pkt must not be NULL.
+ *
+ * @note Blocks like gnrc_tcp_send(). @p pkt is released in any case, the
+ *       application must not access it afterwards.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[in]     pkt                        Snips holding the data that should be
+ *                                           transmitted.
+ * @param[in]     user_timeout_duration_ms   If not zero and there was not data transmitted
+ *                                           the function returns after user_timeout_duration_ms.
+ *                                           If zero, no timeout will be triggered.
+ *
+ * @return   The number of successfully transmitted bytes.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+ssize_t gnrc_tcp_send_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                          const uint32_t user_timeout_duration_ms);
+
 /**
  * @brief Receive Data from the peer.
  *
@@ -210,6 +244,52 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Receive Data from the peer without copying.
+ *
+ * Hands out the received data in place in the receive buffer of @p tcb.
+ * The data stays valid and the receive window stays closed by its size
+ * until the function is called again with the same @p buf_ctx. To receive
+ * all currently buffered data, call the function until it returns 0 or
+ * an error:
+ *
+ * ~~~~~~~~~~~~~~~~~~~ {.c}
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = gnrc_tcp_recv_buf(tcb, &data, &ctx, timeout)) > 0) {
+ *     process(data, res);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p data must not be NULL.
+ * @pre @p buf_ctx must not be NULL and point to NULL on the first call.
+ *
+ * @note Function blocks like gnrc_tcp_recv() if @p buf_ctx points to NULL.
+ *       Subsequent calls never block. gnrc_tcp_recv() must not be called
+ *       while data is handed out.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[out]    data                       Pointer to the received data.
+ * @param[in,out] buf_ctx                    Context of the handed out data. Set
+ *                                           to NULL once all data was dropped.
+ * @param[in]     user_timeout_duration_ms   Timeout for receive in milliseconds, see
+ *                                           gnrc_tcp_recv().
+ *
+ * @return   The number of bytes available at @p data.
+ * @return   0, if the handed out data was dropped and no further data is buffered
+ *           or if the connection is closing and no further data can be read.
+ * @return   -ENOTCONN if connection is not established.
+ * @return   -EAGAIN if  user_timeout_duration_us is zero and no data is available.
+ * @return   -ECONNRESET if connection was reset by the peer.
+ * @return   -ECONNABORTED if the connection was aborted.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          const uint32_t user_timeout_duration_ms);
+
 /**
  * @brief Close a TCP connection.
  *
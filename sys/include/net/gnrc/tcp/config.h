@@ -108,6 +108,29 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of segments that can be sent without waiting for an
+ *        acknowledgment.
+ *
+ * Every unacknowledged segment is kept in the packet buffer until it is
+ * acknowledged, so this value must fit the size of the packet buffer. The
+ * amount of data in flight is further limited by the congestion window and
+ * the window of the peer. The maximum value is 16.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Disable the Selective Acknowledgment (SACK) option (see RFC 2018)
+ *
+ * If enabled, the SACK option is neither offered nor accepted by the peer, lost
+ * segments are recovered by NewReno only (see RFC 6582).
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_TCP_DISABLE_SACK
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -67,13 +67,25 @@ typedef struct _transmission_control_block {
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
+    uint32_t rtt_seq;      /**< SeqNo. that completes the current rtt measurement */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dupacks;       /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Highest SeqNo. sent when loss recovery started */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Packets in "retransmit queue", oldest first
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint8_t rtx_num;         /**< Number of packets in "retransmit queue" */
+    uint16_t rtx_sacked;     /**< Bitmap of selectively acknowledged packets in queue */
+    uint16_t rtx_resent;     /**< Bitmap of packets retransmitted during loss recovery */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    uint16_t rcv_borrowed;   /**< Bytes of rcv_buf handed out by gnrc_tcp_recv_buf() */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct _transmission_control_block *next;   /**< Pointer next TCB */
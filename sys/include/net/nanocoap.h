@@ -44,6 +44,13 @@
  * For either API, the caller *must* write options in order by option number
  * (see "CoAP option numbers" in [CoAP defines](group__net__coap.html)).
  *
+ * Functions reading an option, like coap_opt_get_uint(), look up the first
+ * option with the given number in coap_pkt_t::options. With the
+ * `nanocoap_option_index` module, coap_parse() also records the length of the
+ * value and of the header of each option there. Options are then found with a
+ * binary search, and their values are read without decoding the option header
+ * again.
+ *
  * ## Server path matching
  *
  * By default the URI-path of an incoming request should match exactly one of
@@ -177,6 +184,12 @@ typedef struct __attribute__((packed)) {
 typedef struct {
     uint16_t opt_num;           /**< full CoAP option number    */
     uint16_t offset;            /**< offset in packet           */
+#if defined(MODULE_NANOCOAP_OPTION_INDEX) || defined(DOXYGEN)
+    uint16_t len;               /**< length of option value,
+                                     only with `nanocoap_option_index` */
+    uint8_t hdr_len;            /**< length of option header,
+                                     only with `nanocoap_option_index` */
+#endif
 } coap_optpos_t;
 
 /**
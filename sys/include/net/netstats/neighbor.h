@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_netstats_neighbor Per neighbor link statistics
+ * @ingroup     net_netstats
+ * @brief       Estimates the expected transmission count (ETX) of the links
+ *              to the neighbors of an interface
+ *
+ * For every unicast frame sent, the link-layer destination is recorded with
+ * netstats_nb_record(). When the device reports the transmission status of the
+ * frame, netstats_nb_update_tx() takes the number of retransmissions
+ * (`NETOPT_TX_RETRIES_NEEDED`) as a sample of the ETX of the link to that
+ * neighbor and folds it into an exponentially weighted moving average. Frames
+ * that were not acknowledged at all count as
+ * @ref CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY additional transmissions.
+ *
+ * Devices report the status of their frames in the order they were sent, so
+ * the destinations of the frames awaiting their status are kept in a small
+ * FIFO. A frame the device refuses to send is removed from the end of the FIFO
+ * again with netstats_nb_drop_last().
+ *
+ * With @ref net_gnrc_netif, every interface holds its table in
+ * gnrc_netif_t::neighbors when the `netstats_neighbor` module is used.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Per neighbor link statistics definitions
+ */
+#ifndef NET_NETSTATS_NEIGHBOR_H
+#define NET_NETSTATS_NEIGHBOR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_netstats_neighbor_conf Per neighbor link statistics compile configurations
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of neighbors kept per interface
+ *
+ * When the table is full, the neighbor not sent to for the longest time is
+ * replaced.
+ */
+#ifndef CONFIG_NETSTATS_NB_SIZE
+#define CONFIG_NETSTATS_NB_SIZE             (8U)
+#endif
+
+/**
+ * @brief   Maximum length of a link-layer address
+ */
+#ifndef CONFIG_NETSTATS_NB_L2ADDR_MAXLEN
+#define CONFIG_NETSTATS_NB_L2ADDR_MAXLEN    (8U)
+#endif
+
+/**
+ * @brief   Maximum number of frames awaiting their transmission status
+ */
+#ifndef CONFIG_NETSTATS_NB_QUEUE_SIZE
+#define CONFIG_NETSTATS_NB_QUEUE_SIZE       (4U)
+#endif
+
+/**
+ * @brief   ETX of a neighbor before the first transmission status is known
+ */
+#ifndef CONFIG_NETSTATS_NB_ETX_INIT
+#define CONFIG_NETSTATS_NB_ETX_INIT         (2U)
+#endif
+
+/**
+ * @brief   Number of transmissions added to the ETX sample of a frame that
+ *          was not acknowledged
+ */
+#ifndef CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY
+#define CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY (6U)
+#endif
+
+/**
+ * @brief   Weight of a new sample in the ETX average in percent
+ */
+#ifndef CONFIG_NETSTATS_NB_EWMA_ALPHA
+#define CONFIG_NETSTATS_NB_EWMA_ALPHA       (15U)
+#endif
+/** @} */
+
+/**
+ * @brief   Fixed point divisor of netstats_nb_t::etx
+ *
+ * This is the same representation as in the ETX object of a DAG metric
+ * container, see [RFC 6551, section 4.3.2](https://tools.ietf.org/html/rfc6551#section-4.3.2).
+ */
+#define NETSTATS_NB_ETX_DIVISOR             (128U)
+
+/**
+ * @brief   Queue entry for frames without a known neighbor (e.g. multicast)
+ */
+#define NETSTATS_NB_NONE                    (UINT8_MAX)
+
+/**
+ * @brief   Transmission status of a frame
+ */
+typedef enum {
+    NETSTATS_NB_SUCCESS = 0,    /**< frame was sent (and acknowledged) */
+    NETSTATS_NB_NOACK,          /**< frame was not acknowledged */
+    NETSTATS_NB_BUSY,           /**< frame was not sent, e.g. medium busy */
+} netstats_nb_result_t;
+
+/**
+ * @brief   Statistics of the link to a neighbor
+ */
+typedef struct {
+    uint8_t l2_addr[CONFIG_NETSTATS_NB_L2ADDR_MAXLEN];  /**< link-layer address */
+    uint8_t l2_addr_len;    /**< length of netstats_nb_t::l2_addr, 0 if unused */
+    uint16_t etx;           /**< ETX in units of 1/@ref NETSTATS_NB_ETX_DIVISOR */
+    uint16_t tx_count;      /**< frames sent to the neighbor */
+    uint16_t tx_failed;     /**< frames sent to the neighbor not acknowledged */
+    uint16_t last_used;     /**< netstats_nb_table_t::clock of last frame */
+} netstats_nb_t;
+
+/**
+ * @brief   Neighbor statistics of an interface
+ */
+typedef struct {
+    netstats_nb_t nbs[CONFIG_NETSTATS_NB_SIZE];     /**< the neighbors */
+    /**
+     * @brief   Index in netstats_nb_table_t::nbs of the destination of every
+     *          frame awaiting its status, oldest first, starting at
+     *          netstats_nb_table_t::queue_first
+     */
+    uint8_t queue[CONFIG_NETSTATS_NB_QUEUE_SIZE];
+    uint8_t queue_first;    /**< first entry in netstats_nb_table_t::queue */
+    uint8_t queue_len;      /**< number of entries in netstats_nb_table_t::queue */
+    uint16_t clock;         /**< number of frames recorded, wraps around */
+} netstats_nb_table_t;
+
+/**
+ * @brief   Initializes (or empties) the neighbor statistics of an interface
+ *
+ * @param[out] table    Neighbor statistics of an interface. Must not be NULL.
+ */
+void netstats_nb_init(netstats_nb_table_t *table);
+
+/**
+ * @brief   Gets the statistics of a neighbor
+ *
+ * @param[in] table     Neighbor statistics of an interface. Must not be NULL.
+ * @param[in] l2_addr   Link-layer address of the neighbor.
+ * @param[in] len       Length of @p l2_addr.
+ *
+ * @return  The statistics of the neighbor with link-layer address @p l2_addr.
+ * @return  NULL, if no frame was sent to the neighbor yet (or it was replaced).
+ */
+const netstats_nb_t *netstats_nb_get(const netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr, uint8_t len);
+
+/**
+ * @brief   Records the destination of a frame that is about to be sent
+ *
+ * @param[in,out] table Neighbor statistics of an interface. Must not be NULL.
+ * @param[in] l2_addr   Link-layer destination of the frame. May be NULL for
+ *                      multicast frames.
+ * @param[in] len       Length of @p l2_addr. 0 for multicast frames.
+ */
+void netstats_nb_record(netstats_nb_table_t *table, const uint8_t *l2_addr,
+                        uint8_t len);
+
+/**
+ * @brief   Updates the statistics of the neighbor the oldest recorded frame
+ *          was sent to with the status of that frame
+ *
+ * @param[in,out] table Neighbor statistics of an interface. Must not be NULL.
+ * @param[in] result    Transmission status of the frame.
+ * @param[in] retries   Number of retransmissions of the frame.
+ */
+void netstats_nb_update_tx(netstats_nb_table_t *table,
+                           netstats_nb_result_t result, uint8_t retries);
+
+/**
+ * @brief   Drops the most recently recorded frame without updating any
+ *          statistics
+ *
+ * For a frame the device rejected right away, so it will never report a
+ * status for it. Unlike netstats_nb_update_tx(), this leaves the records of
+ * earlier frames still awaiting their status in place.
+ *
+ * @param[in,out] table Neighbor statistics of an interface. Must not be NULL.
+ */
+void netstats_nb_drop_last(netstats_nb_table_t *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_NETSTATS_NEIGHBOR_H */
+/** @} */
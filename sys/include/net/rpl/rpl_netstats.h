@@ -67,6 +67,14 @@ typedef struct {
     uint32_t dao_ack_tx_ucast_bytes;    /**< unicast dao_ack sent in bytes */
     uint32_t dao_ack_tx_mcast_count;    /**< multicast dao_ack sent in packets */
     uint32_t dao_ack_tx_mcast_bytes;    /**< multicast dao_ack sent in bytes*/
+    /* DAO overhead */
+    uint32_t dao_tx_target_count;       /**< targets announced in sent daos */
+    uint32_t dao_coalesced_count;       /**< daos of children announced in an
+                                             already scheduled dao */
+    uint32_t dao_ack_batched_count;     /**< dao_acks superseded by a later dao
+                                             of the same child */
+    uint32_t route_aggregated_count;    /**< routes to dao targets merged into
+                                             a route to a covering prefix */
 } netstats_rpl_t;
 
 #ifdef __cplusplus
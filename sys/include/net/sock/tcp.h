@@ -517,6 +517,53 @@ int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
 ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
                       uint32_t timeout);
 
+/**
+ * @brief   Provides stack-internal buffer space containing data of an
+ *          established TCP stream
+ *
+ * The data is not copied, it stays in the receive buffer of the stack until
+ * the function is called again with the same @p buf_ctx.
+ *
+ * @pre `(sock != NULL) && (data != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A TCP sock object.
+ * @param[out] data     Pointer to a stack-internal buffer space containing the
+ *                      received data.
+ * @param[in,out] buf_ctx  Stack-internal buffer context. If it points to a
+ *                      `NULL` pointer, the stack returns a new buffer space.
+ *                      If it does not point to a `NULL` pointer, the
+ *                      previously returned buffer space is released and the
+ *                      next already received segment of the stream is
+ *                      returned.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Function blocks if @p buf_ctx points to `NULL` and no data is
+ *          currently waiting.
+ *
+ * @return  The number of bytes received on success. May not be all buffered
+ *          data. Continue calling with the returned `buf_ctx` to get more
+ *          buffers until result is 0 or an error.
+ * @return  0, if no read data is available, but everything is in order.
+ *          If @p buf_ctx was provided, it was released.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -ECONNABORTED, if the connection is aborted while waiting for the
+ *          next data.
+ * @return  -ECONNRESET, if the connection was forcibly closed by remote end
+ *          point of @p sock.
+ * @return  -ENOTCONN, when @p sock is not connected to a remote end point.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout);
+
 /**
  * @brief   Writes data to an established TCP stream
  *
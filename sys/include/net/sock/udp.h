@@ -295,6 +295,25 @@ typedef struct _sock_tl_ep sock_udp_ep_t;   /**< An end point for a UDP sock obj
  */
 typedef struct sock_udp sock_udp_t;
 
+/**
+ * @brief   The received datagram did not fit into sock_udp_msg_t::data and
+ *          was truncated
+ */
+#define SOCK_UDP_MSG_FLAG_TRUNC     (0x01U)
+
+/**
+ * @brief   A datagram for @ref sock_udp_recv_many() and
+ *          @ref sock_udp_send_many()
+ */
+typedef struct {
+    void *data;             /**< payload or buffer space for the payload */
+    size_t len;             /**< length of sock_udp_msg_t::data */
+    size_t msg_len;         /**< number of bytes received or sent */
+    sock_udp_ep_t remote;   /**< remote end point of the datagram */
+    uint8_t flags;          /**< flags of a received datagram, e.g.
+                             *   @ref SOCK_UDP_MSG_FLAG_TRUNC */
+} sock_udp_msg_t;
+
 #if defined (__clang__)
 # pragma clang diagnostic pop
 #endif
@@ -493,6 +512,85 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Only the first message is waited for with @p timeout, all further messages
+ * are taken from the ones already queued for @p sock in a single pass. This
+ * saves the cost of a blocking receive per message when messages arrive in
+ * bursts.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (count > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Array of @p count messages. sock_udp_msg_t::data and
+ *                      sock_udp_msg_t::len give the buffer space for each
+ *                      message. On return sock_udp_msg_t::msg_len,
+ *                      sock_udp_msg_t::remote, and sock_udp_msg_t::flags are
+ *                      set for each received message.
+ * @param[in] count     Number of elements in @p msgs.
+ * @param[in] timeout   Timeout for the first message in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    A message that is larger than the buffer space of its element in
+ *          @p msgs is truncated to sock_udp_msg_t::len bytes and
+ *          @ref SOCK_UDP_MSG_FLAG_TRUNC is set in sock_udp_msg_t::flags.
+ *          The rest of the message is discarded.
+ * @note    Errors are only returned for the first message. Further messages
+ *          from a remote other than the remote of @p sock are skipped, like
+ *          the first one they would fail with -EPROTO.
+ *
+ * @return  The number of messages received on success.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p sock is not properly initialized (or closed while
+ *          sock_udp_recv_many() blocks).
+ * @return  -ENOMEM, if no memory was available to receive the data.
+ * @return  -EPROTO, if source address of received packet did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count, uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * Where the stack supports it, the messages are passed to the network stack
+ * together instead of one at a time.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (count > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Array of @p count messages. sock_udp_msg_t::data and
+ *                      sock_udp_msg_t::len give the payload of each message.
+ *                      sock_udp_msg_t::remote is the remote end point for
+ *                      the message. If its sock_udp_ep_t::port is 0, the
+ *                      remote end point of @p sock is used instead. On
+ *                      return sock_udp_msg_t::msg_len is set for each sent
+ *                      message.
+ * @param[in] count     Number of elements in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Sending stops at the first error. The error is only reported if
+ *          no message was sent before.
+ *
+ * @return  The number of messages sent on success.
+ * @return  Any error of @ref sock_udp_send() for the first message.
+ */
+ssize_t sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_latency Scheduler latency statistics
+ * @ingroup     sys
+ * @brief       Per-thread histograms of scheduling latency and run times
+ *
+ * When including this module, the scheduler time stamps every thread that is
+ * woken up (put on the run queue by sched_set_status()) and every context
+ * switch. From these time stamps, two log-scale histograms are maintained per
+ * thread:
+ *
+ * - the wakeup latency: the time from being put on the run queue until the
+ *   thread actually runs
+ * - the slice: the time a thread runs from being switched in until being
+ *   switched out
+ *
+ * Additionally, a timer is set periodically (see
+ * @ref CONFIG_SCHED_LATENCY_PROBE_US) and the lateness of its callback is
+ * recorded in a system wide histogram. The timer is late if interrupts are
+ * disabled or a higher priority interrupt is served when it expires. This
+ * only samples the interrupt latency at the time of the timer interrupts, it
+ * does not measure how long interrupts are disabled elsewhere.
+ *
+ * All times are in microseconds. Bucket 0 of a histogram counts values of 0,
+ * bucket `i` counts values in [2^(i-1), 2^i - 1], the last bucket also counts
+ * all larger values. The memory used is fixed: two histograms for every
+ * possible PID and one for the timer lateness.
+ *
+ * The scheduler calls the hooks with interrupts disabled, where ztimer must
+ * not be entered. So the time stamps are taken by reading the counter of the
+ * timer @ref CONFIG_SCHED_LATENCY_TIMER_DEV with timer_read(). By default,
+ * this is the timer backing `ZTIMER_USEC`, which keeps the timer running.
+ * Times longer than the range of the counter are recorded modulo that range.
+ *
+ * @note        If auto_init is disabled, sched_latency_init() needs to be
+ *              called after ztimer_init().
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency statistics
+ */
+
+#ifndef SCHED_LATENCY_H
+#define SCHED_LATENCY_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "sched.h"
+#include "ztimer/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_sched_latency_conf  Scheduler latency statistics configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of each histogram
+ *
+ * The last bucket counts all values of at least 2^(CONFIG_SCHED_LATENCY_BUCKETS - 2) us.
+ */
+#ifndef CONFIG_SCHED_LATENCY_BUCKETS
+#define CONFIG_SCHED_LATENCY_BUCKETS        (16U)
+#endif
+
+/**
+ * @brief   Period of the timer measuring the timer lateness in microseconds
+ *
+ * Set to 0 to disable the measurement.
+ */
+#ifndef CONFIG_SCHED_LATENCY_PROBE_US
+#define CONFIG_SCHED_LATENCY_PROBE_US       (10000U)
+#endif
+
+/**
+ * @brief   Timer whose counter is read for the time stamps
+ *
+ * The timer must be initialized and running, which is the case for the
+ * default, the timer backing `ZTIMER_USEC`.
+ */
+#ifndef CONFIG_SCHED_LATENCY_TIMER_DEV
+#define CONFIG_SCHED_LATENCY_TIMER_DEV      CONFIG_ZTIMER_USEC_DEV
+#endif
+
+/**
+ * @brief   Frequency of @ref CONFIG_SCHED_LATENCY_TIMER_DEV in Hz
+ */
+#ifndef CONFIG_SCHED_LATENCY_TIMER_FREQ
+#define CONFIG_SCHED_LATENCY_TIMER_FREQ     CONFIG_ZTIMER_USEC_BASE_FREQ
+#endif
+
+/**
+ * @brief   Width of the counter of @ref CONFIG_SCHED_LATENCY_TIMER_DEV in bits
+ */
+#ifndef CONFIG_SCHED_LATENCY_TIMER_WIDTH
+#define CONFIG_SCHED_LATENCY_TIMER_WIDTH    CONFIG_ZTIMER_USEC_WIDTH
+#endif
+/** @} */
+
+/**
+ * @brief   Log-scale histogram of times in microseconds
+ */
+typedef struct {
+    uint32_t buckets[CONFIG_SCHED_LATENCY_BUCKETS]; /**< number of values in each bucket */
+    uint32_t max;                                   /**< largest value recorded */
+} sched_latency_hist_t;
+
+/**
+ * @brief   Scheduler latency statistics of a thread
+ */
+typedef struct {
+    sched_latency_hist_t wakeup;    /**< time from wakeup until running */
+    sched_latency_hist_t slice;     /**< time running per context switch */
+} sched_latency_t;
+
+/**
+ * @brief   Initializes the statistics and starts recording
+ */
+void sched_latency_init(void);
+
+/**
+ * @brief   Clears all histograms
+ */
+void sched_latency_reset(void);
+
+/**
+ * @brief   Gets a copy of the statistics of a thread
+ *
+ * @param[in]  pid      PID of the thread
+ * @param[out] stats    The statistics of the thread
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p pid is not a valid PID
+ */
+int sched_latency_get(kernel_pid_t pid, sched_latency_t *stats);
+
+/**
+ * @brief   Gets a copy of the timer lateness histogram
+ *
+ * @param[out] hist     The histogram of how late the probe timer fired
+ */
+void sched_latency_get_timer_lateness(sched_latency_hist_t *hist);
+
+/**
+ * @brief   Gets the number of values recorded in a histogram
+ *
+ * @param[in] hist  A histogram
+ *
+ * @return  The number of values in @p hist
+ */
+uint32_t sched_latency_hist_count(const sched_latency_hist_t *hist);
+
+/**
+ * @brief   Gets a percentile of the values recorded in a histogram
+ *
+ * As the exact values are not known, the upper bound of the bucket containing
+ * the percentile is returned, but at most the largest value recorded.
+ *
+ * @param[in] hist      A histogram
+ * @param[in] percent   The percentile, e.g. 50 for the median
+ *
+ * @return  Upper bound of the percentile in microseconds
+ * @return  0, if @p hist is empty
+ */
+uint32_t sched_latency_hist_percentile(const sched_latency_hist_t *hist,
+                                       unsigned percent);
+
+/**
+ * @brief   Records that a thread was put on the run queue
+ *
+ * @internal    Called by the scheduler with interrupts disabled
+ *
+ * @param[in] thread    The thread woken up
+ */
+void sched_latency_wakeup(const thread_t *thread);
+
+/**
+ * @brief   Records that the scheduler selected a thread to run
+ *
+ * @internal    Called by the scheduler with interrupts disabled
+ *
+ * @param[in] prev  The thread running before, may be NULL
+ * @param[in] next  The thread to run next, NULL if the CPU goes idle
+ */
+void sched_latency_run(const thread_t *prev, const thread_t *next);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_LATENCY_H */
+/** @} */
@@ -140,6 +140,29 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * ## Timer wheel
+ *
+ * For systems with many concurrently armed timers, the optional module
+ * `ztimer_wheel` replaces the sorted list of every clock with a hierarchical
+ * timing wheel. The 32bit target time of a timer is split into
+ * @ref ZTIMER_WHEEL_LEVELS digits of @ref CONFIG_ZTIMER_WHEEL_BITS bits each.
+ * A timer is stored in the slot of the most significant digit in which its
+ * target differs from the clock's current wheel time, in a doubly-linked list.
+ * Whenever the wheel time reaches the start of an occupied slot, the timers in
+ * that slot are cascaded down into the lower levels, until they end up in
+ * level 0, where they expire.
+ *
+ * This has the following implications:
+ *
+ * - O(1) insertion / removal of timer objects
+ * - O(@ref ZTIMER_WHEEL_LEVELS) get_min(), using a bitmap of occupied slots
+ *   per level
+ * - one additional pointer per timer object
+ * - (@ref ZTIMER_WHEEL_LEVELS * 2^@ref CONFIG_ZTIMER_WHEEL_BITS) list heads
+ *   per clock
+ * - every timer is moved at most @ref ZTIMER_WHEEL_LEVELS times before it
+ *   triggers
+ *
  *
  * ## Clock extension
  *
@@ -261,9 +284,34 @@ typedef struct ztimer_clock ztimer_clock_t;
  */
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< pointer to the previous next pointer,
+                                     NULL if the timer is not set */
+#endif
+    uint32_t offset;            /**< offset from last timer in list, target
+                                     time when using `ztimer_wheel` */
 };
 
+/**
+ * @brief   Number of bits of the target time used per level of the
+ *          `ztimer_wheel` timing wheel
+ *
+ * Each level has 2^CONFIG_ZTIMER_WHEEL_BITS slots. Must be 1, 2 or 4.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_BITS
+#define CONFIG_ZTIMER_WHEEL_BITS    (4U)
+#endif
+
+/**
+ * @brief   Number of slots per level of the `ztimer_wheel` timing wheel
+ */
+#define ZTIMER_WHEEL_SLOTS          (1U << CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   Number of levels of the `ztimer_wheel` timing wheel
+ */
+#define ZTIMER_WHEEL_LEVELS         (32U / CONFIG_ZTIMER_WHEEL_BITS)
+
 #if MODULE_ZTIMER_NOW64
 typedef uint64_t ztimer_now_t;  /**< type for ztimer_now() result */
 #else
@@ -325,6 +373,13 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    /* timing wheel, used instead of the sorted list */
+    ztimer_base_t *wheel[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+                                    /**< timer lists of the wheel's slots   */
+    uint16_t wheel_map[ZTIMER_WHEEL_LEVELS];
+                                    /**< occupied slots per wheel level     */
+#endif
 };
 
 /**
@@ -516,6 +571,59 @@ void ztimer_set_timeout_flag(ztimer_clock_t *clock, ztimer_t *timer,
  */
 void ztimer_update_head_offset(ztimer_clock_t *clock);
 
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+/**
+ * @brief   Add a timer to the timing wheel of a clock
+ *
+ * @internal
+ *
+ * @pre `entry->offset` holds the absolute target time of the timer and lies
+ *      within the next 2^32 ticks after `clock->list.offset`.
+ *
+ * @param[in]   clock   ztimer clock to work on
+ * @param[in]   entry   timer to add
+ */
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Remove a timer from the timing wheel or the list of expired timers
+ *          of a clock
+ *
+ * @internal
+ *
+ * @param[in]   clock   ztimer clock to work on
+ * @param[in]   entry   timer to remove
+ */
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Get the next point in time at which the timing wheel of a clock
+ *          needs to be processed
+ *
+ * @internal
+ *
+ * @param[in]   clock   ztimer clock to work on
+ * @param[out]  target  absolute time of the next event
+ *
+ * @return  1 if there is a next event
+ * @return  0 if the timing wheel is empty
+ */
+int ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *target);
+
+/**
+ * @brief   Advance the timing wheel of a clock up to @p now
+ *
+ * All timers that are due at @p now are moved to the list of expired timers
+ * at `clock->list.next`.
+ *
+ * @internal
+ *
+ * @param[in]   clock   ztimer clock to work on
+ * @param[in]   now     current time of @p clock
+ */
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now);
+#endif /* MODULE_ZTIMER_WHEEL */
+
 /**
  * @brief   Initialize the board-specific default ztimer configuration
  */
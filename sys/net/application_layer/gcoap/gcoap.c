@@ -26,9 +26,11 @@
 #include <string.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "net/gcoap.h"
 #include "net/sock/async/event.h"
 #include "net/sock/util.h"
+#include "memarray.h"
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
@@ -62,10 +64,25 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+static void _find_obs_memo_resource_remote(gcoap_observe_memo_t **memo,
+                                           const coap_resource_t *resource,
+                                           sock_udp_ep_t *remote);
+#endif
 
 static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     const coap_pkt_t *pdu);
+#if IS_USED(MODULE_GCOAP_INDEX)
+static int _request_matcher_index(gcoap_listener_t *listener,
+                                  const coap_resource_t **resource,
+                                  const coap_pkt_t *pdu);
+static bool _index_resources(const gcoap_listener_t *listener);
+#endif
+static void _obs_index_add(sock_udp_ep_t *observer);
+static void _obs_index_remove(sock_udp_ep_t *observer);
+static void _memo_index_add(gcoap_observe_memo_t *memo);
+static void _memo_index_remove(gcoap_observe_memo_t *memo);
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -80,6 +97,20 @@ static gcoap_listener_t _default_listener = {
     _request_matcher_default
 };
 
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+/* Rate limit for notifications of a resource by gcoap_obs_fanout_send() */
+typedef struct gcoap_obs_fanout {
+    struct gcoap_obs_fanout *next;      /* Next rate limited resource */
+    const coap_resource_t *resource;    /* Rate limited resource */
+    event_callback_t interval_cb;       /* Callback at the end of the interval */
+    event_timeout_t interval_tmout;     /* Timeout for the end of the interval */
+    size_t pending_len;                 /* Length of the held back notification;
+                                           0 if none */
+    uint8_t pending[CONFIG_GCOAP_PDU_BUF_SIZE];
+                                        /* Held back notification */
+} gcoap_obs_fanout_t;
+#endif
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
@@ -98,6 +129,28 @@ typedef struct {
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#if IS_USED(MODULE_GCOAP_INDEX)
+    uint64_t subtree_lens;              /* Bit n is set if a resource matching a
+                                           subtree has a path of length n */
+    uint16_t observers_index[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                        /* Slots of observers, ordered by
+                                           endpoint */
+    uint16_t observers_num;             /* Number of observers */
+    uint16_t memos_index[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Slots of observe memos, ordered by
+                                           resource */
+    uint16_t memos_token_index[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Slots of observe memos, ordered by
+                                           observer and token */
+    uint16_t memos_num;                 /* Number of observe memos, in both
+                                           indices */
+#endif
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+    memarray_t fanout_pool;             /* Pool for rate limited resources */
+    gcoap_obs_fanout_t fanout_bufs[CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX];
+                                        /* Storage for fanout_pool */
+    gcoap_obs_fanout_t *fanouts;        /* List of rate limited resources */
+#endif
 } gcoap_state_t;
 
 static gcoap_state_t _coap_state = {
@@ -357,7 +410,12 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
             /* find observe registration for resource */
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+            /* other endpoints may observe the resource as well */
+            _find_obs_memo_resource_remote(&resource_memo, resource, remote);
+#else
             _find_obs_memo_resource(&resource_memo, resource);
+#endif
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -394,6 +452,7 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                     if (obs_slot >= 0) {
                         observer = &_coap_state.observers[obs_slot];
                         memcpy(observer, remote, sizeof(sock_udp_ep_t));
+                        _obs_index_add(observer);
                     } else {
                         DEBUG("gcoap: can't register observer\n");
                     }
@@ -411,11 +470,13 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* finish registration */
         if (memo != NULL) {
             /* resource may be assigned here if it is not already registered */
+            _memo_index_remove(memo);
             memo->resource = resource;
             memo->token_len = coap_get_token_len(pdu);
             if (memo->token_len) {
                 memcpy(&memo->token[0], pdu->token, memo->token_len);
             }
+            _memo_index_add(memo);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -424,12 +485,14 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            _memo_index_remove(memo);
             memo->observer = NULL;
             memo           = NULL;
             _find_obs_memo(&memo, remote, NULL);
             if (memo == NULL) {
                 _find_observer(&observer, remote);
                 if (observer != NULL) {
+                    _obs_index_remove(observer);
                     observer->family = AF_UNSPEC;
                 }
             }
@@ -497,6 +560,129 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     return ret;
 }
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+/*
+ * Compares a resource path with the first len bytes of a request path.
+ */
+static int _path_cmp(const char *path, const char *uri, size_t len)
+{
+    int res = strncmp(path, uri, len);
+
+    /* a longer path sorts after its prefix */
+    if ((res == 0) && (path[len] != '\0')) {
+        res = 1;
+    }
+    return res;
+}
+
+/*
+ * Checks the resources with a path equal to the first len bytes of a request
+ * path for a method match.
+ *
+ * subtree_only[in] -- true to only check resources matching a subtree
+ * ret[in] -- result to return if no resource matches the method
+ * return as _request_matcher_default()
+ */
+static int _match_range(gcoap_listener_t *listener,
+                        const coap_resource_t **resource,
+                        const char *uri, size_t len, bool subtree_only,
+                        coap_method_flags_t method_flag, int ret)
+{
+    size_t lo = 0, hi = listener->resources_len;
+
+    /* find the first resource with a path not sorting before the request */
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (_path_cmp(listener->resources[mid].path, uri, len) < 0) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    for (; lo < listener->resources_len; lo++) {
+        *resource = &listener->resources[lo];
+
+        if (_path_cmp((*resource)->path, uri, len) != 0) {
+            break;
+        }
+        if (subtree_only && !((*resource)->methods & COAP_MATCH_SUBTREE)) {
+            continue;
+        }
+        if ((*resource)->methods & method_flag) {
+            return GCOAP_RESOURCE_FOUND;
+        }
+        ret = GCOAP_RESOURCE_WRONG_METHOD;
+    }
+    return ret;
+}
+
+/*
+ * Same as _request_matcher_default(), but uses a binary search on the
+ * ordered resources of the listener.
+ */
+static int _request_matcher_index(gcoap_listener_t *listener,
+                                  const coap_resource_t **resource,
+                                  const coap_pkt_t *pdu)
+{
+    char uri[CONFIG_NANOCOAP_URI_MAX];
+    int ret = GCOAP_RESOURCE_NO_PATH;
+
+    if (coap_get_uri_path(pdu, (uint8_t *)uri) <= 0) {
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+
+    coap_method_flags_t method_flag = coap_method2flag(
+        coap_get_code_detail(pdu));
+    size_t uri_len = strlen(uri);
+    uint64_t lens = _coap_state.subtree_lens;
+
+    /* resources matching a subtree of the path sort before the ones matching
+     * the path itself, so check prefixes of the path first */
+    for (size_t len = 0; (lens != 0) && (len < uri_len); len++, lens >>= 1) {
+        if (lens & 1) {
+            ret = _match_range(listener, resource, uri, len, true,
+                               method_flag, ret);
+            if (ret == GCOAP_RESOURCE_FOUND) {
+                return ret;
+            }
+        }
+    }
+    return _match_range(listener, resource, uri, uri_len, false,
+                        method_flag, ret);
+}
+
+/*
+ * Checks if the resources of a listener are ordered, so they can be searched
+ * by _request_matcher_index(), and records the path lengths of resources
+ * matching a subtree.
+ */
+static bool _index_resources(const gcoap_listener_t *listener)
+{
+    uint64_t subtree_lens = 0;
+
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        const coap_resource_t *resource = &listener->resources[i];
+
+        if ((i > 0) && (strcmp(resource[-1].path, resource->path) > 0)) {
+            DEBUG("gcoap: resources not ordered, can't index listener\n");
+            return false;
+        }
+        if (resource->methods & COAP_MATCH_SUBTREE) {
+            size_t len = strlen(resource->path);
+
+            if (len >= 64) {
+                DEBUG("gcoap: subtree path too long, can't index listener\n");
+                return false;
+            }
+            subtree_lens |= (uint64_t)1 << len;
+        }
+    }
+    _coap_state.subtree_lens |= subtree_lens;
+    return true;
+}
+#endif /* MODULE_GCOAP_INDEX */
+
 /*
  * Searches listener registrations for the resource matching the path in a PDU.
  *
@@ -642,6 +828,176 @@ static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t le
     return plen;
 }
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+/*
+ * Compares the entry in a slot of an indexed table with a key.
+ */
+typedef int (*_index_cmp_t)(unsigned slot, const void *key);
+
+/*
+ * Returns the position of the first entry in an index not sorting before key.
+ */
+static unsigned _index_bound(const uint16_t *index, unsigned num,
+                             _index_cmp_t cmp, const void *key)
+{
+    unsigned lo = 0, hi = num;
+
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (cmp(index[mid], key) < 0) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*
+ * Returns the slot of the entry equal to key, or -1 if not found.
+ */
+static int _index_find(const uint16_t *index, unsigned num,
+                       _index_cmp_t cmp, const void *key)
+{
+    unsigned pos = _index_bound(index, num, cmp, key);
+
+    if ((pos < num) && (cmp(index[pos], key) == 0)) {
+        return index[pos];
+    }
+    return -1;
+}
+
+static void _index_add(uint16_t *index, uint16_t *num, _index_cmp_t cmp,
+                       const void *key, unsigned slot)
+{
+    unsigned pos = _index_bound(index, *num, cmp, key);
+
+    memmove(&index[pos + 1], &index[pos], (*num - pos) * sizeof(index[0]));
+    index[pos] = slot;
+    (*num)++;
+}
+
+/*
+ * Removes a slot from an index, does nothing if it is not in the index.
+ */
+static void _index_remove(uint16_t *index, uint16_t *num, _index_cmp_t cmp,
+                          const void *key, unsigned slot)
+{
+    for (unsigned pos = _index_bound(index, *num, cmp, key);
+         (pos < *num) && (cmp(index[pos], key) == 0); pos++) {
+        if (index[pos] == slot) {
+            (*num)--;
+            memmove(&index[pos], &index[pos + 1],
+                    (*num - pos) * sizeof(index[0]));
+            return;
+        }
+    }
+}
+
+static int _observer_cmp(unsigned slot, const void *key)
+{
+    const sock_udp_ep_t *a = &_coap_state.observers[slot];
+    const sock_udp_ep_t *b = key;
+
+    if (a->family != b->family) {
+        return (a->family < b->family) ? -1 : 1;
+    }
+    if (a->port != b->port) {
+        return (a->port < b->port) ? -1 : 1;
+    }
+    return memcmp(&a->addr, &b->addr, (a->family == AF_INET)
+                                      ? sizeof(a->addr.ipv4)
+                                      : sizeof(a->addr));
+}
+
+static int _memo_cmp(unsigned slot, const void *key)
+{
+    uintptr_t a = (uintptr_t)_coap_state.observe_memos[slot].resource;
+    uintptr_t b = (uintptr_t)key;
+
+    return (a == b) ? 0 : ((a < b) ? -1 : 1);
+}
+
+/* key of memos_token_index */
+typedef struct {
+    const sock_udp_ep_t *observer;
+    const uint8_t *token;               /* NULL to match any token */
+    unsigned token_len;
+} _memo_token_key_t;
+
+static int _memo_token_cmp(unsigned slot, const void *key)
+{
+    const gcoap_observe_memo_t *a = &_coap_state.observe_memos[slot];
+    const _memo_token_key_t *b = key;
+
+    if (a->observer != b->observer) {
+        return ((uintptr_t)a->observer < (uintptr_t)b->observer) ? -1 : 1;
+    }
+    if (b->token == NULL) {
+        return 0;
+    }
+    if (a->token_len != b->token_len) {
+        return (a->token_len < b->token_len) ? -1 : 1;
+    }
+    return memcmp(a->token, b->token, a->token_len);
+}
+#endif /* MODULE_GCOAP_INDEX */
+
+static void _obs_index_add(sock_udp_ep_t *observer)
+{
+#if IS_USED(MODULE_GCOAP_INDEX)
+    _index_add(_coap_state.observers_index, &_coap_state.observers_num,
+               _observer_cmp, observer, observer - _coap_state.observers);
+#else
+    (void)observer;
+#endif
+}
+
+static void _obs_index_remove(sock_udp_ep_t *observer)
+{
+#if IS_USED(MODULE_GCOAP_INDEX)
+    _index_remove(_coap_state.observers_index, &_coap_state.observers_num,
+                  _observer_cmp, observer, observer - _coap_state.observers);
+#else
+    (void)observer;
+#endif
+}
+
+static void _memo_index_add(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_INDEX)
+    _memo_token_key_t key = { memo->observer, memo->token, memo->token_len };
+    uint16_t num = _coap_state.memos_num;
+
+    _index_add(_coap_state.memos_token_index, &num, _memo_token_cmp, &key,
+               memo - _coap_state.observe_memos);
+    _index_add(_coap_state.memos_index, &_coap_state.memos_num, _memo_cmp,
+               memo->resource, memo - _coap_state.observe_memos);
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Removes a memo from the indices, must be called before its resource, observer
+ * or token changes.
+ */
+static void _memo_index_remove(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_INDEX)
+    _memo_token_key_t key = { memo->observer, memo->token, memo->token_len };
+    uint16_t num = _coap_state.memos_num;
+
+    _index_remove(_coap_state.memos_token_index, &num, _memo_token_cmp, &key,
+                  memo - _coap_state.observe_memos);
+    _index_remove(_coap_state.memos_index, &_coap_state.memos_num, _memo_cmp,
+                  memo->resource, memo - _coap_state.observe_memos);
+#else
+    (void)memo;
+#endif
+}
+
 /*
  * Find registered observer for a remote address and port.
  *
@@ -655,6 +1011,17 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 {
     int empty_slot = -1;
     *observer      = NULL;
+#if IS_USED(MODULE_GCOAP_INDEX)
+    int slot = _index_find(_coap_state.observers_index,
+                           _coap_state.observers_num, _observer_cmp, remote);
+    if (slot >= 0) {
+        *observer = &_coap_state.observers[slot];
+        return empty_slot;
+    }
+    if (_coap_state.observers_num == CONFIG_GCOAP_OBS_CLIENTS_MAX) {
+        return empty_slot;
+    }
+#endif
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_CLIENTS_MAX; i++) {
 
         if (_coap_state.observers[i].family == AF_UNSPEC) {
@@ -687,6 +1054,32 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
     sock_udp_ep_t *remote_observer = NULL;
     _find_observer(&remote_observer, remote);
 
+#if IS_USED(MODULE_GCOAP_INDEX)
+    /* memos with an empty token are only matched by remote */
+    if ((remote_observer != NULL) &&
+            ((pdu == NULL) || coap_get_token_len(pdu))) {
+        _memo_token_key_t key = {
+            .observer = remote_observer,
+            .token = (pdu) ? pdu->token : NULL,
+            .token_len = (pdu) ? coap_get_token_len(pdu) : 0,
+        };
+        int slot = _index_find(_coap_state.memos_token_index,
+                               _coap_state.memos_num, _memo_token_cmp, &key);
+        if (slot >= 0) {
+            *memo = &_coap_state.observe_memos[slot];
+            return empty_slot;
+        }
+    }
+    if (_coap_state.memos_num == CONFIG_GCOAP_OBS_REGISTRATIONS_MAX) {
+        return empty_slot;
+    }
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        if (_coap_state.observe_memos[i].observer == NULL) {
+            empty_slot = i;
+            break;
+        }
+    }
+#else
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer == NULL) {
             empty_slot = i;
@@ -710,6 +1103,7 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
             }
         }
     }
+#endif
     return empty_slot;
 }
 
@@ -723,6 +1117,13 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
+#if IS_USED(MODULE_GCOAP_INDEX)
+    int slot = _index_find(_coap_state.memos_index, _coap_state.memos_num,
+                           _memo_cmp, resource);
+    if (slot >= 0) {
+        *memo = &_coap_state.observe_memos[slot];
+    }
+#else
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
@@ -730,6 +1131,170 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
             break;
         }
     }
+#endif
+}
+
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+/*
+ * Find registered observe memo for a resource and a remote endpoint.
+ *
+ * memo[out] -- Registered observe memo, or NULL if not found
+ * resource[in] -- Resource to match
+ * remote[in] -- Endpoint to match
+ */
+static void _find_obs_memo_resource_remote(gcoap_observe_memo_t **memo,
+                                           const coap_resource_t *resource,
+                                           sock_udp_ep_t *remote)
+{
+    sock_udp_ep_t *observer;
+
+    *memo = NULL;
+    _find_observer(&observer, remote);
+    if (observer == NULL) {
+        return;
+    }
+#if IS_USED(MODULE_GCOAP_INDEX)
+    /* only the memos of the resource */
+    for (unsigned pos = _index_bound(_coap_state.memos_index,
+                                     _coap_state.memos_num, _memo_cmp, resource);
+         (pos < _coap_state.memos_num) &&
+         (_memo_cmp(_coap_state.memos_index[pos], resource) == 0); pos++) {
+        gcoap_observe_memo_t *m = &_coap_state.observe_memos[
+                                        _coap_state.memos_index[pos]];
+
+        if (m->observer == observer) {
+            *memo = m;
+            break;
+        }
+    }
+#else
+    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        if (_coap_state.observe_memos[i].observer == observer
+                && _coap_state.observe_memos[i].resource == resource) {
+            *memo = &_coap_state.observe_memos[i];
+            break;
+        }
+    }
+#endif
+}
+
+/*
+ * Sends a notification initialized by gcoap_obs_fanout_init() to the observer
+ * of a memo. The header hdr is moved next to the token of the observer, so
+ * the options and the payload stay in place.
+ *
+ * return true if the notification was sent
+ */
+static bool _fanout_memo(uint8_t *buf, size_t len, const coap_hdr_t *hdr,
+                         const gcoap_observe_memo_t *memo)
+{
+    size_t offset = GCOAP_TOKENLEN_MAX - memo->token_len;
+    coap_hdr_t obs_hdr = *hdr;
+
+    obs_hdr.ver_t_tkl = (hdr->ver_t_tkl & 0xf0) | memo->token_len;
+    obs_hdr.id = htons((uint16_t)atomic_fetch_add(
+                            &_coap_state.next_message_id, 1));
+    memcpy(&buf[offset], &obs_hdr, sizeof(obs_hdr));
+    memcpy(&buf[offset + sizeof(obs_hdr)], memo->token, memo->token_len);
+    return sock_udp_send(&_sock_udp, &buf[offset], len - offset,
+                         memo->observer) > 0;
+}
+
+/*
+ * Sends a notification initialized by gcoap_obs_fanout_init() to every
+ * observer of a resource.
+ *
+ * return number of observers the notification was sent to
+ */
+static size_t _fanout(uint8_t *buf, size_t len, const coap_resource_t *resource)
+{
+    coap_hdr_t hdr;
+    size_t count = 0;
+
+    memcpy(&hdr, buf, sizeof(hdr));
+#if IS_USED(MODULE_GCOAP_INDEX)
+    /* the memos of the resource are next to each other in memos_index */
+    for (unsigned pos = _index_bound(_coap_state.memos_index,
+                                     _coap_state.memos_num, _memo_cmp, resource);
+         (pos < _coap_state.memos_num) &&
+         (_memo_cmp(_coap_state.memos_index[pos], resource) == 0); pos++) {
+        if (_fanout_memo(buf, len, &hdr, &_coap_state.observe_memos[
+                                            _coap_state.memos_index[pos]])) {
+            count++;
+        }
+    }
+#else
+    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i];
+
+        if ((memo->observer == NULL) || (memo->resource != resource)) {
+            continue;
+        }
+        if (_fanout_memo(buf, len, &hdr, memo)) {
+            count++;
+        }
+    }
+#endif
+    return count;
+}
+
+/*
+ * Ends the rate limit interval of a resource. Sends the held back
+ * notification and starts a new interval, or lifts the rate limit. The rate
+ * limit is also lifted once the last observer of the resource is gone.
+ */
+static void _on_fanout_interval(void *arg)
+{
+    gcoap_obs_fanout_t *fanout = arg;
+    gcoap_observe_memo_t *memo;
+
+    mutex_lock(&_coap_state.lock);
+    _find_obs_memo_resource(&memo, fanout->resource);
+    if ((memo != NULL) && (fanout->pending_len > 0)) {
+        _fanout(fanout->pending, fanout->pending_len, fanout->resource);
+        fanout->pending_len = 0;
+        event_timeout_set(&fanout->interval_tmout,
+                          CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS * US_PER_MS);
+    }
+    else {
+        gcoap_obs_fanout_t **prev = &_coap_state.fanouts;
+
+        while (*prev != fanout) {
+            prev = &(*prev)->next;
+        }
+        *prev = fanout->next;
+        memarray_free(&_coap_state.fanout_pool, fanout);
+    }
+    mutex_unlock(&_coap_state.lock);
+}
+#endif /* MODULE_GCOAP_OBS_FANOUT */
+
+/*
+ * Initializes a notification with the given token.
+ *
+ * return GCOAP_OBS_INIT_OK on success, GCOAP_OBS_INIT_ERR on error
+ */
+static int _obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                     uint8_t *token, size_t token_len)
+{
+    pdu->hdr       = (coap_hdr_t *)buf;
+    uint16_t msgid = (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
+    ssize_t hdrlen = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, token, token_len,
+                                    COAP_CODE_CONTENT, msgid);
+
+    if (hdrlen > 0) {
+        coap_pkt_init(pdu, buf, len, hdrlen);
+
+        uint32_t now       = xtimer_now_usec();
+        pdu->observe_value = (now >> GCOAP_OBS_TICK_EXPONENT) & 0xFFFFFF;
+        coap_opt_add_uint(pdu, COAP_OPT_OBSERVE, pdu->observe_value);
+
+        return GCOAP_OBS_INIT_OK;
+    }
+    else {
+        /* reason for negative hdrlen is not defined, so we also are vague */
+        return GCOAP_OBS_INIT_ERR;
+    }
 }
 
 /*
@@ -750,6 +1315,10 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+    memarray_init(&_coap_state.fanout_pool, _coap_state.fanout_bufs,
+                  sizeof(gcoap_obs_fanout_t), CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX);
+#endif
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -771,6 +1340,11 @@ void gcoap_register_listener(gcoap_listener_t *listener)
 
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
+#if IS_USED(MODULE_GCOAP_INDEX)
+        if (_index_resources(listener)) {
+            listener->request_matcher = _request_matcher_index;
+        }
+#endif
     }
 }
 
@@ -950,24 +1524,7 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         return GCOAP_OBS_INIT_UNUSED;
     }
 
-    pdu->hdr       = (coap_hdr_t *)buf;
-    uint16_t msgid = (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
-    ssize_t hdrlen = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, &memo->token[0],
-                                    memo->token_len, COAP_CODE_CONTENT, msgid);
-
-    if (hdrlen > 0) {
-        coap_pkt_init(pdu, buf, len, hdrlen);
-
-        uint32_t now       = xtimer_now_usec();
-        pdu->observe_value = (now >> GCOAP_OBS_TICK_EXPONENT) & 0xFFFFFF;
-        coap_opt_add_uint(pdu, COAP_OPT_OBSERVE, pdu->observe_value);
-
-        return GCOAP_OBS_INIT_OK;
-    }
-    else {
-        /* reason for negative hdrlen is not defined, so we also are vague */
-        return GCOAP_OBS_INIT_ERR;
-    }
+    return _obs_init(pdu, buf, len, &memo->token[0], memo->token_len);
 }
 
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
@@ -986,6 +1543,70 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     }
 }
 
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+int gcoap_obs_fanout_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                          const coap_resource_t *resource)
+{
+    /* placeholder for the token of each observer, see _fanout() */
+    static uint8_t token[GCOAP_TOKENLEN_MAX];
+    gcoap_observe_memo_t *memo = NULL;
+
+    _find_obs_memo_resource(&memo, resource);
+    if (memo == NULL) {
+        /* Unique return value to specify there is not an observer */
+        return GCOAP_OBS_INIT_UNUSED;
+    }
+    return _obs_init(pdu, buf, len, token, sizeof(token));
+}
+
+ssize_t gcoap_obs_fanout_send(uint8_t *buf, size_t len,
+                              const coap_resource_t *resource)
+{
+    gcoap_obs_fanout_t *fanout;
+    ssize_t count;
+
+    assert(len >= GCOAP_HEADER_MAXLEN);
+    /* entries are removed by _on_fanout_interval() under the lock */
+    mutex_lock(&_coap_state.lock);
+    fanout = _coap_state.fanouts;
+    while ((fanout != NULL) && (fanout->resource != resource)) {
+        fanout = fanout->next;
+    }
+    if (fanout != NULL) {
+        /* hold back the notification until the end of the interval */
+        if (len <= sizeof(fanout->pending)) {
+            memcpy(fanout->pending, buf, len);
+            fanout->pending_len = len;
+            mutex_unlock(&_coap_state.lock);
+            return 0;
+        }
+        /* too large to hold back, so send it now and drop the older one */
+        DEBUG("gcoap: notification too large to hold back\n");
+        fanout->pending_len = 0;
+    }
+    else if ((fanout = memarray_alloc(&_coap_state.fanout_pool)) != NULL) {
+        /* start an interval for the resource */
+        fanout->resource = resource;
+        fanout->pending_len = 0;
+        fanout->next = _coap_state.fanouts;
+        _coap_state.fanouts = fanout;
+        event_callback_init(&fanout->interval_cb, _on_fanout_interval, fanout);
+        event_timeout_init(&fanout->interval_tmout, &_queue,
+                           &fanout->interval_cb.super);
+        event_timeout_set(&fanout->interval_tmout,
+                          CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS * US_PER_MS);
+    }
+    else {
+        DEBUG("gcoap: no buffer to rate limit notifications\n");
+        mutex_unlock(&_coap_state.lock);
+        return -ENOMEM;
+    }
+    count = _fanout(buf, len, resource);
+    mutex_unlock(&_coap_state.lock);
+    return count;
+}
+#endif /* MODULE_GCOAP_OBS_FANOUT */
+
 uint8_t gcoap_op_state(void)
 {
     uint8_t count = 0;
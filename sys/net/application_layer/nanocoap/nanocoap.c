@@ -42,6 +42,8 @@
 /** @} */
 
 static int _decode_value(unsigned val, uint8_t **pkt_pos_ptr, uint8_t *pkt_end);
+static int _find_option_value(const coap_pkt_t *pkt, unsigned opt_num,
+                              uint8_t **value);
 static uint32_t _decode_uint(uint8_t *pkt_pos, unsigned nbytes);
 static size_t _encode_uint(uint32_t *val);
 
@@ -128,6 +130,10 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
 
                 optpos->opt_num = option_nr;
                 optpos->offset = (uintptr_t)option_start - (uintptr_t)hdr;
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+                optpos->len = option_len;
+                optpos->hdr_len = pkt_pos - option_start;
+#endif
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
                 optpos++;
                 option_count++;
@@ -176,8 +182,40 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
     return res;
 }
 
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+/*
+ * Find the first option with a number in the options array, which is
+ * ordered by option number
+ *
+ * return         options array entry, or NULL if not found
+ */
+static const coap_optpos_t *_find_optpos(const coap_pkt_t *pkt, unsigned opt_num)
+{
+    unsigned lo = 0, hi = pkt->options_len;
+
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (pkt->options[mid].opt_num < opt_num) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if ((lo < pkt->options_len) && (pkt->options[lo].opt_num == opt_num)) {
+        return &pkt->options[lo];
+    }
+    return NULL;
+}
+#endif
+
 uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
 {
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+    const coap_optpos_t *optpos = _find_optpos(pkt, opt_num);
+
+    return (optpos) ? (uint8_t *)pkt->hdr + optpos->offset : NULL;
+#else
     const coap_optpos_t *optpos = pkt->options;
     unsigned opt_count = pkt->options_len;
 
@@ -188,6 +226,7 @@ uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
         optpos++;
     }
     return NULL;
+#endif
 }
 
 /*
@@ -219,47 +258,70 @@ static uint8_t *_parse_option(const coap_pkt_t *pkt,
     return pkt_pos;
 }
 
-ssize_t coap_opt_get_opaque(const coap_pkt_t *pkt, unsigned opt_num, uint8_t **value)
+/*
+ * Find the value of the first option with a number
+ *
+ * pkt[in]        coap_pkt_t for buffer
+ * opt_num[in]    option number
+ * value[out]     start of option value
+ *
+ * return         length of option value
+ * return         -ENOENT if option not found
+ * return         -EINVAL if option can't be decoded
+ */
+static int _find_option_value(const coap_pkt_t *pkt, unsigned opt_num,
+                              uint8_t **value)
 {
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+    const coap_optpos_t *optpos = _find_optpos(pkt, opt_num);
+    if (!optpos) {
+        return -ENOENT;
+    }
+
+    *value = (uint8_t *)pkt->hdr + optpos->offset + optpos->hdr_len;
+    return optpos->len;
+#else
     uint8_t *start = coap_find_option(pkt, opt_num);
     if (!start) {
         return -ENOENT;
     }
 
     uint16_t delta;
-    int len;
+    int len = -EINVAL;
 
     *value = _parse_option(pkt, start, &delta, &len);
-    if (!*value) {
+    if (!*value || (len < 0)) {
         return -EINVAL;
     }
 
     return len;
+#endif
+}
+
+ssize_t coap_opt_get_opaque(const coap_pkt_t *pkt, unsigned opt_num, uint8_t **value)
+{
+    return _find_option_value(pkt, opt_num, value);
 }
 
 int coap_opt_get_uint(const coap_pkt_t *pkt, uint16_t opt_num, uint32_t *target)
 {
     assert(target);
 
-    uint8_t *opt_pos = coap_find_option(pkt, opt_num);
-    if (opt_pos) {
-        uint16_t delta;
-        int option_len = 0;
-        uint8_t *pkt_pos = _parse_option(pkt, opt_pos, &delta, &option_len);
-        if (option_len >= 0) {
-            if (option_len > 4) {
-                DEBUG("nanocoap: uint option with len > 4 (unsupported).\n");
-                return -ENOSPC;
-            }
-            *target = _decode_uint(pkt_pos, option_len);
-            return 0;
-        }
-        else {
-            DEBUG("nanocoap: discarding packet with invalid option length.\n");
-            return -EBADMSG;
-        }
+    uint8_t *pkt_pos;
+    int option_len = _find_option_value(pkt, opt_num, &pkt_pos);
+    if (option_len == -ENOENT) {
+        return -ENOENT;
+    }
+    else if (option_len < 0) {
+        DEBUG("nanocoap: discarding packet with invalid option length.\n");
+        return -EBADMSG;
     }
-    return -ENOENT;
+    else if (option_len > 4) {
+        DEBUG("nanocoap: uint option with len > 4 (unsupported).\n");
+        return -ENOSPC;
+    }
+    *target = _decode_uint(pkt_pos, option_len);
+    return 0;
 }
 
 uint8_t *coap_iterate_option(const coap_pkt_t *pkt, uint8_t **optpos,
@@ -281,13 +343,10 @@ uint8_t *coap_iterate_option(const coap_pkt_t *pkt, uint8_t **optpos,
 
 unsigned coap_get_content_type(coap_pkt_t *pkt)
 {
-    uint8_t *opt_pos = coap_find_option(pkt, COAP_OPT_CONTENT_FORMAT);
+    uint8_t *pkt_pos;
+    int option_len = _find_option_value(pkt, COAP_OPT_CONTENT_FORMAT, &pkt_pos);
     unsigned content_type = COAP_FORMAT_NONE;
-    if (opt_pos) {
-        uint16_t delta;
-        int option_len = 0;
-        uint8_t *pkt_pos = _parse_option(pkt, opt_pos, &delta, &option_len);
-
+    if (option_len >= 0) {
         if (option_len == 0) {
             content_type = 0;
         } else if (option_len == 1) {
@@ -361,18 +420,14 @@ ssize_t coap_opt_get_string(const coap_pkt_t *pkt, uint16_t optnum,
 
 int coap_get_blockopt(coap_pkt_t *pkt, uint16_t option, uint32_t *blknum, unsigned *szx)
 {
-    uint8_t *optpos = coap_find_option(pkt, option);
-    if (!optpos) {
+    uint8_t *data_start;
+    int option_len = _find_option_value(pkt, option, &data_start);
+    if (option_len == -ENOENT) {
         *blknum = 0;
         *szx = 0;
         return -1;
     }
-
-    int option_len;
-    uint16_t delta;
-
-    uint8_t *data_start = _parse_option(pkt, optpos, &delta, &option_len);
-    if (!data_start) {
+    else if (option_len < 0) {
         DEBUG("nanocoap: invalid start data\n");
         return -1;
     }
@@ -822,6 +877,10 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, const uint8_t *val
 
     pkt->options[pkt->options_len].opt_num = optnum;
     pkt->options[pkt->options_len].offset = pkt->payload - (uint8_t *)pkt->hdr;
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+    pkt->options[pkt->options_len].len = val_len;
+    pkt->options[pkt->options_len].hdr_len = optlen - val_len;
+#endif
     pkt->options_len++;
     pkt->payload += optlen;
     pkt->payload_len -= optlen;
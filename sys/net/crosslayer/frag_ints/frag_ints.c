@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/frag_ints.h"
+
+/* returns the index of the first interval that does not end before start,
+ * i.e. the only interval that may be adjacent to or overlap with start */
+static unsigned _find(const frag_ints_t *ints, uint16_t start)
+{
+    unsigned lo = 0, hi = ints->numof;
+
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+
+        if (ints->ints[mid].end < start) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static int _add_exact(frag_ints_t *ints, uint16_t start, uint16_t end)
+{
+    frag_ints_int_t *arr = ints->ints;
+    unsigned i;
+
+    if (start >= end) {
+        return -EINVAL;
+    }
+    i = _find(ints, start);
+    if ((i < ints->numof) && (arr[i].end == start)) {
+        /* adjacent intervals do not overlap */
+        i++;
+    }
+    /* arr[i] ends after start */
+    if ((i < ints->numof) && (arr[i].start < end)) {
+        return ((arr[i].start == start) && (arr[i].end == end)) ? -EEXIST
+                                                                : -EINVAL;
+    }
+    if (ints->numof >= CONFIG_FRAG_INTS_NUMOF) {
+        return -ENOBUFS;
+    }
+    memmove(&arr[i + 1], &arr[i], (ints->numof - i) * sizeof(arr[0]));
+    arr[i].start = start;
+    arr[i].end = end;
+    ints->numof++;
+    ints->frags++;
+    return 0;
+}
+
+int frag_ints_add(frag_ints_t *ints, uint16_t start, uint16_t end)
+{
+    frag_ints_int_t *arr = ints->ints;
+    unsigned i, next;
+    bool left, right;
+
+    if (ints->exact) {
+        return _add_exact(ints, start, end);
+    }
+    if (start > end) {
+        return -EINVAL;
+    }
+    if (start == end) {
+        return -EEXIST;
+    }
+    i = _find(ints, start);
+    next = i;
+    left = (i < ints->numof) && (arr[i].end == start);
+    if (left) {
+        /* the interval after arr[i] starts behind start, as intervals are
+         * not adjacent */
+        next++;
+    }
+    else if ((i < ints->numof) && (arr[i].start <= start)) {
+        /* arr[i] contains start */
+        return (end <= arr[i].end) ? -EEXIST : -EINVAL;
+    }
+    /* arr[next] starts after start */
+    if ((next < ints->numof) && (arr[next].start < end)) {
+        return -EINVAL;
+    }
+    right = (next < ints->numof) && (arr[next].start == end);
+    if (left && right) {
+        /* interval closes the gap between arr[i] and arr[next] */
+        arr[i].end = arr[next].end;
+        memmove(&arr[next], &arr[next + 1],
+                (ints->numof - next - 1) * sizeof(arr[0]));
+        ints->numof--;
+    }
+    else if (left) {
+        arr[i].end = end;
+    }
+    else if (right) {
+        arr[next].start = start;
+    }
+    else {
+        if (ints->numof >= CONFIG_FRAG_INTS_NUMOF) {
+            return -ENOBUFS;
+        }
+        memmove(&arr[next + 1], &arr[next],
+                (ints->numof - next) * sizeof(arr[0]));
+        arr[next].start = start;
+        arr[next].end = end;
+        ints->numof++;
+    }
+    ints->frags++;
+    return 0;
+}
+
+bool frag_ints_complete(const frag_ints_t *ints, uint16_t size)
+{
+    const frag_ints_int_t *arr = ints->ints;
+
+    if ((ints->numof == 0) || (arr[0].start != 0) ||
+        (arr[ints->numof - 1].end != size)) {
+        return false;
+    }
+    /* only intervals added with frag_ints_init_exact() can be adjacent */
+    for (unsigned i = 1; i < ints->numof; i++) {
+        if (arr[i - 1].end != arr[i].start) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** @} */
@@ -14,12 +14,46 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+
+#include "architecture.h"
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if ARCHITECTURE_WORD_BITS >= 32
+/* Sums up len / 8 * 8 bytes of buf as 32-bit words in host byte order. As the
+ * one's complement sum is independent of the byte order (RFC 1071), it is
+ * only swapped once at the end. Returns the sum of the 16-bit words in network
+ * byte order, folded to 16 bit. */
+static uint32_t _sum_wide(const uint8_t *buf, uint16_t len)
+{
+    uint64_t acc = 0;
+
+    for (; len >= 8; buf += 8, len -= 8) {
+        uint32_t a, b;
+
+        /* buf is not necessarily aligned */
+        memcpy(&a, buf, sizeof(a));
+        memcpy(&b, buf + sizeof(a), sizeof(b));
+        acc += a;
+        acc += b;
+    }
+
+    /* len is 16 bit, so at most 2^14 words were added */
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+
+    uint32_t csum = (acc & 0xffff) + (acc >> 16);
+
+    csum = (csum & 0xffff) + (csum >> 16);
+    return ntohs(csum);
+}
+#endif
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -45,6 +79,17 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
+#if ARCHITECTURE_WORD_BITS >= 32
+    if (len >= 8) {
+        uint16_t wide_len = len & ~0x7U;
+
+        csum += _sum_wide(buf, wide_len);
+        buf += wide_len;
+        len -= wide_len;
+        accum_len += wide_len;
+    }
+#endif
+
     for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
         csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
                                                     /* and add them */
@@ -26,6 +26,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+#include "net/gnrc/netif/hdr.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -82,6 +85,53 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+/* sends cmd with pkt to a single registry entry, consumes one reference
+ * to pkt on error */
+static void _dispatch_to(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                         gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETIF_RX_BATCH)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+        case GNRC_NETREG_TYPE_RX_BATCH:
+#endif
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    if (status != 0) {
+        gnrc_pktbuf_release_error(pkt, status);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -93,46 +143,125 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
+            _dispatch_to(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    return numof;
+}
+
+/* number of messages passed to msg_send_many() at once */
+#define _DISPATCH_MANY_CHUNK    (8U)
+
+/* sends cmd with each of pkts to a thread, consumes one reference to each
+ * packet that could not be sent */
+static void _send_many(kernel_pid_t pid, uint16_t cmd, gnrc_pktsnip_t **pkts,
+                       unsigned num)
+{
+    msg_t msgs[_DISPATCH_MANY_CHUNK];
+
+    while (num > 0) {
+        unsigned chunk = (num < _DISPATCH_MANY_CHUNK) ? num
+                                                      : _DISPATCH_MANY_CHUNK;
+        int sent;
+
+        for (unsigned i = 0; i < chunk; i++) {
+            msgs[i].type = cmd;
+            msgs[i].content.ptr = pkts[i];
+        }
+        sent = msg_send_many(msgs, chunk, pid);
+        if (sent < (int)chunk) {
+            DEBUG("gnrc_netapi: dropped %u messages to %" PRIkernel_pid "\n",
+                  chunk - ((sent < 0) ? 0 : sent), pid);
+        }
+        for (unsigned i = (sent < 0) ? 0 : sent; i < chunk; i++) {
+            /* unable to dispatch packet */
+            gnrc_pktbuf_release_error(pkts[i], EIO);
+        }
+        pkts += chunk;
+        num -= chunk;
+    }
+}
+
+int gnrc_netapi_dispatch_many(gnrc_nettype_t type, uint32_t demux_ctx,
+                              uint16_t cmd, gnrc_pktsnip_t **pkts,
+                              unsigned num)
+{
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof != 0) {
+        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+        for (unsigned i = 0; i < num; i++) {
+            gnrc_pktbuf_hold(pkts[i], numof - 1);
+        }
+        while (sendto) {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
-            }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
+            if (sendto->type != GNRC_NETREG_TYPE_DEFAULT) {
+                for (unsigned i = 0; i < num; i++) {
+                    _dispatch_to(sendto, cmd, pkts[i]);
+                }
+                sendto = gnrc_netreg_getnext(sendto);
+                continue;
             }
 #endif
+            _send_many(sendto->target.pid, cmd, pkts, num);
             sendto = gnrc_netreg_getnext(sendto);
         }
     }
 
     return numof;
 }
+
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+static void _batch_hold(gnrc_pktsnip_t *pkts)
+{
+    for (gnrc_pktsnip_t *pkt = pkts; pkt;
+         pkt = gnrc_netif_hdr_rx_batch_next(pkt)) {
+        gnrc_pktbuf_hold(pkt, 1);
+    }
+}
+
+static void _batch_release_error(gnrc_pktsnip_t *pkts, uint32_t err)
+{
+    while (pkts) {
+        /* the link is stored in the packet, so fetch it before releasing */
+        gnrc_pktsnip_t *next = gnrc_netif_hdr_rx_batch_next(pkts);
+
+        gnrc_pktbuf_release_error(pkts, err);
+        pkts = next;
+    }
+}
+
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkts)
+{
+    int numof = gnrc_netreg_num(type, demux_ctx);
+    gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+    /* every subscriber gets its own reference, the reference of the caller
+     * keeps the links of the batch valid until all subscribers got it */
+    while (sendto) {
+        if (sendto->type == GNRC_NETREG_TYPE_RX_BATCH) {
+            _batch_hold(pkts);
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkts,
+                                       GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+                /* unable to dispatch batch */
+                _batch_release_error(pkts, EIO);
+            }
+        }
+        else {
+            for (gnrc_pktsnip_t *pkt = pkts; pkt;
+                 pkt = gnrc_netif_hdr_rx_batch_next(pkt)) {
+                gnrc_pktbuf_hold(pkt, 1);
+                _dispatch_to(sendto, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
+            }
+        }
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+    _batch_release_error(pkts, GNRC_NETERR_SUCCESS);
+
+    return numof;
+}
+#endif
@@ -42,6 +42,7 @@
 #endif
 
 #include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif/internal.h"
 
 #define ENABLE_DEBUG 0
@@ -1235,7 +1236,8 @@ static void _configure_netdev(netdev_t *dev)
     if (res < 0) {
         DEBUG("gnrc_netif: enable NETOPT_RX_END_IRQ failed: %d\n", res);
     }
-    if (IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)) {
+    if (IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_NETSTATS_NEIGHBOR) ||
+        IS_USED(MODULE_GNRC_NETIF_PKTQ)) {
         res = dev->driver->set(dev, NETOPT_TX_END_IRQ, &enable, sizeof(enable));
         if (res < 0) {
             DEBUG("gnrc_netif: enable NETOPT_TX_END_IRQ failed: %d\n", res);
@@ -1372,6 +1374,29 @@ void gnrc_netif_default_init(gnrc_netif_t *netif)
 
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static void _rx_batch_flush(gnrc_netif_t *netif);
+#endif
+
+/**
+ * @brief   Call the ISR handler of the device and pass up the packets received
+ *          by it
+ *
+ * @param[in]   netif   the network interface
+ */
+static void _isr(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    /* packets received within one call of the ISR handler form a batch */
+    netif->rx_batch_isr = true;
+    netif->dev->driver->isr(netif->dev);
+    netif->rx_batch_isr = false;
+    _rx_batch_flush(netif);
+#else
+    netif->dev->driver->isr(netif->dev);
+#endif
+}
+
 #if IS_USED(MODULE_GNRC_NETIF_EVENTS)
 /**
  * @brief   Call the ISR handler from an event
@@ -1381,7 +1406,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
-    netif->dev->driver->isr(netif->dev);
+    _isr(netif);
 }
 #endif
 
@@ -1472,6 +1497,48 @@ static void _send_queued_pkt(gnrc_netif_t *netif)
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 }
 
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+static void _nb_record(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr = pkt->data;
+
+    gnrc_netif_acquire(netif);
+    if ((pkt->type != GNRC_NETTYPE_NETIF) ||
+        (hdr->flags &
+         (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST))) {
+        netstats_nb_record(&netif->neighbors, NULL, 0);
+    }
+    else {
+        netstats_nb_record(&netif->neighbors, gnrc_netif_hdr_get_dst_addr(hdr),
+                           hdr->dst_l2addr_len);
+    }
+    gnrc_netif_release(netif);
+}
+
+static void _nb_update_tx(gnrc_netif_t *netif, netstats_nb_result_t result)
+{
+    uint8_t retries = 0;
+
+    if (result != NETSTATS_NB_BUSY) {
+        /* not every device supports this, assume no retransmissions then */
+        if (netif->dev->driver->get(netif->dev, NETOPT_TX_RETRIES_NEEDED,
+                                    &retries, sizeof(retries)) < 0) {
+            retries = 0;
+        }
+    }
+    gnrc_netif_acquire(netif);
+    netstats_nb_update_tx(&netif->neighbors, result, retries);
+    gnrc_netif_release(netif);
+}
+
+static void _nb_drop_last(gnrc_netif_t *netif)
+{
+    gnrc_netif_acquire(netif);
+    netstats_nb_drop_last(&netif->neighbors);
+    gnrc_netif_release(netif);
+}
+#endif /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
+
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
     (void)push_back; /* only used with IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -1497,6 +1564,9 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
      * layer implementations in case `gnrc_netif_pktq` is included */
     gnrc_pktbuf_hold(pkt, 1);
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+    _nb_record(netif, pkt);
+#endif /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
     res = netif->ops->send(netif, pkt);
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     if (res == -EBUSY) {
@@ -1508,6 +1578,11 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
          * could run into the risk of overriding the received packet on send
          * Rather, queue the packet within the netif now and try to send them
          * again after the device completed its busy state. */
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+        /* frame is recorded again when it is actually sent, frames sent
+         * before may still await their status */
+        _nb_drop_last(netif);
+#endif /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
         if (push_back) {
             put_res = gnrc_netif_pktq_push_back(netif, pkt);
         }
@@ -1532,6 +1607,10 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     if (res < 0) {
         DEBUG("gnrc_netif: error sending packet %p (code: %i)\n",
               (void *)pkt, res);
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+        /* device will not report a status for this frame */
+        _nb_drop_last(netif);
+#endif /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
     }
 #ifdef MODULE_NETSTATS_L2
     else {
@@ -1585,6 +1664,9 @@ static void *_gnrc_netif_thread(void *args)
 #endif
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+    netstats_nb_init(&netif->neighbors);
 #endif
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
@@ -1609,7 +1691,7 @@ static void *_gnrc_netif_thread(void *args)
 #endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
             case NETDEV_MSG_TYPE_EVENT:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
-                dev->driver->isr(dev);
+                _isr(netif);
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
@@ -1682,6 +1764,64 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static void _rx_batch_flush(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkts = netif->rx_batch;
+
+    if (pkts == NULL) {
+        assert((netif->rx_batch_last == NULL) && (netif->rx_batch_len == 0));
+        return;
+    }
+    DEBUG("gnrc_netif: passing on batch of %u packets\n",
+          (unsigned)netif->rx_batch_len);
+    /* the batch ends with the last packet, whatever was linked before */
+    ((gnrc_netif_hdr_t *)netif->rx_batch_last->data)->rx_batch_next = NULL;
+    netif->rx_batch = NULL;
+    netif->rx_batch_last = NULL;
+    netif->rx_batch_len = 0;
+    /* packets no one is interested in are released by netapi */
+    if (!gnrc_netapi_dispatch_receive_batch(pkts->type,
+                                            GNRC_NETREG_DEMUX_CTX_ALL, pkts)) {
+        DEBUG("gnrc_netif: unable to forward packets of type %i\n",
+              pkts->type);
+    }
+}
+
+static void _rx_batch_add(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_hdr = gnrc_pktsnip_search_type(pkt,
+                                                         GNRC_NETTYPE_NETIF);
+
+    if (netif_hdr == NULL) {
+        /* packet can't be linked into a batch, so pass it on alone but keep
+         * the order of packets */
+        _rx_batch_flush(netif);
+        _pass_on_packet(pkt);
+        return;
+    }
+    if ((netif->rx_batch != NULL) && (netif->rx_batch->type != pkt->type)) {
+        /* a batch is dispatched to the subscribers of a single type */
+        _rx_batch_flush(netif);
+    }
+    ((gnrc_netif_hdr_t *)netif_hdr->data)->rx_batch_next = NULL;
+    if (netif->rx_batch == NULL) {
+        netif->rx_batch = pkt;
+    }
+    else {
+        ((gnrc_netif_hdr_t *)netif->rx_batch_last->data)->rx_batch_next = pkt;
+    }
+    netif->rx_batch_last = netif_hdr;
+    netif->rx_batch_len++;
+    /* outside of the ISR handler, no further packets are received before
+     * the next interrupt, so don't hold back the packet until then */
+    if (!netif->rx_batch_isr ||
+        (netif->rx_batch_len >= CONFIG_GNRC_NETIF_RX_BATCH_SIZE)) {
+        _rx_batch_flush(netif);
+    }
+}
+#endif
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *) dev->context;
@@ -1710,11 +1850,22 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+                    _rx_batch_add(netif, pkt);
+#else
                     _pass_on_packet(pkt);
+#endif
                 }
                 break;
-#if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_NETSTATS_NEIGHBOR) || \
+    IS_USED(MODULE_GNRC_NETIF_PKTQ)
+            case NETDEV_EVENT_TX_COMPLETE_DATA_PENDING:
             case NETDEV_EVENT_TX_COMPLETE:
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+                /* must be done before the next frame is sent, as that
+                 * resets the retransmission count of the device */
+                _nb_update_tx(netif, NETSTATS_NB_SUCCESS);
+#endif  /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
                 /* send packet previously queued within netif due to the lower
                  * layer being busy.
                  * Further packets will be sent on later TX_COMPLETE or
@@ -1726,9 +1877,19 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 netif->stats.tx_success++;
 #endif  /* IS_USED(MODULE_NETSTATS_L2) */
                 break;
-#endif  /* IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-#if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+            case NETDEV_EVENT_TX_NOACK:
+                _nb_update_tx(netif, NETSTATS_NB_NOACK);
+                _send_queued_pkt(netif);
+#if IS_USED(MODULE_NETSTATS_L2)
+                netif->stats.tx_failed++;
+#endif  /* IS_USED(MODULE_NETSTATS_L2) */
+                break;
+#endif  /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
             case NETDEV_EVENT_TX_MEDIUM_BUSY:
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR)
+                _nb_update_tx(netif, NETSTATS_NB_BUSY);
+#endif  /* IS_USED(MODULE_NETSTATS_NEIGHBOR) */
                 /* send packet previously queued within netif due to the lower
                  * layer being busy.
                  * Further packets will be sent on later TX_COMPLETE or
@@ -1740,7 +1901,8 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 netif->stats.tx_failed++;
 #endif  /* IS_USED(MODULE_NETSTATS_L2) */
                 break;
-#endif  /* IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#endif  /* IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_NETSTATS_NEIGHBOR) ||
+         * IS_USED(MODULE_GNRC_NETIF_PKTQ) */
             default:
                 DEBUG("gnrc_netif: warning: unhandled event %u.\n", event);
         }
@@ -42,8 +42,13 @@ void gnrc_netreg_init(void)
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
-# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-    bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
+# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+     defined(MODULE_GNRC_NETIF_RX_BATCH)
+    bool uses_ipc = (entry->type == GNRC_NETREG_TYPE_DEFAULT);
+#  if defined(MODULE_GNRC_NETIF_RX_BATCH)
+    uses_ipc |= (entry->type == GNRC_NETREG_TYPE_RX_BATCH);
+#  endif
+    bool has_msg_q = !uses_ipc ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
 # else
     bool has_msg_q = thread_has_msg_queue(thread_get(entry->target.pid));
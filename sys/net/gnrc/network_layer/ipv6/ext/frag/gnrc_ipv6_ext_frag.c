@@ -14,6 +14,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdbool.h>
 
 #include "byteorder.h"
@@ -36,8 +37,6 @@
 
 static gnrc_ipv6_ext_frag_send_t _snd_bufs[CONFIG_GNRC_IPV6_EXT_FRAG_SEND_SIZE];
 static gnrc_ipv6_ext_frag_rbuf_t _rbuf[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
-static gnrc_ipv6_ext_frag_limits_t _limits_pool[CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE];
-static clist_node_t _free_limits;
 static xtimer_t _gc_xtimer;
 static msg_t _gc_msg = { .type = GNRC_IPV6_EXT_FRAG_RBUF_GC };
 static gnrc_ipv6_ext_frag_stats_t _stats;
@@ -53,7 +52,8 @@ typedef enum {
     FRAG_LIMITS_NEW = 0,        /**< limits are not present and do not overlap */
     FRAG_LIMITS_DUPLICATE,      /**< fragment limits are already present */
     FRAG_LIMITS_OVERLAP,        /**< limits overlap */
-    FRAG_LIMITS_FULL,           /**< no free gnrc_ipv6_ext_frag_limits_t object */
+    FRAG_LIMITS_FULL,           /**< too many fragments */
+    FRAG_LIMITS_EMPTY,          /**< fragment carries no data */
 } _limits_res_t;
 
 void gnrc_ipv6_ext_frag_init(void)
@@ -62,9 +62,6 @@ void gnrc_ipv6_ext_frag_init(void)
     memset(_rbuf, 0, sizeof(_rbuf));
 #endif
     _last_id = random_uint32();
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE; i++) {
-        clist_rpush(&_free_limits, (clist_node_t *)&_limits_pool[i]);
-    }
 }
 
 /*
@@ -434,6 +431,9 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         case FRAG_LIMITS_DUPLICATE:
             gnrc_pktbuf_release(pkt);
             return NULL;
+        case FRAG_LIMITS_EMPTY:
+            DEBUG("ipv6_ext_frag: fragment is empty\n");
+            goto error_exit;
         case FRAG_LIMITS_OVERLAP:
             DEBUG("ipv6_ext_frag: fragment overlaps with existing fragments\n");
             /* intentionally falls through */
@@ -586,10 +586,7 @@ gnrc_ipv6_ext_frag_rbuf_t *gnrc_ipv6_ext_frag_rbuf_get(ipv6_hdr_t *ipv6,
 void gnrc_ipv6_ext_frag_rbuf_free(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
     rbuf->ipv6 = NULL;
-    while (rbuf->limits.next != NULL) {
-        clist_node_t *tmp = clist_lpop(&rbuf->limits);
-        clist_rpush(&_free_limits, tmp);
-    }
+    frag_ints_init_exact(&rbuf->limits);
 }
 
 void gnrc_ipv6_ext_frag_rbuf_gc(void)
@@ -608,11 +605,6 @@ gnrc_ipv6_ext_frag_stats_t *gnrc_ipv6_ext_frag_stats(void)
     return (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) ? &_stats : NULL;
 }
 
-typedef struct {
-    uint16_t start;
-    uint16_t end;
-} _check_limits_t;
-
 static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
                               uint32_t id)
 {
@@ -620,56 +612,27 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
     rbuf->id = id;
     rbuf->pkt_len = 0;
     rbuf->last = 0;
-}
-
-static int _check_overlap(clist_node_t *node, void *arg)
-{
-    _check_limits_t *limits = arg;
-    gnrc_ipv6_ext_frag_limits_t *cur = (gnrc_ipv6_ext_frag_limits_t *)node;
-
-    return ((cur->start < limits->end) && (limits->start < cur->end));
-}
-
-static int _limits_cmp(clist_node_t *a, clist_node_t *b)
-{
-    gnrc_ipv6_ext_frag_limits_t *al = (gnrc_ipv6_ext_frag_limits_t *)a;
-    gnrc_ipv6_ext_frag_limits_t *bl = (gnrc_ipv6_ext_frag_limits_t *)b;
-
-    return (int)al->start - (int)bl->start;
+    frag_ints_init_exact(&rbuf->limits);
 }
 
 static _limits_res_t _overlaps(gnrc_ipv6_ext_frag_rbuf_t *rbuf,
                                unsigned offset, unsigned pkt_len)
 {
-    _check_limits_t limits = { .start = offset >> 3U,
-                               .end = (offset + pkt_len) >> 3U };
-    gnrc_ipv6_ext_frag_limits_t *res;
-
-    if (limits.start == limits.end) {
-        /* might happen with last fragment */
-        limits.end++;
-    }
-    res = (gnrc_ipv6_ext_frag_limits_t *)clist_foreach(&rbuf->limits,
-                                                       _check_overlap,
-                                                       &limits);
-    if (res == NULL) {
-        res = (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
-        if (res != NULL) {
-            res->start = limits.start;
-            res->end = limits.end;
-            clist_rpush(&rbuf->limits, (clist_node_t *)res);
-            clist_sort(&rbuf->limits, _limits_cmp);
+    if (pkt_len == 0) {
+        return FRAG_LIMITS_EMPTY;
+    }
+    /* see https://tools.ietf.org/html/rfc5722#section-4: only an exact
+     * duplicate of a fragment may be ignored, any other overlap discards the
+     * whole datagram */
+    switch (frag_ints_add(&rbuf->limits, offset, offset + pkt_len)) {
+        case 0:
             return FRAG_LIMITS_NEW;
-        }
-        else {
+        case -EEXIST:
+            return FRAG_LIMITS_DUPLICATE;
+        case -ENOBUFS:
             return FRAG_LIMITS_FULL;
-        }
-    }
-    else if ((res->start == limits.start) && (res->end == limits.end)) {
-        return FRAG_LIMITS_DUPLICATE;
-    }
-    else {
-        return FRAG_LIMITS_NEW;
+        default:
+            return FRAG_LIMITS_OVERLAP;
     }
 }
 
@@ -695,30 +658,19 @@ static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
 
 static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
-    assert(rbuf->limits.next != NULL);    /* this function is only called when
-                                           * at least one fragment was already
-                                           * added */
-    /* clist: first element is second element ;-) (from next of head) */
-    gnrc_ipv6_ext_frag_limits_t *ptr =
-            (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next->next;
-    if (rbuf->last && (ptr->start == 0)) {
-        gnrc_pktsnip_t *res = NULL;
-
-        /* last and first fragment were received, so check if everything
-         * in-between is there */
-        do {
-            gnrc_ipv6_ext_frag_limits_t *next = ptr->next;
-            if (ptr->end < next->start) {
-                return NULL;
-            }
-            ptr = next;
-        } while (((clist_node_t *)ptr) != rbuf->limits.next);
-        res = rbuf->pkt;
+    assert(rbuf->limits.numof > 0);   /* this function is only called when
+                                       * at least one fragment was already
+                                       * added */
+    /* once the last fragment was received, rbuf->pkt spans the whole
+     * fragmentable part */
+    if (rbuf->last && frag_ints_complete(&rbuf->limits, rbuf->pkt->size)) {
+        gnrc_pktsnip_t *res = rbuf->pkt;
+
         /* rewrite length */
         rbuf->ipv6->len = byteorder_htons(rbuf->pkt_len);
         rbuf->pkt = NULL;
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
-            _stats.fragments += clist_count(&rbuf->limits);
+            _stats.fragments += rbuf->limits.frags;
             _stats.datagrams++;
         }
         gnrc_ipv6_ext_frag_rbuf_free(rbuf);
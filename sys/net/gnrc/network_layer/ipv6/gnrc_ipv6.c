@@ -183,6 +183,11 @@ static void *_event_loop(void *args)
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
     gnrc_ipv6_ext_frag_init();
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    /* take packets from the network interfaces in batches */
+    gnrc_netreg_entry_init_rx_batch(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                    thread_getpid());
+#endif
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
 
@@ -200,6 +205,18 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (gnrc_pktsnip_t *pkt = msg.content.ptr, *next; pkt;
+                     pkt = next) {
+                    /* fetch link before the packet is handed over */
+                    next = gnrc_netif_hdr_rx_batch_next(pkt);
+                    _receive(pkt);
+                }
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
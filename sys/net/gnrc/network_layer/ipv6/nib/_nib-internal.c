@@ -26,6 +26,7 @@
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
 #include "random.h"
+#include "bitarithm.h"
 
 #include "_nib-internal.h"
 #include "_nib-router.h"
@@ -46,6 +47,48 @@ static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+/**
+ * @brief   Node of the off-link entry trie
+ *
+ * The first @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF nodes of _offl_trie belong to
+ * the entry of the same index in _dsts, the rest are glue nodes that only
+ * branch at bit _offl_trie_node_t::pfx_len.
+ */
+typedef struct _offl_trie_node {
+    struct _offl_trie_node *child[2];   /**< sub-tries by bit at pfx_len */
+    struct _offl_trie_node *dup;        /**< next entry with same prefix */
+    uint8_t pfx_len;                    /**< prefix length of the node */
+    bool used;                          /**< glue node is in use */
+} _offl_trie_node_t;
+
+static _offl_trie_node_t _offl_trie[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _offl_trie_node_t *_offl_trie_root;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+#define _ONL_HASH_SIZE  (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+/* slots hold the index into _nodes + 1, 0 marks an empty slot */
+#if CONFIG_GNRC_IPV6_NIB_NUMOF < UINT8_MAX
+typedef uint8_t _onl_hash_slot_t;
+#else
+typedef uint16_t _onl_hash_slot_t;
+#endif
+
+/* linear probing table, at most half full */
+static _onl_hash_slot_t _onl_hash[_ONL_HASH_SIZE];
+gnrc_ipv6_nib_nc_hash_stats_t _nib_onl_hash_stats;
+
+#define _ONL_USED_BITS  (8 * sizeof(unsigned))
+
+/* A set bit marks an entry in _nodes that was found in use by
+ * _onl_hash_find_empty(), so it is skipped. The bit is cleared when the entry
+ * is removed from the hash table, e.g. when it is cleared. */
+static unsigned _onl_used[(CONFIG_GNRC_IPV6_NIB_NUMOF + _ONL_USED_BITS - 1) /
+                          _ONL_USED_BITS];
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
@@ -62,6 +105,15 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    memset(_offl_trie, 0, sizeof(_offl_trie));
+    _offl_trie_root = NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    memset(_onl_hash, 0, sizeof(_onl_hash));
+    memset(&_nib_onl_hash_stats, 0, sizeof(_nib_onl_hash_stats));
+    memset(_onl_used, 0, sizeof(_onl_used));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -87,6 +139,160 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+static unsigned _onl_hash_home(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* finalizer of MurmurHash3, so addresses that only differ in a few bits
+     * (in any byte) are spread over the whole table */
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+    return hash % _ONL_HASH_SIZE;
+}
+
+static inline unsigned _onl_hash_next(unsigned slot)
+{
+    return (slot + 1 < _ONL_HASH_SIZE) ? (slot + 1) : 0;
+}
+
+static inline _nib_onl_entry_t *_onl_hash_node(unsigned slot)
+{
+    return &_nodes[_onl_hash[slot] - 1];
+}
+
+void _nib_onl_hash_add(_nib_onl_entry_t *node)
+{
+    unsigned slot = _onl_hash_home(&node->ipv6);
+
+    while (_onl_hash[slot] != 0) {
+        assert(_onl_hash_node(slot) != node);
+        slot = _onl_hash_next(slot);
+    }
+    _onl_hash[slot] = (node - _nodes) + 1;
+    _nib_onl_hash_stats.used++;
+}
+
+void _nib_onl_hash_remove(_nib_onl_entry_t *node)
+{
+    unsigned slot = _onl_hash_home(&node->ipv6);
+    unsigned idx;
+
+    while ((_onl_hash[slot] != 0) && (_onl_hash_node(slot) != node)) {
+        slot = _onl_hash_next(slot);
+    }
+    if (_onl_hash[slot] == 0) {
+        /* node is not in hash table */
+        return;
+    }
+    /* move later entries of the probe sequence into the gap, so lookups
+     * never stop early at an empty slot */
+    for (unsigned next = _onl_hash_next(slot); _onl_hash[next] != 0;
+         next = _onl_hash_next(next)) {
+        unsigned home = _onl_hash_home(&_onl_hash_node(next)->ipv6);
+
+        /* only move entry, if its home slot is not between the gap and the
+         * entry (cyclically) */
+        if ((slot <= next) ? ((home <= slot) || (home > next))
+                           : ((home <= slot) && (home > next))) {
+            _onl_hash[slot] = _onl_hash[next];
+            slot = next;
+        }
+    }
+    _onl_hash[slot] = 0;
+    _nib_onl_hash_stats.used--;
+    /* the entry might be cleared now */
+    idx = node - _nodes;
+    _onl_used[idx / _ONL_USED_BITS] &= ~(1U << (idx % _ONL_USED_BITS));
+}
+
+static void _onl_hash_set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    _nib_onl_hash_remove(node);
+    if (addr != NULL) {
+        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    }
+    _nib_onl_hash_add(node);
+}
+
+/*
+ * Returns the entry with the lowest index in the probe sequence of key that
+ * has the address key and the interface iface, if it has a lower index than
+ * res. Otherwise res is returned.
+ */
+static _nib_onl_entry_t *_onl_hash_find_exact(const ipv6_addr_t *key,
+                                              unsigned iface,
+                                              _nib_onl_entry_t *res)
+{
+    for (unsigned slot = _onl_hash_home(key); _onl_hash[slot] != 0;
+         slot = _onl_hash_next(slot)) {
+        _nib_onl_entry_t *node = _onl_hash_node(slot);
+
+        if ((_nib_onl_get_if(node) == iface) &&
+            ipv6_addr_equal(&node->ipv6, key) &&
+            ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+/*
+ * Returns the empty entry with the lowest index. Entries found in use are
+ * marked in _onl_used, so every entry is only checked once until it is
+ * removed from the hash table again.
+ */
+static _nib_onl_entry_t *_onl_hash_find_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_onl_used); i++) {
+        while (_onl_used[i] != ~0U) {
+            unsigned bit = bitarithm_lsb(~_onl_used[i]);
+            unsigned idx = (i * _ONL_USED_BITS) + bit;
+
+            if (idx >= CONFIG_GNRC_IPV6_NIB_NUMOF) {
+                return NULL;
+            }
+            if (_nodes[idx].mode == _EMPTY) {
+                return &_nodes[idx];
+            }
+            _onl_used[i] |= (1U << bit);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Gets the entry with address addr on interface iface, or an entry without an
+ * address on the interface, or an empty entry. Like the linear search below,
+ * but with the hash table.
+ */
+static _nib_onl_entry_t *_onl_hash_alloc(const ipv6_addr_t *addr,
+                                         unsigned iface)
+{
+    _nib_onl_entry_t *node = _onl_hash_find_exact(&ipv6_addr_unspecified,
+                                                  iface, NULL);
+    _nib_onl_entry_t *empty;
+
+    node = _onl_hash_find_exact(addr, iface, node);
+    if ((node != NULL) && (iface != 0)) {
+        DEBUG("  %p is an exact match\n", (void *)node);
+        return node;
+    }
+    empty = _onl_hash_find_empty();
+    /* cleared entries have neither an address nor an interface, so they
+     * are an exact match for interface 0 */
+    if ((node == NULL) || ((empty != NULL) && (empty < node))) {
+        node = empty;
+    }
+    DEBUG("  using %p\n", (void *)node);
+    return node;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +300,12 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    if (addr != NULL) {
+        node = _onl_hash_alloc(addr, iface);
+    }
+    else
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -128,16 +340,15 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                                                      unsigned iface,
                                                      uint16_t cstate)
 {
-    /* Use clist as FIFO for caching */
-    _nib_onl_entry_t *first = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
-    _nib_onl_entry_t *tmp = first, *res = NULL;
+    _nib_onl_entry_t *tmp;
 
     DEBUG("nib: Searching for replaceable entries (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
-    if (tmp == NULL) {
-        return NULL;
-    }
-    do {
+    /* Use clist as FIFO for caching. Entries that are not garbage collectible
+     * at the moment are dropped from it and requeued by _nib_nc_requeue() once
+     * they are, so every entry is only popped once */
+    while ((tmp = (_nib_onl_entry_t *)clist_lpop(&_next_removable))) {
+        tmp->next = NULL;
         if (_is_gc(tmp)) {
             DEBUG("nib: Removing neighbor cache entry (addr = %s, "
                   "iface = %u) ",
@@ -149,26 +360,16 @@ static inline _nib_onl_entry_t *_cache_out_onl_entry(const ipv6_addr_t *addr,
                   iface);
             /* call _nib_nc_remove to remove timers from _evtimer */
             _nib_nc_remove(tmp);
-            res = tmp;
-            _override_node(addr, iface, res);
+            _override_node(addr, iface, tmp);
             /* cstate masked in _nib_nc_add() already */
-            res->info |= cstate;
-            res->mode = _NC;
-        }
-        /* requeue if not garbage collectible at the moment or queueing
-         * newly created NCE or in case entry becomes garbage collectible
-         * again */
-        clist_rpush(&_next_removable, (clist_node_t *)tmp);
-        if (res == NULL) {
-            /* no new entry created yet, get next entry in FIFO */
-            tmp = (_nib_onl_entry_t *)clist_lpop(&_next_removable);
-        }
-    } while ((tmp != first) && (res == NULL));
-    if (res == NULL) {
-        /* we did not find any removable entry => requeue current one */
-        clist_rpush(&_next_removable, (clist_node_t *)tmp);
+            tmp->info |= cstate;
+            tmp->mode = _NC;
+            /* queue newly created NCE */
+            clist_rpush(&_next_removable, (clist_node_t *)tmp);
+            return tmp;
+        }
     }
-    return res;
+    return NULL;
 }
 
 _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
@@ -200,6 +401,16 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
     return node;
 }
 
+void _nib_nc_requeue(_nib_onl_entry_t *node)
+{
+    if ((node->next == NULL) && (node->mode & _NC) && _is_gc(node)) {
+        DEBUG("nib: requeueing (addr = %s, iface = %u) for potential removal\n",
+              ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
+              _nib_onl_get_if(node));
+        clist_rpush(&_next_removable, (clist_node_t *)node);
+    }
+}
+
 _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
 {
     for (const _nib_onl_entry_t *node = (last) ? last + 1 : _nodes;
@@ -214,6 +425,54 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+_nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+    unsigned probes = 0;
+
+    assert(addr != NULL);
+    DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u) from "
+          "hash table\n", ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)),
+          iface);
+    /* there might be entries with the same address on several interfaces,
+     * so walk the whole probe sequence and prefer the lowest index as the
+     * iteration over _nodes would */
+    for (unsigned slot = _onl_hash_home(addr); _onl_hash[slot] != 0;
+         slot = _onl_hash_next(slot)) {
+        _nib_onl_entry_t *node = _onl_hash_node(slot);
+
+        probes++;
+        if (_onl_matches(node, addr, iface) && ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    _nib_onl_hash_stats.probes += probes;
+    if (probes > _nib_onl_hash_stats.max_probes) {
+        _nib_onl_hash_stats.max_probes = probes;
+    }
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+        _nib_onl_hash_stats.hits++;
+    }
+    else {
+        DEBUG("  No suitable entry found\n");
+        _nib_onl_hash_stats.misses++;
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
@@ -222,12 +481,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
@@ -235,6 +489,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 {
@@ -288,7 +543,10 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
     }
 #endif  /* CONFIG_GNRC_IPV6_NIB_QUEUE_PKT */
     /* remove from cache-out procedure */
-    clist_remove(&_next_removable, (clist_node_t *)node);
+    if (node->next != NULL) {
+        clist_remove(&_next_removable, (clist_node_t *)node);
+        node->next = NULL;
+    }
     _nib_onl_clear(node);
 }
 
@@ -467,6 +725,162 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+static inline unsigned _addr_bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static inline bool _trie_is_glue(const _offl_trie_node_t *node)
+{
+    return node >= &_offl_trie[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+}
+
+static inline _offl_trie_node_t *_trie_node(const _nib_offl_entry_t *dst)
+{
+    return &_offl_trie[dst - _dsts];
+}
+
+static inline _nib_offl_entry_t *_trie_entry(const _offl_trie_node_t *node)
+{
+    return &_dsts[node - _offl_trie];
+}
+
+/* glue nodes always have two children, so any entry below them provides the
+ * prefix bits up to the glue node's prefix length */
+static const ipv6_addr_t *_trie_pfx(const _offl_trie_node_t *node)
+{
+    while (_trie_is_glue(node)) {
+        node = node->child[0];
+    }
+    return &_trie_entry(node)->pfx;
+}
+
+static _offl_trie_node_t *_trie_glue_alloc(unsigned pfx_len)
+{
+    for (unsigned i = CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF;
+         i < ARRAY_SIZE(_offl_trie); i++) {
+        _offl_trie_node_t *glue = &_offl_trie[i];
+
+        if (!glue->used) {
+            memset(glue, 0, sizeof(*glue));
+            glue->used = true;
+            glue->pfx_len = pfx_len;
+            return glue;
+        }
+    }
+    /* a trie with n entries never has more than n - 1 glue nodes */
+    assert(false);
+    return NULL;
+}
+
+static void _trie_add(_nib_offl_entry_t *dst)
+{
+    _offl_trie_node_t *node = _trie_node(dst);
+    _offl_trie_node_t **ptr = &_offl_trie_root;
+
+    memset(node, 0, sizeof(*node));
+    node->pfx_len = dst->pfx_len;
+    while (*ptr != NULL) {
+        _offl_trie_node_t *cur = *ptr;
+        const ipv6_addr_t *cur_pfx = _trie_pfx(cur);
+        unsigned common = ipv6_addr_match_prefix(cur_pfx, &dst->pfx);
+
+        common = (common < cur->pfx_len) ? common : cur->pfx_len;
+        common = (common < dst->pfx_len) ? common : dst->pfx_len;
+        if (common < cur->pfx_len) {
+            if (common == dst->pfx_len) {
+                /* new prefix covers cur => insert above cur */
+                node->child[_addr_bit(cur_pfx, common)] = cur;
+                *ptr = node;
+            }
+            else {
+                /* new prefix and cur branch off at bit common */
+                _offl_trie_node_t *glue = _trie_glue_alloc(common);
+
+                glue->child[_addr_bit(&dst->pfx, common)] = node;
+                glue->child[_addr_bit(cur_pfx, common)] = cur;
+                *ptr = glue;
+            }
+            return;
+        }
+        if (cur->pfx_len == dst->pfx_len) {
+            if (_trie_is_glue(cur)) {
+                /* new entry takes the place of the glue node */
+                memcpy(node->child, cur->child, sizeof(node->child));
+                cur->used = false;
+                *ptr = node;
+                return;
+            }
+            /* same prefix as an existing entry: keep the list of entries
+             * sorted by index, so lookup prefers the lowest one like the
+             * iteration over _dsts would */
+            if (node < cur) {
+                memcpy(node->child, cur->child, sizeof(node->child));
+                memset(cur->child, 0, sizeof(cur->child));
+                node->dup = cur;
+                *ptr = node;
+                return;
+            }
+            while ((cur->dup != NULL) && (cur->dup < node)) {
+                cur = cur->dup;
+            }
+            node->dup = cur->dup;
+            cur->dup = node;
+            return;
+        }
+        ptr = &cur->child[_addr_bit(&dst->pfx, cur->pfx_len)];
+    }
+    *ptr = node;
+}
+
+static void _trie_remove(_nib_offl_entry_t *dst)
+{
+    _offl_trie_node_t *node = _trie_node(dst);
+    _offl_trie_node_t **parent = NULL;
+    _offl_trie_node_t **ptr = &_offl_trie_root;
+
+    while ((*ptr != NULL) && ((*ptr)->pfx_len < dst->pfx_len)) {
+        parent = ptr;
+        ptr = &(*ptr)->child[_addr_bit(&dst->pfx, (*ptr)->pfx_len)];
+    }
+    assert((*ptr != NULL) && ((*ptr)->pfx_len == dst->pfx_len));
+    if (*ptr != node) {
+        /* not the first entry with this prefix */
+        _offl_trie_node_t *cur = *ptr;
+
+        while (cur->dup != node) {
+            assert(cur->dup != NULL);
+            cur = cur->dup;
+        }
+        cur->dup = node->dup;
+        return;
+    }
+    if (node->dup != NULL) {
+        memcpy(node->dup->child, node->child, sizeof(node->child));
+        *ptr = node->dup;
+    }
+    else if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        _offl_trie_node_t *glue = _trie_glue_alloc(node->pfx_len);
+
+        memcpy(glue->child, node->child, sizeof(glue->child));
+        *ptr = glue;
+    }
+    else {
+        *ptr = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        if ((*ptr == NULL) && (parent != NULL) && _trie_is_glue(*parent)) {
+            /* glue node is left with only one child => remove it */
+            _offl_trie_node_t *glue = *parent;
+
+            *parent = (glue->child[0] != NULL) ? glue->child[0]
+                                               : glue->child[1];
+            glue->used = false;
+        }
+    }
+    memset(node, 0, sizeof(*node));
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -493,7 +907,11 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+                _onl_hash_set_addr(tmp_node, next_hop);
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +932,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        _trie_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     }
     return dst;
 }
@@ -550,6 +971,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        _trie_remove(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -573,6 +997,42 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    DEBUG("nib: get match for destination %s from NIB trie\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    for (const _offl_trie_node_t *node = _offl_trie_root; node != NULL;
+         node = node->child[_addr_bit(dst, node->pfx_len)]) {
+        if (!_trie_is_glue(node)) {
+            _nib_offl_entry_t *entry = _trie_entry(node);
+
+            /* no prefix further down the trie can match either */
+            if (ipv6_addr_match_prefix(&entry->pfx, dst) < node->pfx_len) {
+                break;
+            }
+            for (const _offl_trie_node_t *dup = node; dup != NULL;
+                 dup = dup->dup) {
+                entry = _trie_entry(dup);
+                if (entry->mode != _EMPTY) {
+                    DEBUG("nib: best match so far %s/%u\n",
+                          ipv6_addr_to_str(addr_str, &entry->pfx,
+                                           sizeof(addr_str)),
+                          entry->pfx_len);
+                    res = entry;
+                    break;
+                }
+            }
+        }
+        if (node->pfx_len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
@@ -601,6 +1061,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
     }
     return res;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
@@ -825,9 +1286,13 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _onl_hash_set_addr(node, addr);
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     _nib_onl_set_if(node, iface);
 }
 
@@ -311,6 +311,46 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of the on-link entry hash table
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ */
+extern gnrc_ipv6_nib_nc_hash_stats_t _nib_onl_hash_stats;
+
+/**
+ * @brief   Adds an on-link entry to the hash table by its current address
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ *
+ * @param[in] node  An entry that is not in the hash table.
+ */
+void _nib_onl_hash_add(_nib_onl_entry_t *node);
+
+/**
+ * @brief   Removes an on-link entry from the hash table
+ *
+ * Must be called before the address of @p node is changed.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ *
+ * @param[in] node  An entry. Nothing happens if it is not in the hash table.
+ */
+void _nib_onl_hash_remove(_nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
+/**
+ * @brief   Queues a neighbor cache entry for potential removal again
+ *
+ * Neighbor cache entries that are not garbage-collectible are dropped from
+ * the queue when looking for an entry to replace.
+ *
+ * @param[in] node  An entry. Nothing happens if it is not a
+ *                  garbage-collectible neighbor cache entry or already queued.
+ */
+void _nib_nc_requeue(_nib_onl_entry_t *node);
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,9 +362,14 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        _nib_onl_hash_remove(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
+    /* the entry might have become garbage-collectible */
+    _nib_nc_requeue(node);
     return false;
 }
 
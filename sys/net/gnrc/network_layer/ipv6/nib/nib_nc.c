@@ -132,6 +132,16 @@ static const char *_ar_str[] = {
 };
 #endif
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+void gnrc_ipv6_nib_nc_get_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats)
+{
+    assert(stats != NULL);
+    _nib_acquire();
+    memcpy(stats, &_nib_onl_hash_stats, sizeof(*stats));
+    _nib_release();
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 void gnrc_ipv6_nib_nc_print(gnrc_ipv6_nib_nc_t *entry)
 {
     char addr_str[(IPV6_ADDR_MAX_STR_LEN > CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN) ?
@@ -14,6 +14,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <stdbool.h>
 
@@ -32,29 +33,12 @@
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/rb.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
-#endif
-
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * \
-                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
-#endif
-
-static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
-
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
@@ -65,14 +49,6 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
-                              uint16_t offset, size_t frag_size);
 /* gets an entry identified by its tuple */
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
@@ -81,6 +57,11 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+/* gets an entry for a recoverable fragment */
+static int _rbuf_get_rfrag(const gnrc_netif_hdr_t *netif_hdr,
+                           gnrc_pktsnip_t *pkt, unsigned page);
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -96,27 +77,32 @@ enum {
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
-    gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
-
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-
+    switch (frag_ints_add(&entry->ints, offset, offset + frag_size)) {
+        case 0:
+            DEBUG("6lo rfrag: add interval (%u, %u) to entry (%s, ",
+                  (unsigned)offset, (unsigned)(offset + frag_size),
+                  gnrc_netif_addr_to_str(entry->src, entry->src_len,
+                                         l2addr_str));
+            DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
+                                                          entry->dst_len,
+                                                          l2addr_str),
+                  entry->datagram_size, entry->tag);
+            return RBUF_ADD_SUCCESS;
+        case -EEXIST:
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+            return RBUF_ADD_DUPLICATE;
+        case -ENOBUFS:
+            DEBUG("6lo rfrag: no space left in rbuf intervals.\n");
+            return RBUF_ADD_ERROR;
+        default:
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
              * https://tools.ietf.org/html/rfc4944#section-5.3 */
             return RBUF_ADD_REPEAT;
-        }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
-        }
-        ptr = ptr->next;
     }
-    return RBUF_ADD_SUCCESS;
 }
 
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
@@ -145,6 +131,12 @@ bool gnrc_sixlowpan_frag_rb_exists(const gnrc_netif_hdr_t *netif_hdr,
     return (_rbuf_get_by_tag(netif_hdr, tag) != NULL);
 }
 
+gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_get_by_datagram(
+        const gnrc_netif_hdr_t *netif_hdr, uint16_t tag)
+{
+    return _rbuf_get_by_tag(netif_hdr, tag);
+}
+
 void gnrc_sixlowpan_frag_rb_rm_by_datagram(const gnrc_netif_hdr_t *netif_hdr,
                                            uint16_t tag)
 {
@@ -181,39 +173,62 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     return NULL;
 }
 
+static inline bool _is_rfrag(gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    return sixlowpan_sfr_rfrag_is(pkt->data);
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+    (void)pkt;
+    return false;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (_is_rfrag(pkt)) {
+        /* the offset field of the first recoverable fragment carries the
+         * datagram size */
+        return (sixlowpan_sfr_rfrag_get_seq(pkt->data) == 0)
+             ? (offset == 0)
+             : (offset == sixlowpan_sfr_rfrag_get_offset(pkt->data));
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
     return (sixlowpan_frag_1_is(pkt->data) && (offset == 0)) ||
            (sixlowpan_frag_n_is(pkt->data) &&
             (offset == sixlowpan_frag_offset(pkt->data)));
 }
 #endif
 
-static uint8_t *_6lo_frag_payload(gnrc_pktsnip_t *pkt)
+static size_t _6lo_frag_hdr_size(gnrc_pktsnip_t *pkt)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (_is_rfrag(pkt)) {
+        return sizeof(sixlowpan_sfr_rfrag_t);
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
     if (sixlowpan_frag_1_is(pkt->data)) {
-        return ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
+        return sizeof(sixlowpan_frag_t);
     }
     else {
-        return ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_n_t);
+        return sizeof(sixlowpan_frag_n_t);
     }
 }
 
+static uint8_t *_6lo_frag_payload(gnrc_pktsnip_t *pkt)
+{
+    return ((uint8_t *)pkt->data) + _6lo_frag_hdr_size(pkt);
+}
+
 static size_t _6lo_frag_size(gnrc_pktsnip_t *pkt, size_t offset, uint8_t *data)
 {
-    size_t frag_size;
+    size_t frag_size = pkt->size - _6lo_frag_hdr_size(pkt);
 
-    if (offset == 0) {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_t);
-        if (data[0] == SIXLOWPAN_UNCOMP) {
-            /* subtract SIXLOWPAN_UNCOMP byte from fragment size,
-             * data pointer must be changed by caller (see _rbuf_add()) */
-            frag_size--;
-        }
-    }
-    else {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_n_t);
+    if ((offset == 0) && (data[0] == SIXLOWPAN_UNCOMP)) {
+        /* subtract SIXLOWPAN_UNCOMP byte from fragment size,
+         * data pointer must be changed by caller (see _rbuf_add()) */
+        frag_size--;
     }
     return frag_size;
 }
@@ -225,20 +240,29 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     uint8_t *data;
     size_t frag_size;
     int res;
-    uint16_t datagram_size;
-    uint16_t datagram_tag;
 
     /* check if provided offset is the same as in fragment */
     assert(_valid_offset(pkt, offset));
     data = _6lo_frag_payload(pkt);
     frag_size = _6lo_frag_size(pkt, offset, data);
-    datagram_size = sixlowpan_frag_datagram_size(pkt->data);
-    datagram_tag = sixlowpan_frag_datagram_tag(pkt->data);
 
     gnrc_sixlowpan_frag_rb_gc();
-    res = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
-                    gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
-                    datagram_size, datagram_tag, page);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (_is_rfrag(pkt)) {
+        res = _rbuf_get_rfrag(netif_hdr, pkt, page);
+    }
+    else
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+    {
+        uint16_t datagram_size = sixlowpan_frag_datagram_size(pkt->data);
+        uint16_t datagram_tag = sixlowpan_frag_datagram_tag(pkt->data);
+
+        res = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                        netif_hdr->src_l2addr_len,
+                        gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                        netif_hdr->dst_l2addr_len,
+                        datagram_size, datagram_tag, page);
+    }
 
     if (res < 0) {
         DEBUG("6lo rbuf: reassembly buffer full.\n");
@@ -246,6 +270,13 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
     entry = &rbuf[res];
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (_is_rfrag(pkt)) {
+        /* recoverable fragments are placed by the offset into the compressed
+         * datagram */
+        offset += entry->super.offset_diff;
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
     if ((offset + frag_size) > entry->super.datagram_size) {
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
         gnrc_pktbuf_release(entry->pkt);
@@ -263,108 +294,62 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         case RBUF_ADD_DUPLICATE:
             gnrc_pktbuf_release(pkt);
             return res;
+        case RBUF_ADD_ERROR:
+            gnrc_pktbuf_release(entry->pkt);
+            gnrc_pktbuf_release(pkt);
+            gnrc_sixlowpan_frag_rb_remove(entry);
+            return RBUF_ADD_ERROR;
         default:
             break;
     }
 
-    if (_rbuf_update_ints(&entry->super, offset, frag_size)) {
-        DEBUG("6lo rbuf: add fragment data\n");
-        entry->super.current_size += (uint16_t)frag_size;
-        if (offset == 0) {
+    DEBUG("6lo rbuf: add fragment data\n");
+    entry->super.current_size += (uint16_t)frag_size;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (_is_rfrag(pkt)) {
+        bf_set(entry->super.received,
+               sixlowpan_sfr_rfrag_get_seq(pkt->data));
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+    if (offset == 0) {
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
-            if (sixlowpan_iphc_is(data)) {
-                DEBUG("6lo rbuf: detected IPHC header.\n");
-                gnrc_pktsnip_t *frag_hdr = gnrc_pktbuf_mark(pkt,
-                        sizeof(sixlowpan_frag_t), GNRC_NETTYPE_SIXLOWPAN);
-                if (frag_hdr == NULL) {
-                    DEBUG("6lo rbuf: unable to mark fragment header. "
-                          "aborting reassembly.\n");
-                    gnrc_pktbuf_release(entry->pkt);
-                    gnrc_pktbuf_release(pkt);
-                    gnrc_sixlowpan_frag_rb_remove(entry);
-                    return RBUF_ADD_ERROR;
-                }
-                else {
-                    DEBUG("6lo rbuf: handing over to IPHC reception.\n");
-                    /* `pkt` released in IPHC */
-                    gnrc_sixlowpan_iphc_recv(pkt, entry, 0);
-                    /* check if entry was deleted in IPHC (error case) */
-                    if (gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
-                        res = RBUF_ADD_ERROR;
-                    }
-                    return res;
+        if (sixlowpan_iphc_is(data)) {
+            DEBUG("6lo rbuf: detected IPHC header.\n");
+            gnrc_pktsnip_t *frag_hdr = gnrc_pktbuf_mark(pkt,
+                    _6lo_frag_hdr_size(pkt), GNRC_NETTYPE_SIXLOWPAN);
+            if (frag_hdr == NULL) {
+                DEBUG("6lo rbuf: unable to mark fragment header. "
+                      "aborting reassembly.\n");
+                gnrc_pktbuf_release(entry->pkt);
+                gnrc_pktbuf_release(pkt);
+                gnrc_sixlowpan_frag_rb_remove(entry);
+                return RBUF_ADD_ERROR;
+            }
+            else {
+                DEBUG("6lo rbuf: handing over to IPHC reception.\n");
+                /* `pkt` released in IPHC */
+                gnrc_sixlowpan_iphc_recv(pkt, entry, 0);
+                /* check if entry was deleted in IPHC (error case) */
+                if (gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
+                    res = RBUF_ADD_ERROR;
                 }
+                return res;
             }
-            else
+        }
+        else
 #endif
-            if (data[0] == SIXLOWPAN_UNCOMP) {
-                DEBUG("6lo rbuf: detected uncompressed datagram\n");
-                data++;
-            }
+        if (data[0] == SIXLOWPAN_UNCOMP) {
+            DEBUG("6lo rbuf: detected uncompressed datagram\n");
+            data++;
         }
-        memcpy(((uint8_t *)entry->pkt->data) + offset, data,
-               frag_size);
-    }
-    else {
-        /* no space left in rbuf interval buffer*/
-        gnrc_pktbuf_release(entry->pkt);
-        gnrc_sixlowpan_frag_rb_remove(entry);
-        res = RBUF_ADD_ERROR;
     }
+    memcpy(((uint8_t *)entry->pkt->data) + offset, data,
+           frag_size);
     /* no errors and not consumed => release packet */
     gnrc_pktbuf_release(pkt);
     return res;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end)
-{
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
-
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
-    }
-
-    return NULL;
-}
-
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
-                              uint16_t offset, size_t frag_size)
-{
-    gnrc_sixlowpan_frag_rb_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
-    new = _rbuf_int_get_free();
-
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
-    }
-
-    new->start = offset;
-    new->end = end;
-
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->src,
-                                                       entry->src_len,
-                                                       l2addr_str));
-    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
-                                                  entry->dst_len,
-                                                  l2addr_str),
-          entry->datagram_size, entry->tag);
-
-    LL_PREPEND(entry->ints, new);
-
-    return true;
-}
-
 static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
@@ -412,6 +397,56 @@ static inline void _set_rbuf_timeout(void)
                    &_gc_timer_msg, thread_getpid());
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+static int _rbuf_get_rfrag(const gnrc_netif_hdr_t *netif_hdr,
+                           gnrc_pktsnip_t *pkt, unsigned page)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    gnrc_sixlowpan_frag_rb_t *entry = _rbuf_get_by_tag(netif_hdr,
+                                                       rfrag->base.tag);
+    int res;
+
+    if (entry != NULL) {
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
+        if (entry->super.current_size == 0) {
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
+        }
+#endif
+        entry->super.arrival = xtimer_now_usec();
+        _set_rbuf_timeout();
+        return entry - &(rbuf[0]);
+    }
+    if (sixlowpan_sfr_rfrag_get_seq(rfrag) != 0) {
+        /* the datagram size is only known with the first fragment */
+        DEBUG("6lo rfrag: no reassembly buffer entry for recoverable "
+              "fragment with tag %u\n", rfrag->base.tag);
+        return -1;
+    }
+    res = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    netif_hdr->src_l2addr_len,
+                    gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                    netif_hdr->dst_l2addr_len,
+                    sixlowpan_sfr_rfrag_get_offset(rfrag), rfrag->base.tag,
+                    page);
+    if ((res >= 0) && (((uint8_t *)(rfrag + 1))[0] == SIXLOWPAN_UNCOMP)) {
+        entry = &rbuf[res];
+        /* the datagram size of recoverable fragments includes the
+         * SIXLOWPAN_UNCOMP dispatch */
+        entry->super.datagram_size--;
+        entry->super.offset_diff = -1;
+        if (gnrc_pktbuf_realloc_data(entry->pkt,
+                                     entry->super.datagram_size) != 0) {
+            DEBUG("6lo rfrag: can not shrink reassembly buffer space.\n");
+            gnrc_pktbuf_release(entry->pkt);
+            gnrc_sixlowpan_frag_rb_remove(entry);
+            return -1;
+        }
+    }
+    return res;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
@@ -519,6 +554,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    memset(res->super.received, 0, sizeof(res->super.received));
+    res->super.offset_diff = 0;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -537,7 +576,6 @@ static int _rbuf_get(const void *src, size_t src_len,
 void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
-    memset(rbuf_int, 0, sizeof(rbuf_int));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -555,14 +593,7 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
-    while (entry->ints != NULL) {
-        gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
-
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
-    }
+    frag_ints_init(&entry->ints);
     entry->datagram_size = 0;
 }
 
@@ -585,20 +616,6 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
 }
 
-#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
-}
-#endif
-
 int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf,
                                                    gnrc_netif_hdr_t *netif_hdr)
 {
@@ -630,7 +647,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
+        gnrc_sixlowpan_frag_stats_get()->fragments += rbuf->super.ints.frags;
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
@@ -0,0 +1,690 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/ieee802154.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/sixlowpan/sfr.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* same as ((int) ceil((double) N / D)) */
+#define DIV_CEIL(N, D)      (((N) + (D) - 1) / (D))
+
+/* maximum number of fragments of a datagram */
+#define FRAGS_MAX           (SIXLOWPAN_SFR_SEQ_MAX + 1U)
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+static char addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+/* FULL bitmap: signals that the datagram was received completely */
+static const BITFIELD(_full_bitmap, SIXLOWPAN_SFR_ACK_BITMAP_SIZE) = {
+    0xff, 0xff, 0xff, 0xff
+};
+
+static inline size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/* bit of a fragment in a bitmap in host byte order */
+static inline uint32_t _seq_bit(uint8_t seq)
+{
+    return UINT32_C(0x80000000) >> seq;
+}
+
+/* bitmap of all fragments with a sequence number lower than `frags` */
+static inline uint32_t _seqs_below(uint8_t frags)
+{
+    return (frags >= FRAGS_MAX) ? UINT32_MAX : ~(UINT32_MAX >> frags);
+}
+
+static inline uint32_t _bitmap_get(const uint8_t *bitmap)
+{
+    network_uint32_t tmp;
+
+    memcpy(&tmp, bitmap, sizeof(tmp));
+    return byteorder_ntohl(tmp);
+}
+
+static void _init_rfrag(sixlowpan_sfr_rfrag_t *hdr, uint8_t tag, uint8_t seq,
+                        uint16_t frag_size, uint16_t offset)
+{
+    hdr->base.disp_ecn = 0;
+    sixlowpan_sfr_rfrag_set_disp(&hdr->base);
+    hdr->base.tag = tag;
+    hdr->ar_seq_fs = byteorder_htons(0);
+    sixlowpan_sfr_rfrag_set_seq(hdr, seq);
+    sixlowpan_sfr_rfrag_set_frag_size(hdr, frag_size);
+    sixlowpan_sfr_rfrag_set_offset(hdr, offset);
+}
+
+static gnrc_pktsnip_t *_build_netif_hdr(const uint8_t *dst, size_t dst_len,
+                                        const gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *hdr = gnrc_netif_hdr_build(NULL, 0, dst, dst_len);
+
+    if (hdr == NULL) {
+        DEBUG("6lo sfr: error allocating link-layer header\n");
+        return NULL;
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, netif);
+    return hdr;
+}
+
+static void _send_ack(const gnrc_netif_hdr_t *netif_hdr, const uint8_t *dst,
+                      size_t dst_len, uint8_t tag, const uint8_t *bitmap)
+{
+    gnrc_pktsnip_t *netif, *ack_snip;
+    sixlowpan_sfr_ack_t *ack;
+
+    netif = _build_netif_hdr(dst, dst_len, gnrc_netif_hdr_get_netif(netif_hdr));
+    if (netif == NULL) {
+        return;
+    }
+    ack_snip = gnrc_pktbuf_add(NULL, NULL, sizeof(*ack),
+                               GNRC_NETTYPE_SIXLOWPAN);
+    if (ack_snip == NULL) {
+        DEBUG("6lo sfr: error allocating RFRAG acknowledgment\n");
+        gnrc_pktbuf_release(netif);
+        return;
+    }
+    ack = ack_snip->data;
+    ack->base.disp_ecn = 0;
+    sixlowpan_sfr_ack_set_disp(&ack->base);
+    ack->base.tag = tag;
+    memcpy(ack->bitmap, bitmap, sizeof(ack->bitmap));
+    DEBUG("6lo sfr: send RFRAG acknowledgment (tag: %u, bitmap: %08" PRIx32
+          ")\n", tag, _bitmap_get(ack->bitmap));
+    gnrc_sixlowpan_dispatch_send(gnrc_pkt_prepend(ack_snip, netif), NULL, 0);
+}
+
+/* ------------------------------------
+ * sender
+ * ------------------------------------*/
+static void _clean_up_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf, int error)
+{
+    DEBUG("6lo sfr: removing datagram with tag %u from fragmentation "
+          "buffer (error: %d)\n", fbuf->tag, error);
+    xtimer_remove(&fbuf->sfr.arq_timer);
+    xtimer_remove(&fbuf->sfr.gap_timer);
+    if (error) {
+        gnrc_pktbuf_release_error(fbuf->pkt, error);
+    }
+    else {
+        gnrc_pktbuf_release(fbuf->pkt);
+    }
+    fbuf->pkt = NULL;
+}
+
+static int _init_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf, gnrc_netif_t *netif)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fbuf->sfr;
+    size_t payload_len = gnrc_pkt_len(fbuf->pkt->next);
+    size_t max_frag_size = _min(netif->sixlo.max_frag_size,
+                                GNRC_SIXLOWPAN_SFR_OPT_FRAG_SIZE);
+    size_t frag_size;
+
+    if (max_frag_size <= sizeof(sixlowpan_sfr_rfrag_t)) {
+        return -EMSGSIZE;
+    }
+    frag_size = max_frag_size - sizeof(sixlowpan_sfr_rfrag_t);
+    if (DIV_CEIL(payload_len, frag_size) > FRAGS_MAX) {
+        /* make fragments as large as the link allows to fit the datagram
+         * into the available sequence numbers */
+        frag_size = DIV_CEIL(payload_len, FRAGS_MAX);
+        if ((frag_size > SIXLOWPAN_SFR_FRAG_SIZE_MAX) ||
+            ((frag_size + sizeof(sixlowpan_sfr_rfrag_t)) >
+             netif->sixlo.max_frag_size)) {
+            return -EMSGSIZE;
+        }
+    }
+    /* the datagram size of recoverable fragments is the size of the
+     * compressed datagram */
+    fbuf->datagram_size = payload_len;
+    fbuf->tag &= 0xff;
+    sfr->frag_size = frag_size;
+    sfr->frags = DIV_CEIL(payload_len, frag_size);
+    sfr->next_seq = 0;
+    sfr->window_left = GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    sfr->acked = 0;
+    sfr->resend = 0;
+    sfr->retries = 0;
+    sfr->gap_timer_msg.type = GNRC_SIXLOWPAN_FRAG_FB_SND_MSG;
+    sfr->gap_timer_msg.content.ptr = fbuf;
+    sfr->arq_timer_msg.type = GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG;
+    sfr->arq_timer_msg.content.ptr = fbuf;
+    DEBUG("6lo sfr: sending datagram of %u bytes in %u fragments of %u "
+          "bytes\n", fbuf->datagram_size, sfr->frags, sfr->frag_size);
+    return 0;
+}
+
+static void _copy_pkt_to_frag(uint8_t *data, const gnrc_pktsnip_t *pkt,
+                              size_t offset, size_t len)
+{
+    while ((pkt != NULL) && (len > 0)) {
+        if (offset < pkt->size) {
+            size_t clen = _min(pkt->size - offset, len);
+
+            memcpy(data, ((uint8_t *)pkt->data) + offset, clen);
+            data += clen;
+            len -= clen;
+            offset = 0;
+        }
+        else {
+            offset -= pkt->size;
+        }
+        pkt = pkt->next;
+    }
+}
+
+static int _send_rfrag(gnrc_sixlowpan_frag_fb_t *fbuf, uint8_t seq,
+                       bool ack_req)
+{
+    gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_sfr_rfrag_t *hdr;
+    size_t offset = seq * fbuf->sfr.frag_size;
+    size_t frag_size = _min(fbuf->sfr.frag_size,
+                            fbuf->datagram_size - offset);
+
+    netif = gnrc_netif_hdr_build(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                 netif_hdr->src_l2addr_len,
+                                 gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                 netif_hdr->dst_l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating link-layer header\n");
+        return -ENOMEM;
+    }
+    /* src_l2addr_len and dst_l2addr_len are already the same, now copy the rest */
+    *((gnrc_netif_hdr_t *)netif->data) = *netif_hdr;
+    frag = gnrc_pktbuf_add(NULL, NULL, sizeof(*hdr) + frag_size,
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: error allocating fragment\n");
+        gnrc_pktbuf_release(netif);
+        return -ENOMEM;
+    }
+    hdr = frag->data;
+    /* the first fragment carries the datagram size in its offset field */
+    _init_rfrag(hdr, fbuf->tag, seq, frag_size, (seq == 0)
+                                                ? fbuf->datagram_size
+                                                : offset);
+    if (ack_req) {
+        sixlowpan_sfr_rfrag_set_ack_req(hdr);
+    }
+    else {
+        /* Tell the link layer that we will send more fragments */
+        ((gnrc_netif_hdr_t *)netif->data)->flags |=
+            GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    _copy_pkt_to_frag((uint8_t *)(hdr + 1), fbuf->pkt->next, offset,
+                      frag_size);
+    DEBUG("6lo sfr: send fragment (tag: %u, seq: %u, offset: %u, "
+          "fragment size: %u, ack req: %d)\n", fbuf->tag, seq,
+          (unsigned)offset, (unsigned)frag_size, ack_req);
+    gnrc_sixlowpan_dispatch_send(gnrc_pkt_prepend(frag, netif), NULL, 0);
+    return 0;
+}
+
+static void _send_abort(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+    gnrc_pktsnip_t *netif, *frag;
+
+    netif = _build_netif_hdr(gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                             netif_hdr->dst_l2addr_len,
+                             gnrc_netif_hdr_get_netif(netif_hdr));
+    if (netif == NULL) {
+        return;
+    }
+    frag = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_rfrag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: error allocating abort fragment\n");
+        gnrc_pktbuf_release(netif);
+        return;
+    }
+    /* sequence number, fragment size, and offset of an abort are all 0 */
+    _init_rfrag(frag->data, fbuf->tag, 0, 0, 0);
+    DEBUG("6lo sfr: send abort (tag: %u)\n", fbuf->tag);
+    gnrc_sixlowpan_dispatch_send(gnrc_pkt_prepend(frag, netif), NULL, 0);
+}
+
+static void _retry_datagram(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    xtimer_remove(&fbuf->sfr.arq_timer);
+    xtimer_remove(&fbuf->sfr.gap_timer);
+    _send_abort(fbuf);
+#if GNRC_SIXLOWPAN_SFR_DG_RETRIES > 0
+    if (fbuf->sfr.dg_retries < GNRC_SIXLOWPAN_SFR_DG_RETRIES) {
+        DEBUG("6lo sfr: retrying datagram with tag %u from scratch\n",
+              fbuf->tag);
+        fbuf->sfr.dg_retries++;
+        /* new tag, so the receiver does not mix the fragments with the
+         * aborted ones */
+        fbuf->tag = gnrc_sixlowpan_frag_fb_next_tag();
+        /* fragments are determined again on next send */
+        fbuf->sfr.frags = 0;
+        gnrc_sixlowpan_frag_sfr_send(NULL, fbuf, 0);
+        return;
+    }
+#endif
+    _clean_up_fbuf(fbuf, ETIMEDOUT);
+}
+
+static int _next_seq(gnrc_sixlowpan_frag_sfr_fb_t *sfr)
+{
+    if (sfr->resend != 0) {
+        uint8_t seq = 0;
+
+        while (!(sfr->resend & _seq_bit(seq))) {
+            seq++;
+        }
+        sfr->resend &= ~_seq_bit(seq);
+        return seq;
+    }
+    else if (sfr->next_seq < sfr->frags) {
+        return sfr->next_seq++;
+    }
+    return -1;
+}
+
+void gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page)
+{
+    assert(ctx != NULL);
+    gnrc_sixlowpan_frag_fb_t *fbuf = ctx;
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fbuf->sfr;
+    gnrc_netif_t *netif;
+    bool ack_req;
+    int seq, res;
+
+    assert((fbuf->pkt == pkt) || (pkt == NULL));
+    (void)pkt;
+    (void)page;
+    if (fbuf->pkt == NULL) {
+        /* datagram was already completed or aborted, but a message for its
+         * next fragment was still queued */
+        return;
+    }
+    netif = gnrc_netif_hdr_get_netif(fbuf->pkt->data);
+    assert(netif != NULL);
+    if (sfr->frags == 0) {
+        if ((res = _init_fbuf(fbuf, netif)) < 0) {
+            DEBUG("6lo sfr: datagram of %u bytes too big\n",
+                  (unsigned)gnrc_pkt_len(fbuf->pkt->next));
+            _clean_up_fbuf(fbuf, -res);
+            return;
+        }
+    }
+    if ((sfr->window_left == 0) || ((seq = _next_seq(sfr)) < 0)) {
+        /* window or all fragments sent, waiting for acknowledgment */
+        return;
+    }
+    /* request acknowledgment with the last fragment of the window or of the
+     * datagram */
+    sfr->window_left--;
+    ack_req = (sfr->window_left == 0) ||
+              ((sfr->resend == 0) && (sfr->next_seq >= sfr->frags));
+    if ((res = _send_rfrag(fbuf, seq, ack_req)) < 0) {
+        _clean_up_fbuf(fbuf, -res);
+        return;
+    }
+    if (ack_req) {
+        sfr->last_seq = seq;
+        xtimer_set_msg(&sfr->arq_timer,
+                       GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS * US_PER_MS,
+                       &sfr->arq_timer_msg, thread_getpid());
+    }
+    else {
+        xtimer_set_msg(&sfr->gap_timer, GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US,
+                       &sfr->gap_timer_msg, thread_getpid());
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_arq_timeout(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr;
+
+    assert(fbuf != NULL);
+    sfr = &fbuf->sfr;
+    if (fbuf->pkt == NULL) {
+        return;
+    }
+    DEBUG("6lo sfr: ARQ timeout for datagram with tag %u\n", fbuf->tag);
+    if (++sfr->retries > GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
+        _retry_datagram(fbuf);
+        return;
+    }
+    if (sfr->acked == 0) {
+        /* the receiver may not know the datagram at all, e.g. when the first
+         * fragment got lost, so send everything again */
+        sfr->resend = _seqs_below(sfr->next_seq);
+        sfr->window_left = GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    }
+    else {
+        /* only request the acknowledgment again */
+        sfr->resend = _seq_bit(sfr->last_seq);
+        sfr->window_left = 1;
+    }
+    gnrc_sixlowpan_frag_sfr_send(NULL, fbuf, 0);
+}
+
+static void _handle_ack_for_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf,
+                                 uint32_t bitmap)
+{
+    gnrc_sixlowpan_frag_sfr_fb_t *sfr = &fbuf->sfr;
+    uint32_t all = _seqs_below(sfr->frags);
+
+    if (bitmap == 0) {
+        DEBUG("6lo sfr: receiver aborted datagram with tag %u\n", fbuf->tag);
+        _clean_up_fbuf(fbuf, ECANCELED);
+        return;
+    }
+    if ((bitmap & all) == all) {
+        DEBUG("6lo sfr: datagram with tag %u completely acknowledged\n",
+              fbuf->tag);
+        _clean_up_fbuf(fbuf, 0);
+        return;
+    }
+    xtimer_remove(&sfr->arq_timer);
+    if ((bitmap & ~sfr->acked) != 0) {
+        sfr->retries = 0;
+    }
+    else if (++sfr->retries > GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
+        _retry_datagram(fbuf);
+        return;
+    }
+    sfr->acked |= bitmap;
+    sfr->resend = _seqs_below(sfr->next_seq) & ~sfr->acked;
+    sfr->window_left = GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    DEBUG("6lo sfr: resending %08" PRIx32 " of datagram with tag %u\n",
+          sfr->resend, fbuf->tag);
+    gnrc_sixlowpan_frag_sfr_send(NULL, fbuf, 0);
+}
+
+static bool _fbuf_dst_is(const gnrc_sixlowpan_frag_fb_t *fbuf,
+                         const gnrc_netif_hdr_t *netif_hdr)
+{
+    const gnrc_netif_hdr_t *fbuf_hdr = fbuf->pkt->data;
+
+    return (fbuf_hdr->if_pid == netif_hdr->if_pid) &&
+           (fbuf_hdr->dst_l2addr_len == netif_hdr->src_l2addr_len) &&
+           (memcmp(gnrc_netif_hdr_get_dst_addr(fbuf_hdr),
+                   gnrc_netif_hdr_get_src_addr(netif_hdr),
+                   netif_hdr->src_l2addr_len) == 0);
+}
+
+static void _handle_ack(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt)
+{
+    sixlowpan_sfr_ack_t *ack = pkt->data;
+    gnrc_sixlowpan_frag_fb_t *fbuf;
+
+    if (pkt->size < sizeof(*ack)) {
+        DEBUG("6lo sfr: RFRAG acknowledgment too short\n");
+        return;
+    }
+    DEBUG("6lo sfr: received RFRAG acknowledgment (tag: %u, bitmap: %08"
+          PRIx32 ")\n", ack->base.tag, _bitmap_get(ack->bitmap));
+    fbuf = gnrc_sixlowpan_frag_fb_get_by_tag(ack->base.tag);
+    if ((fbuf != NULL) && _fbuf_dst_is(fbuf, netif_hdr)) {
+        _handle_ack_for_fbuf(fbuf, _bitmap_get(ack->bitmap));
+        return;
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+
+    vrbe = gnrc_sixlowpan_frag_vrb_reverse(
+            gnrc_netif_hdr_get_netif(netif_hdr),
+            gnrc_netif_hdr_get_src_addr(netif_hdr),
+            netif_hdr->src_l2addr_len, ack->base.tag
+        );
+    if (vrbe != NULL) {
+        uint32_t bitmap = _bitmap_get(ack->bitmap);
+
+        DEBUG("6lo sfr: forwarding RFRAG acknowledgment to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.src, vrbe->super.src_len,
+                                     addr_str), vrbe->super.tag);
+        /* the previous hop is reached over the interface the datagram was
+         * received on, which is the interface the acknowledgment came from
+         * for all common topologies */
+        _send_ack(netif_hdr, vrbe->super.src, vrbe->super.src_len,
+                  vrbe->super.tag, ack->bitmap);
+        if ((bitmap == 0) || (bitmap == UINT32_MAX)) {
+            gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        }
+        else {
+            vrbe->super.arrival = xtimer_now_usec();
+        }
+        return;
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    DEBUG("6lo sfr: no datagram for RFRAG acknowledgment found\n");
+}
+
+/* ------------------------------------
+ * receiver and forwarder
+ * ------------------------------------*/
+static inline bool _is_abort(const sixlowpan_sfr_rfrag_t *rfrag)
+{
+    return (sixlowpan_sfr_rfrag_get_seq(rfrag) == 0) &&
+           (sixlowpan_sfr_rfrag_get_frag_size(rfrag) == 0) &&
+           (sixlowpan_sfr_rfrag_get_offset(rfrag) == 0);
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+static void _forward_rfrag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif_snip,
+                           gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    gnrc_netif_hdr_t *netif_hdr = netif_snip->data;
+    gnrc_pktsnip_t *netif;
+    bool abort = _is_abort(rfrag);
+
+    netif = _build_netif_hdr(vrbe->super.dst, vrbe->super.dst_len,
+                             vrbe->out_netif);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->flags = netif_hdr->flags;
+    DEBUG("6lo sfr: forwarding fragment (%u, %u) to (%s, %u)\n",
+          rfrag->base.tag, sixlowpan_sfr_rfrag_get_seq(rfrag),
+          gnrc_netif_addr_to_str(vrbe->super.dst, vrbe->super.dst_len,
+                                 addr_str), vrbe->out_tag);
+    rfrag->base.tag = vrbe->out_tag;
+    if (!abort) {
+        sixlowpan_sfr_rfrag_set_offset(
+                rfrag,
+                sixlowpan_sfr_rfrag_get_offset(rfrag) + vrbe->super.offset_diff
+            );
+        vrbe->super.arrival = xtimer_now_usec();
+    }
+    else {
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    /* replace link-layer header of the previous hop */
+    pkt = gnrc_pktbuf_remove_snip(pkt, netif_snip);
+    gnrc_sixlowpan_dispatch_send(gnrc_pkt_prepend(pkt, netif), NULL, page);
+}
+
+int gnrc_sixlowpan_frag_sfr_forward(gnrc_pktsnip_t *pkt,
+                                    const sixlowpan_sfr_rfrag_t *rfrag,
+                                    gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    unsigned page)
+{
+    gnrc_pktsnip_t *hdr_snip;
+    sixlowpan_sfr_rfrag_t *hdr;
+    size_t frag_size = gnrc_pkt_len(pkt->next);
+
+    assert(pkt->type == GNRC_NETTYPE_NETIF);
+    if ((frag_size > SIXLOWPAN_SFR_FRAG_SIZE_MAX) ||
+        ((frag_size + sizeof(*hdr)) > vrbe->out_netif->sixlo.max_frag_size)) {
+        DEBUG("6lo sfr: recompressed fragment too big to forward\n");
+        gnrc_pktbuf_release(pkt);
+        return -EMSGSIZE;
+    }
+    hdr_snip = gnrc_pktbuf_add(pkt->next, NULL, sizeof(*hdr),
+                               GNRC_NETTYPE_SIXLOWPAN);
+    if (hdr_snip == NULL) {
+        DEBUG("6lo sfr: error allocating fragment header for forwarding\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt->next = hdr_snip;
+    /* RFRAG tags are only 8 bit long */
+    vrbe->out_tag &= 0xff;
+    /* all further fragments move by the change in header size */
+    vrbe->super.offset_diff = frag_size -
+                              sixlowpan_sfr_rfrag_get_frag_size(rfrag);
+    vrbe->super.arrival = xtimer_now_usec();
+    hdr = hdr_snip->data;
+    memcpy(hdr, rfrag, sizeof(*hdr));
+    hdr->base.tag = vrbe->out_tag;
+    sixlowpan_sfr_rfrag_set_frag_size(hdr, frag_size);
+    sixlowpan_sfr_rfrag_set_offset(hdr, sixlowpan_sfr_rfrag_get_offset(rfrag) +
+                                        vrbe->super.offset_diff);
+    if (!sixlowpan_sfr_rfrag_ack_req(hdr)) {
+        ((gnrc_netif_hdr_t *)pkt->data)->flags |=
+            GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    DEBUG("6lo sfr: forwarding first fragment (datagram size: %u, "
+          "fragment size: %u) to (%s, %u)\n",
+          sixlowpan_sfr_rfrag_get_offset(hdr), (unsigned)frag_size,
+          gnrc_netif_addr_to_str(vrbe->super.dst, vrbe->super.dst_len,
+                                 addr_str), vrbe->out_tag);
+    gnrc_sixlowpan_dispatch_send(pkt, NULL, page);
+    return 0;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+static void _handle_rfrag(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                          gnrc_pktsnip_t *netif_snip, unsigned page)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    gnrc_sixlowpan_frag_rb_t *rbe;
+    uint8_t tag = rfrag->base.tag;
+    uint8_t seq = sixlowpan_sfr_rfrag_get_seq(rfrag);
+    bool ack_req = sixlowpan_sfr_rfrag_ack_req(rfrag);
+    uint16_t offset = 0;
+
+    if ((pkt->size < sizeof(*rfrag)) ||
+        ((pkt->size - sizeof(*rfrag)) !=
+         sixlowpan_sfr_rfrag_get_frag_size(rfrag))) {
+        DEBUG("6lo sfr: fragment size does not match header\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    DEBUG("6lo sfr: received fragment (tag: %u, seq: %u, size: %u, "
+          "offset: %u, ack req: %d)\n", tag, seq,
+          sixlowpan_sfr_rfrag_get_frag_size(rfrag),
+          sixlowpan_sfr_rfrag_get_offset(rfrag), ack_req);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(
+            gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
+            tag
+        );
+
+    /* a first fragment is forwarded after its header was recompressed in
+     * the reassembly buffer */
+    if ((vrbe != NULL) && ((seq != 0) || _is_abort(rfrag))) {
+        _forward_rfrag(pkt, netif_snip, vrbe, page);
+        return;
+    }
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    (void)netif_snip;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    if (_is_abort(rfrag)) {
+        DEBUG("6lo sfr: sender aborted datagram with tag %u\n", tag);
+        gnrc_sixlowpan_frag_rb_rm_by_datagram(netif_hdr, tag);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    rbe = gnrc_sixlowpan_frag_rb_get_by_datagram(netif_hdr, tag);
+    if ((rbe != NULL) && (rbe->super.current_size == 0)) {
+        /* datagram is already complete, but the acknowledgment might have
+         * been lost */
+        if (ack_req) {
+            _send_ack(netif_hdr, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len, tag, _full_bitmap);
+        }
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if (seq != 0) {
+        offset = sixlowpan_sfr_rfrag_get_offset(rfrag);
+    }
+    rbe = gnrc_sixlowpan_frag_rb_add(netif_hdr, pkt, offset, page);
+    if (rbe != NULL) {
+        /* acknowledge before the entry is handed up and removed */
+        if (ack_req) {
+            bool complete = (rbe->super.current_size ==
+                             rbe->super.datagram_size);
+
+            _send_ack(netif_hdr, gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len, tag,
+                      complete ? _full_bitmap : rbe->super.received);
+        }
+        gnrc_sixlowpan_frag_rb_dispatch_when_complete(rbe, netif_hdr);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page)
+{
+    gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt,
+                                                          GNRC_NETTYPE_NETIF);
+    sixlowpan_sfr_t *hdr = pkt->data;
+
+    (void)ctx;
+    assert(netif_snip != NULL);
+    if (sixlowpan_sfr_rfrag_is(hdr)) {
+        /* hold netif header to use it after rb_add() released `pkt` */
+        gnrc_pktbuf_hold(netif_snip, 1);
+        _handle_rfrag(netif_snip->data, pkt, netif_snip, page);
+        gnrc_pktbuf_release(netif_snip);
+    }
+    else if (sixlowpan_sfr_ack_is(hdr)) {
+        _handle_ack(netif_snip->data, pkt);
+        gnrc_pktbuf_release(pkt);
+    }
+    else {
+        DEBUG("6lo sfr: unknown header type\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+/** @} */
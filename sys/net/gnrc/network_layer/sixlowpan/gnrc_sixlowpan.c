@@ -13,7 +13,9 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
+#include "kernel_defines.h"
 #include "kernel_types.h"
 #include "net/gnrc.h"
 #include "thread.h"
@@ -23,6 +25,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#endif
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
@@ -114,8 +119,10 @@ void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
         DEBUG("6lo: Dispatch for sending\n");
         gnrc_sixlowpan_dispatch_send(pkt, NULL, page);
     }
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-    else if (orig_datagram_size <= SIXLOWPAN_FRAG_MAX_LEN) {
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG) || defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
+    /* recoverable fragments are not limited by SIXLOWPAN_FRAG_MAX_LEN */
+    else if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) ||
+             (orig_datagram_size <= SIXLOWPAN_FRAG_MAX_LEN)) {
         DEBUG("6lo: Send fragmented (%u > %u)\n",
               (unsigned int)datagram_size, netif->sixlo.max_frag_size);
         gnrc_sixlowpan_frag_fb_t *fbuf;
@@ -136,7 +143,13 @@ void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
         fbuf->hint.fragsz = 0;
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        /* fragments are determined on first send */
+        memset(&fbuf->sfr, 0, sizeof(fbuf->sfr));
+        gnrc_sixlowpan_frag_sfr_send(pkt, fbuf, page);
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
         gnrc_sixlowpan_frag_send(pkt, fbuf, page);
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
     }
 #endif
     else {
@@ -209,6 +222,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
         payload->type = GNRC_NETTYPE_UNDEF;
 #endif
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (sixlowpan_sfr_is((sixlowpan_sfr_t *)dispatch)) {
+        DEBUG("6lo: received 6LoWPAN recoverable fragment\n");
+        gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, 0);
+        return;
+    }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
     else if (sixlowpan_frag_is((sixlowpan_frag_t *)dispatch)) {
         DEBUG("6lo: received 6LoWPAN fragment\n");
@@ -312,6 +332,11 @@ static void *_event_loop(void *args)
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    /* take packets from the network interfaces in batches */
+    gnrc_netreg_entry_init_rx_batch(&me_reg, GNRC_NETREG_DEMUX_CTX_ALL,
+                                    thread_getpid());
+#endif
     /* register interest in all 6LoWPAN packets */
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
 
@@ -329,6 +354,18 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (gnrc_pktsnip_t *pkt = msg.content.ptr, *next; pkt;
+                     pkt = next) {
+                    /* fetch link before the packet is handed over */
+                    next = gnrc_netif_hdr_rx_batch_next(pkt);
+                    _receive(pkt);
+                }
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr);
@@ -343,7 +380,9 @@ static void *_event_loop(void *args)
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_FB
             case GNRC_SIXLOWPAN_FRAG_FB_SND_MSG:
                 DEBUG("6lo: send fragmented event received\n");
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
+                gnrc_sixlowpan_frag_sfr_send(NULL, msg.content.ptr, 0);
+#elif defined(MODULE_GNRC_SIXLOWPAN_FRAG)
                 gnrc_sixlowpan_frag_send(NULL, msg.content.ptr, 0);
 #else   /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
                 DEBUG("6lo: No fragmentation implementation available to sent\n");
@@ -351,6 +390,12 @@ static void *_event_loop(void *args)
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_FB */
                 break;
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+            case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
+                DEBUG("6lo: ARQ timeout event received\n");
+                gnrc_sixlowpan_frag_sfr_arq_timeout(msg.content.ptr);
+                break;
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RB
             case GNRC_SIXLOWPAN_FRAG_RB_GC_MSG:
                 DEBUG("6lo: garbage collect reassembly buffer event received\n");
@@ -26,6 +26,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
 #include "net/gnrc/sixlowpan/frag/vrb.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
@@ -147,6 +150,37 @@ static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page);
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
 
+/**
+ * @brief   Checks if @p sixlo is the first fragment of a datagram fragmented
+ *          with selective fragment recovery
+ *
+ * The datagram size of these is the size of the compressed datagram, so
+ * sizes can only be derived from it like for an unfragmented packet.
+ */
+static inline bool _is_rfrag(const gnrc_pktsnip_t *sixlo)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    return (sixlo->next != NULL) &&
+           (sixlo->next->type == GNRC_NETTYPE_SIXLOWPAN) &&
+           sixlowpan_sfr_rfrag_is(sixlo->next->data);
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+    (void)sixlo;
+    return false;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+}
+
+/**
+ * @brief   Gets the size of the compressed packet (or datagram) @p sixlo is
+ *          part of
+ */
+static inline size_t _compressed_size(const gnrc_pktsnip_t *sixlo,
+                                      const gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    return ((rbuf != NULL) && _is_rfrag(sixlo))
+         ? rbuf->super.datagram_size
+         : sixlo->size;
+}
+
 static size_t _iphc_ipv6_decode(const uint8_t *iphc_hdr,
                                 const gnrc_netif_hdr_t *netif_hdr,
                                 gnrc_netif_t *iface, ipv6_hdr_t *ipv6_hdr)
@@ -560,13 +594,13 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
             offset += tmp;
             /* might be needed to be overwritten by IPv6 reassembly after the IPv6
              * packet was reassembled to get complete length */
-            if (rbuf != NULL) {
+            if ((rbuf != NULL) && !_is_rfrag(sixlo)) {
                 payload_len = rbuf->super.datagram_size - *uncomp_hdr_len-
                               sizeof(ipv6_hdr_t);
             }
             else {
-                payload_len = (sixlo->size + *uncomp_hdr_len) -
-                              sizeof(ipv6_hdr_t) - offset;
+                payload_len = (_compressed_size(sixlo, rbuf) +
+                               *uncomp_hdr_len) - sizeof(ipv6_hdr_t) - offset;
             }
             ipv6_hdr->len = byteorder_htons(payload_len);
             *uncomp_hdr_len += sizeof(ipv6_hdr_t);
@@ -667,11 +701,12 @@ static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
 
     /* might be needed to be overwritten by IPv6 reassembly after the IPv6
      * packet was reassembled to get complete length */
-    if (rbuf != NULL) {
+    if ((rbuf != NULL) && !_is_rfrag(sixlo)) {
         payload_len = rbuf->super.datagram_size - *uncomp_hdr_len;
     }
     else {
-        payload_len = sixlo->size + sizeof(udp_hdr_t) - offset;
+        payload_len = _compressed_size(sixlo, rbuf) + sizeof(udp_hdr_t) -
+                      offset;
     }
     udp_hdr->length = byteorder_htons(payload_len);
     *uncomp_hdr_len += sizeof(udp_hdr_t);
@@ -779,6 +814,23 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
 #endif
     uint16_t payload_len;
     if (rbuf != NULL) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        if (_is_rfrag(sixlo)) {
+            /* recoverable fragments carry the size of the compressed
+             * datagram and offsets into it, so adapt both to the
+             * decompressed header */
+            int16_t diff = uncomp_hdr_len - payload_offset;
+
+            rbuf->super.datagram_size += diff;
+            rbuf->super.offset_diff += diff;
+            if (gnrc_pktbuf_realloc_data(ipv6,
+                                         rbuf->super.datagram_size) != 0) {
+                DEBUG("6lo iphc: no space left to reassemble payload\n");
+                _recv_error_release(sixlo, ipv6, rbuf);
+                return;
+            }
+        }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
         /* for a fragmented datagram we know the overall length already */
         payload_len = (uint16_t)(rbuf->super.datagram_size - sizeof(ipv6_hdr_t));
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
@@ -846,8 +898,6 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                 if ((res = _forward_frag(ipv6, sixlo->next, vrbe, page)) == 0) {
                     DEBUG("6lo iphc: successfully recompressed and forwarded "
                           "1st fragment\n");
-                    /* empty list, as it should be in VRB now */
-                    rbuf->super.ints = NULL;
                 }
             }
             if ((ipv6 == NULL) || (res < 0)) {
@@ -912,6 +962,12 @@ static gnrc_pktsnip_t *_encode_frag_for_forwarding(gnrc_pktsnip_t *decoded_pkt,
 static int _forward_frag(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *frag_hdr,
                          gnrc_sixlowpan_frag_vrb_t *vrbe, unsigned page)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (sixlowpan_sfr_rfrag_is(frag_hdr->data)) {
+        return gnrc_sixlowpan_frag_sfr_forward(pkt, frag_hdr->data, vrbe,
+                                               page);
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
     /* remove rewritten netif header (forwarding implementation must do this
      * anyway) */
     pkt = gnrc_pktbuf_remove_snip(pkt, pkt);
@@ -0,0 +1,487 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer backed by size-segregated slab pools
+ *
+ * Every chunk (packet snip descriptors as well as data) is taken from one of
+ * three pools of equally sized slots: a small pool for descriptors and
+ * protocol headers, a pool for link-layer frames and a pool for full-MTU
+ * payloads. Free slots of each pool are kept in an intrusive singly linked
+ * list, so allocating and freeing a chunk are O(1) and the buffer never
+ * fragments.
+ *
+ * Since a slot can not be split, @ref gnrc_pktbuf_mark() lets the marked
+ * snip and the remaining snip share the slot of the original data. Each slot
+ * therefore carries a reference counter and is only returned to its pool
+ * once no snip points into it anymore.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _ALIGNMENT_MASK     (sizeof(uintptr_t) - 1)
+#define _ALIGN(size)        (((size) + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK))
+
+#define _HDR_SLOT_SIZE      _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE)
+#define _FRAME_SLOT_SIZE    _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE)
+#define _MTU_SLOT_SIZE      _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE)
+
+#define _POOL_NUMOF         (3U)
+
+static_assert(_HDR_SLOT_SIZE >= sizeof(gnrc_pktsnip_t),
+              "CONFIG_GNRC_PKTBUF_SLAB_HDR_SIZE must fit a gnrc_pktsnip_t");
+static_assert((_HDR_SLOT_SIZE < _FRAME_SLOT_SIZE) &&
+              (_FRAME_SLOT_SIZE < _MTU_SLOT_SIZE),
+              "gnrc_pktbuf_slab pools must be ordered by slot size");
+
+/**
+ * @brief   Free slot, linked into the free list of its pool
+ */
+typedef struct _slot {
+    struct _slot *next;
+} _slot_t;
+
+/**
+ * @brief   A pool of equally sized slots
+ */
+typedef struct {
+    uint8_t *buf;           /**< start of the slot storage */
+    uint8_t *refs;          /**< number of snips pointing into each slot */
+    _slot_t *free;          /**< first free slot */
+    uint16_t slot_size;     /**< size of a single slot in bytes */
+    uint16_t numof;         /**< number of slots in the pool */
+    uint16_t used;          /**< number of slots currently in use */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< maximum number of slots ever in use */
+#endif
+} _pool_t;
+
+/* The buffers need to be aligned to word size, so that slots can be casted
+ * to `_slot_t *` safely. Just allocating arrays of (word sized) uintptr_t is
+ * a trivial way to do this */
+static uintptr_t _hdr_buf[(CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF * _HDR_SLOT_SIZE) /
+                          sizeof(uintptr_t)];
+static uintptr_t _frame_buf[(CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF * _FRAME_SLOT_SIZE) /
+                            sizeof(uintptr_t)];
+static uintptr_t _mtu_buf[(CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF * _MTU_SLOT_SIZE) /
+                          sizeof(uintptr_t)];
+static uint8_t _hdr_refs[CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF];
+static uint8_t _frame_refs[CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF];
+static uint8_t _mtu_refs[CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF];
+
+/* ordered by slot size, so the first pool that fits is also the best fit */
+static _pool_t _pools[_POOL_NUMOF] = {
+    {
+        .buf = (uint8_t *)_hdr_buf,
+        .refs = _hdr_refs,
+        .slot_size = _HDR_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF,
+    },
+    {
+        .buf = (uint8_t *)_frame_buf,
+        .refs = _frame_refs,
+        .slot_size = _FRAME_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_FRAME_NUMOF,
+    },
+    {
+        .buf = (uint8_t *)_mtu_buf,
+        .refs = _mtu_refs,
+        .slot_size = _MTU_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_MTU_NUMOF,
+    },
+};
+
+static mutex_t _mutex = MUTEX_INIT;
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_ref(void *data);
+static void _pktbuf_free(void *data);
+
+static inline bool _pool_contains(const _pool_t *pool, const void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - pool->buf) <
+           ((size_t)pool->numof * pool->slot_size);
+}
+
+static inline unsigned _slot_idx(const _pool_t *pool, const void *ptr)
+{
+    return ((uint8_t *)ptr - pool->buf) / pool->slot_size;
+}
+
+static inline uint8_t *_slot_start(const _pool_t *pool, unsigned idx)
+{
+    return pool->buf + ((size_t)idx * pool->slot_size);
+}
+
+static _pool_t *_pool_of(const void *ptr)
+{
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        if (_pool_contains(&_pools[i], ptr)) {
+            return &_pools[i];
+        }
+    }
+    return NULL;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        _pool_t *pool = &_pools[i];
+
+        pool->free = NULL;
+        pool->used = 0;
+        /* link slots in reverse, so lower addresses are handed out first */
+        for (unsigned j = pool->numof; j > 0; j--) {
+            /* slot sizes are aligned to word size, we cast to uintptr_t as
+             * intermediate step to silence -Wcast-align */
+            _slot_t *slot = (_slot_t *)(uintptr_t)_slot_start(pool, j - 1);
+
+            slot->next = pool->free;
+            pool->free = slot;
+            pool->refs[j - 1] = 0;
+        }
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _MTU_SLOT_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE (%u)\n",
+              (unsigned)size, (unsigned)_MTU_SLOT_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size != size) {
+        /* both snips now point into the same slot */
+        _pktbuf_ref(pkt->data);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        /* marked snip takes over the reference of pkt */
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && (_pool_of(pkt->data) != NULL)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size */
+    else if (size > pkt->size) {
+        _pool_t *pool = (pkt->data != NULL) ? _pool_of(pkt->data) : NULL;
+
+        /* grow in place if the slot is not shared and big enough */
+        if ((pool == NULL) ||
+            (pool->refs[_slot_idx(pool, pkt->data)] > 1) ||
+            (((uint8_t *)pkt->data + size) >
+             _slot_start(pool, _slot_idx(pool, pkt->data) + 1))) {
+            void *new_data = _pktbuf_alloc(size);
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {            /* if old data exist */
+                memcpy(new_data, pkt->data, pkt->size);
+                _pktbuf_free(pkt->data);
+            }
+            pkt->data = new_data;
+        }
+    }
+    /* when shrinking the slot is kept as is */
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pool_of(pkt) != NULL);
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[_POOL_NUMOF] = { "hdr", "frame", "mtu" };
+
+    mutex_lock(&_mutex);
+    puts("packet buffer (slab):");
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        const _pool_t *pool = &_pools[i];
+
+        printf("  %-5s: %4u slots of %4u bytes at %p, used: %4u, max used: %4u\n",
+               names[i], pool->numof, pool->slot_size, (void *)pool->buf,
+               pool->used, pool->max_used);
+    }
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        if (_pools[i].used != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall slot in free list of pool: slot is in pool, is aligned to a
+     *    slot boundary and pool->refs[slot] == 0
+     *  - length of free list of pool == pool->numof - pool->used
+     *  - number of slots with pool->refs[slot] > 0 == pool->used
+     */
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        const _pool_t *pool = &_pools[i];
+        unsigned free_numof = 0, used_numof = 0;
+
+        for (_slot_t *slot = pool->free; slot != NULL; slot = slot->next) {
+            if (!_pool_contains(pool, slot) ||
+                (((uint8_t *)slot - pool->buf) % pool->slot_size) ||
+                (pool->refs[_slot_idx(pool, slot)] != 0) ||
+                (++free_numof > pool->numof)) {
+                return false;
+            }
+        }
+        for (unsigned j = 0; j < pool->numof; j++) {
+            if (pool->refs[j] > 0) {
+                used_numof++;
+            }
+        }
+        if ((free_numof != (unsigned)(pool->numof - pool->used)) ||
+            (used_numof != pool->used)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    for (unsigned i = 0; i < _POOL_NUMOF; i++) {
+        _pool_t *pool = &_pools[i];
+        _slot_t *slot = pool->free;
+
+        /* fall through to the next bigger pool if this one is exhausted */
+        if ((size > pool->slot_size) || (slot == NULL)) {
+            continue;
+        }
+        pool->free = slot->next;
+        pool->refs[_slot_idx(pool, slot)] = 1;
+        pool->used++;
+#ifdef DEVELHELP
+        if (pool->used > pool->max_used) {
+            pool->max_used = pool->used;
+        }
+#endif
+        return slot;
+    }
+    DEBUG("pktbuf: no slot left for %u bytes\n", (unsigned)size);
+    return NULL;
+}
+
+static void _pktbuf_ref(void *data)
+{
+    _pool_t *pool = _pool_of(data);
+
+    if (pool != NULL) {
+        unsigned idx = _slot_idx(pool, data);
+
+        assert(pool->refs[idx] < UINT8_MAX);
+        pool->refs[idx]++;
+    }
+}
+
+static void _pktbuf_free(void *data)
+{
+    _pool_t *pool = _pool_of(data);
+    unsigned idx;
+
+    if (pool == NULL) {
+        return;
+    }
+    idx = _slot_idx(pool, data);
+    assert(pool->refs[idx] > 0);
+    if (--pool->refs[idx] == 0) {
+        _slot_t *slot = (_slot_t *)(uintptr_t)_slot_start(pool, idx);
+
+        slot->next = pool->free;
+        pool->free = slot;
+        pool->used--;
+    }
+}
+
+/** @} */
@@ -346,10 +346,30 @@ void gnrc_rpl_delay_dao(gnrc_rpl_dodag_t *dodag)
     evtimer_add_msg(&gnrc_rpl_evtimer, &dodag->dao_event, gnrc_rpl_pid);
     dodag->dao_counter = 0;
     dodag->dao_ack_received = false;
+    dodag->dao_coalescing = false;
+}
+
+void gnrc_rpl_coalesce_dao(gnrc_rpl_dodag_t *dodag)
+{
+    if (dodag->dao_coalescing) {
+        DEBUG("RPL: DAO already scheduled, coalescing\n");
+#ifdef MODULE_NETSTATS_RPL
+        gnrc_rpl_netstats.dao_coalesced_count++;
+#endif
+        return;
+    }
+    evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
+    ((evtimer_event_t *)&(dodag->dao_event))->offset = CONFIG_GNRC_RPL_DAO_COALESCE_DELAY;
+    evtimer_add_msg(&gnrc_rpl_evtimer, &dodag->dao_event, gnrc_rpl_pid);
+    dodag->dao_counter = 0;
+    dodag->dao_ack_received = false;
+    dodag->dao_coalescing = true;
 }
 
 void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag)
 {
+    /* children must not wait for their DAO-ACKs as long */
+    gnrc_rpl_send_pending_DAO_ACKs(dodag->instance);
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
     ((evtimer_event_t *)&(dodag->dao_event))->offset = random_uint32_range(
         CONFIG_GNRC_RPL_DAO_DELAY_LONG,
@@ -358,10 +378,13 @@ void gnrc_rpl_long_delay_dao(gnrc_rpl_dodag_t *dodag)
     evtimer_add_msg(&gnrc_rpl_evtimer, &dodag->dao_event, gnrc_rpl_pid);
     dodag->dao_counter = 0;
     dodag->dao_ack_received = false;
+    dodag->dao_coalescing = false;
 }
 
 void _dao_handle_send(gnrc_rpl_dodag_t *dodag)
 {
+    dodag->dao_coalescing = false;
+    gnrc_rpl_send_pending_DAO_ACKs(dodag->instance);
     if (dodag->node_status == GNRC_RPL_ROOT_NODE) {
         return;
     }
@@ -35,6 +35,7 @@
 #endif
 
 #include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/mrhof.h"
 #include "gnrc_rpl_internal/validation.h"
 
 #ifdef MODULE_GNRC_RPL_P2P
@@ -340,6 +341,69 @@ gnrc_pktsnip_t *_dio_prefix_info_build(gnrc_pktsnip_t *pkt, gnrc_rpl_dodag_t *do
     return opt_snip;
 }
 
+gnrc_pktsnip_t *_dio_mc_etx_build(gnrc_pktsnip_t *pkt, uint16_t etx)
+{
+    gnrc_rpl_opt_mc_etx_t *mc;
+    gnrc_pktsnip_t *opt_snip;
+
+    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_opt_mc_etx_t),
+                                    GNRC_NETTYPE_UNDEF)) == NULL) {
+        DEBUG("RPL: BUILD METRIC CONTAINER - no space left in packet buffer\n");
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    mc = opt_snip->data;
+    mc->type = GNRC_RPL_OPT_DAG_METRIC_CONTAINER;
+    mc->length = GNRC_RPL_OPT_MC_ETX_LEN;
+    mc->obj.type = GNRC_RPL_MC_ETX;
+    /* aggregated additive metric, no flags */
+    mc->obj.flags = byteorder_htons(0);
+    mc->obj.length = sizeof(mc->etx);
+    mc->etx = byteorder_htons(etx);
+    return opt_snip;
+}
+
+/* takes the ETX object of the DAG metric container of a DIO, if any */
+static void _dio_mc_parse(gnrc_rpl_parent_t *parent, gnrc_rpl_opt_t *opt,
+                          uint16_t len)
+{
+    uint16_t l = 0;
+
+    parent->metric_type = 0;
+    while ((l + sizeof(*opt)) <= len) {
+        if (opt->type == GNRC_RPL_OPT_PAD1) {
+            l += 1;
+            opt = (gnrc_rpl_opt_t *)(((uint8_t *)opt) + 1);
+            continue;
+        }
+        if ((l + sizeof(*opt) + opt->length) > len) {
+            return;
+        }
+        if (opt->type == GNRC_RPL_OPT_DAG_METRIC_CONTAINER) {
+            uint8_t *obj = (uint8_t *)(opt + 1);
+            uint8_t *end = obj + opt->length;
+
+            while ((obj + sizeof(gnrc_rpl_mc_obj_t)) <= end) {
+                gnrc_rpl_mc_obj_t *hdr = (gnrc_rpl_mc_obj_t *)obj;
+
+                obj += sizeof(*hdr);
+                if ((obj + hdr->length) > end) {
+                    break;
+                }
+                if ((hdr->type == GNRC_RPL_MC_ETX) &&
+                    (hdr->length == sizeof(network_uint16_t))) {
+                    parent->metric = byteorder_bebuftohs(obj);
+                    parent->metric_type = GNRC_RPL_MC_ETX;
+                    return;
+                }
+                obj += hdr->length;
+            }
+        }
+        l += sizeof(*opt) + opt->length;
+        opt = (gnrc_rpl_opt_t *)(((uint8_t *)(opt + 1)) + opt->length);
+    }
+}
+
 void gnrc_rpl_send_DIO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
 {
     if (inst == NULL) {
@@ -377,6 +441,14 @@ void gnrc_rpl_send_DIO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination)
         dodag->dio_opts &= ~GNRC_RPL_REQ_DIO_OPT_DODAG_CONF;
     }
 
+    if (IS_USED(MODULE_GNRC_RPL_MRHOF) && !IS_ACTIVE(CONFIG_GNRC_RPL_MRHOF_WITHOUT_MC) &&
+        (inst->of->ocp == GNRC_RPL_MRHOF_OCP) &&
+        (dodag->node_status != GNRC_RPL_LEAF_NODE)) {
+        if ((pkt = _dio_mc_etx_build(pkt, gnrc_rpl_mrhof_dodag_path_cost(dodag))) == NULL) {
+            return;
+        }
+    }
+
     if ((tmp = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_dio_t), GNRC_NETTYPE_UNDEF)) == NULL) {
         DEBUG("RPL: Send DIO - no space left in packet buffer\n");
         gnrc_pktbuf_release(pkt);
@@ -493,6 +565,75 @@ static inline uint32_t _sec_to_ms(uint32_t sec)
     }
 }
 
+static bool _ft_has(const ipv6_addr_t *dst, uint8_t dst_len,
+                    const ipv6_addr_t *next_hop, kernel_pid_t iface)
+{
+    void *state = NULL;
+    gnrc_ipv6_nib_ft_t fte;
+
+    while (gnrc_ipv6_nib_ft_iter(next_hop, iface, &state, &fte)) {
+        if ((fte.dst_len == dst_len) &&
+            (ipv6_addr_match_prefix(&fte.dst, dst) >= dst_len)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* installs the route to a DAO target. Routes via the same child to both
+ * halves of a prefix are merged to a route to the prefix. */
+static void _dao_ft_add(gnrc_rpl_dodag_t *dodag, const ipv6_addr_t *dst,
+                        uint8_t dst_len, ipv6_addr_t *next_hop,
+                        uint16_t lifetime)
+{
+    ipv6_addr_t prefix = IPV6_ADDR_UNSPECIFIED;
+    uint8_t len = dst_len;
+
+    /* also removes a route via another child the target moved away from */
+    gnrc_ipv6_nib_ft_del(dst, dst_len);
+    ipv6_addr_init_prefix(&prefix, dst, dst_len);
+    if (dst_len > CONFIG_GNRC_RPL_ROUTE_AGGREGATION_MIN_PREFIX_LEN) {
+        void *state = NULL;
+        gnrc_ipv6_nib_ft_t fte, best = { .dst_len = 0 };
+
+        /* refresh an aggregated route covering the target, unless a more
+         * specific route to another child covers it */
+        while (gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte)) {
+            if ((fte.dst_len > best.dst_len) && (fte.dst_len < dst_len) &&
+                (ipv6_addr_match_prefix(&fte.dst, &prefix) >= fte.dst_len)) {
+                best = fte;
+            }
+        }
+        if ((best.dst_len >= CONFIG_GNRC_RPL_ROUTE_AGGREGATION_MIN_PREFIX_LEN) &&
+            (best.iface == dodag->iface) &&
+            ipv6_addr_equal(&best.next_hop, next_hop)) {
+            prefix = best.dst;
+            len = best.dst_len;
+        }
+    }
+    while (len > CONFIG_GNRC_RPL_ROUTE_AGGREGATION_MIN_PREFIX_LEN) {
+        ipv6_addr_t buddy = prefix;
+
+        buddy.u8[(len - 1) / 8] ^= 0x80 >> ((len - 1) % 8);
+        if (!_ft_has(&buddy, len, next_hop, dodag->iface)) {
+            break;
+        }
+        DEBUG("RPL: aggregating FT entries %s/%u",
+              ipv6_addr_to_str(addr_str, &prefix, sizeof(addr_str)), len);
+        DEBUG(" and %s/%u\n",
+              ipv6_addr_to_str(addr_str, &buddy, sizeof(addr_str)), len);
+        gnrc_ipv6_nib_ft_del(&prefix, len);
+        gnrc_ipv6_nib_ft_del(&buddy, len);
+        len--;
+        prefix.u8[len / 8] &= ~(0x80 >> (len % 8));
+#ifdef MODULE_NETSTATS_RPL
+        gnrc_rpl_netstats.route_aggregated_count++;
+#endif
+    }
+    gnrc_ipv6_nib_ft_del(&prefix, len);
+    gnrc_ipv6_nib_ft_add(&prefix, len, next_hop, dodag->iface, lifetime);
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt, uint16_t len,
                     ipv6_addr_t *src, uint32_t *included_opts)
@@ -621,10 +762,8 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                       ipv6_addr_to_str(addr_str, &(target->target), (unsigned)sizeof(addr_str)),
                       target->prefix_length);
 
-                gnrc_ipv6_nib_ft_del(&(target->target), target->prefix_length);
-                gnrc_ipv6_nib_ft_add(&(target->target), target->prefix_length, src,
-                                     dodag->iface,
-                                     dodag->default_lifetime * dodag->lifetime_unit);
+                _dao_ft_add(dodag, &(target->target), target->prefix_length, src,
+                            dodag->default_lifetime * dodag->lifetime_unit);
                 break;
 
             case (GNRC_RPL_OPT_TRANSIT):
@@ -642,12 +781,9 @@ bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt
                           ipv6_addr_to_str(addr_str, &(first_target->target), sizeof(addr_str)),
                           first_target->prefix_length);
 
-                    gnrc_ipv6_nib_ft_del(&(first_target->target),
-                                         first_target->prefix_length);
-                    gnrc_ipv6_nib_ft_add(&(first_target->target),
-                                         first_target->prefix_length, src,
-                                         dodag->iface,
-                                         transit->path_lifetime * dodag->lifetime_unit);
+                    _dao_ft_add(dodag, &(first_target->target),
+                                first_target->prefix_length, src,
+                                transit->path_lifetime * dodag->lifetime_unit);
 
                     first_target = (gnrc_rpl_opt_target_t *) (((uint8_t *) (first_target)) +
                                    sizeof(gnrc_rpl_opt_t) + first_target->length);
@@ -777,6 +913,7 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
         dodag->prf = dio->g_mop_prf & GNRC_RPL_PRF_MASK;
 
         parent->rank = byteorder_ntohs(dio->rank);
+        _dio_mc_parse(parent, (gnrc_rpl_opt_t *)(dio + 1), len);
 
         uint32_t included_opts = 0;
         if(!_parse_options(GNRC_RPL_ICMPV6_CODE_DIO, inst, (gnrc_rpl_opt_t *)(dio + 1), len,
@@ -885,6 +1022,7 @@ void gnrc_rpl_recv_DIO(gnrc_rpl_dio_t *dio, kernel_pid_t iface, ipv6_addr_t *src
     assert(parent != NULL);
 
     parent->rank = byteorder_ntohs(dio->rank);
+    _dio_mc_parse(parent, (gnrc_rpl_opt_t *)(dio + 1), len);
 
     gnrc_rpl_parent_update(dodag, parent);
 
@@ -1004,17 +1142,20 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     }
     me = &netif->ipv6.addrs[idx];
 
+    /* a single transit option following all targets applies to all of them,
+     * see RFC 6550, section 9.3 */
+    DEBUG("RPL: Send DAO - building transit option\n");
+    if ((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) {
+        DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+        return;
+    }
+
     /* add external and RPL FT entries */
     /* TODO: nib: dropped support for external transit options for now */
     void *ft_state = NULL;
     gnrc_ipv6_nib_ft_t fte;
+    unsigned targets = 1;
     while(gnrc_ipv6_nib_ft_iter(NULL, dodag->iface, &ft_state, &fte)) {
-        DEBUG("RPL: Send DAO - building transit option\n");
-
-        if ((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) {
-            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
-            return;
-        }
         if (ipv6_addr_is_global(&fte.dst) &&
             !ipv6_addr_is_unspecified(&fte.next_hop)) {
             DEBUG("RPL: Send DAO - building target %s/%d\n",
@@ -1024,6 +1165,7 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
                 DEBUG("RPL: Send DAO - no space left in packet buffer\n");
                 return;
             }
+            targets++;
         }
     }
 
@@ -1079,6 +1221,9 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
 #ifdef MODULE_NETSTATS_RPL
     gnrc_rpl_netstats_tx_DAO(&gnrc_rpl_netstats, gnrc_pkt_len(pkt),
                              (destination && !ipv6_addr_is_multicast(destination)));
+    gnrc_rpl_netstats.dao_tx_target_count += targets;
+#else
+    (void)targets;
 #endif
 
     gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
@@ -1136,6 +1281,54 @@ void gnrc_rpl_send_DAO_ACK(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination,
     gnrc_rpl_send(pkt, dodag->iface, NULL, destination, &dodag->dodag_id);
 }
 
+/* DAO-ACKs are sent with the DAO the DAO of a child triggered, so a child
+ * sending several DAOs in the meantime gets only a single DAO-ACK */
+static struct {
+    gnrc_rpl_instance_t *inst;      /**< NULL, if unused */
+    ipv6_addr_t dst;                /**< child to acknowledge */
+    uint8_t seq;                    /**< DAO sequence to acknowledge */
+} _dao_acks[CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF];
+
+static void _dao_ack_schedule(gnrc_rpl_instance_t *inst, ipv6_addr_t *dst,
+                              uint8_t seq)
+{
+    unsigned free = CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF; i++) {
+        if (_dao_acks[i].inst == NULL) {
+            free = i;
+        }
+        else if ((_dao_acks[i].inst == inst) &&
+                 ipv6_addr_equal(&_dao_acks[i].dst, dst)) {
+            DEBUG("RPL: DAO-ACK for sequence %u superseded by %u\n",
+                  _dao_acks[i].seq, seq);
+            _dao_acks[i].seq = seq;
+#ifdef MODULE_NETSTATS_RPL
+            gnrc_rpl_netstats.dao_ack_batched_count++;
+#endif
+            return;
+        }
+    }
+    if (free == CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF) {
+        DEBUG("RPL: no slot for pending DAO-ACK left, sending it now\n");
+        gnrc_rpl_send_DAO_ACK(inst, dst, seq);
+        return;
+    }
+    _dao_acks[free].inst = inst;
+    _dao_acks[free].dst = *dst;
+    _dao_acks[free].seq = seq;
+}
+
+void gnrc_rpl_send_pending_DAO_ACKs(gnrc_rpl_instance_t *inst)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_RPL_DAO_ACK_PENDING_NUMOF; i++) {
+        if (_dao_acks[i].inst == inst) {
+            _dao_acks[i].inst = NULL;
+            gnrc_rpl_send_DAO_ACK(inst, &_dao_acks[i].dst, _dao_acks[i].seq);
+        }
+    }
+}
+
 void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src, ipv6_addr_t *dst,
                        uint16_t len)
 {
@@ -1196,10 +1389,10 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
 
     /* send a DAO-ACK if K flag is set */
     if (dao->k_d_flags & GNRC_RPL_DAO_K_BIT) {
-        gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
+        _dao_ack_schedule(inst, src, dao->dao_sequence);
     }
 
-    gnrc_rpl_delay_dao(dodag);
+    gnrc_rpl_coalesce_dao(dodag);
 }
 
 void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6_addr_t *src,
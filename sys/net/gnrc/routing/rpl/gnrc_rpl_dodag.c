@@ -128,6 +128,8 @@ bool gnrc_rpl_instance_remove(gnrc_rpl_instance_t *inst)
 #endif
     gnrc_rpl_dodag_remove_all_parents(dodag);
     trickle_stop(&dodag->trickle);
+    /* the routes of the children were installed, so do not leave them waiting */
+    gnrc_rpl_send_pending_DAO_ACKs(inst);
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&dodag->dao_event);
     evtimer_del(&gnrc_rpl_evtimer, (evtimer_event_t *)&inst->cleanup_event);
     memset(inst, 0, sizeof(gnrc_rpl_instance_t));
@@ -164,6 +166,7 @@ bool gnrc_rpl_dodag_init(gnrc_rpl_instance_t *instance, ipv6_addr_t *dodag_id, k
     dodag->dao_seq = GNRC_RPL_COUNTER_INIT;
     dodag->dtsn = 0;
     dodag->dao_ack_received = false;
+    dodag->dao_coalescing = false;
     dodag->dao_counter = 0;
     dodag->instance = instance;
     dodag->iface = iface;
@@ -331,6 +334,14 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
     LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
     new_best = dodag->parents;
 
+    if ((new_best != old_best) && (dodag->instance->of->parent_switch != NULL) &&
+        !dodag->instance->of->parent_switch(old_best, new_best)) {
+        /* keep the current preferred parent (hysteresis) */
+        LL_DELETE(dodag->parents, old_best);
+        LL_PREPEND(dodag->parents, old_best);
+        new_best = old_best;
+    }
+
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
         return NULL;
     }
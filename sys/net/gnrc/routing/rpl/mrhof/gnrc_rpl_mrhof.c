@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
+static void reset(gnrc_rpl_dodag_t *);
+static bool parent_switch(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    .ocp          = GNRC_RPL_MRHOF_OCP,
+    .calc_rank    = calc_rank,
+    .parent_cmp   = parent_cmp,
+    .which_dodag  = which_dodag,
+    .reset        = reset,
+    .parent_state_callback = NULL,
+    .init         = NULL,
+    .process_dio  = NULL,
+    .parent_switch = parent_switch
+};
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+static uint16_t _add(uint16_t a, uint16_t b)
+{
+    uint32_t res = (uint32_t)a + b;
+
+    return (res > GNRC_RPL_INFINITE_RANK) ? GNRC_RPL_INFINITE_RANK : res;
+}
+
+uint16_t gnrc_rpl_mrhof_link_metric(const gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint16_t etx = CONFIG_NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    int l2addr_len;
+
+    if ((netif == NULL) || !(netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        return etx;
+    }
+    /* parents are known by their link-local address, so the IID is derived
+     * from their link-layer address */
+    l2addr_len = gnrc_netif_ipv6_iid_to_addr(netif,
+                                             (const eui64_t *)&parent->addr.u64[1],
+                                             l2addr);
+    if (l2addr_len > 0) {
+        const netstats_nb_t *nb;
+
+        gnrc_netif_acquire(netif);
+        nb = netstats_nb_get(&netif->neighbors, l2addr, l2addr_len);
+        if (nb != NULL) {
+            etx = nb->etx;
+        }
+        gnrc_netif_release(netif);
+    }
+    return etx;
+}
+
+static uint16_t _path_cost(const gnrc_rpl_parent_t *parent,
+                           uint16_t link_metric)
+{
+    if (parent->rank == GNRC_RPL_INFINITE_RANK) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    /* RFC 6719, section 3.1: without a metric container the rank is the
+     * path cost */
+    return _add((parent->metric_type == GNRC_RPL_MC_ETX) ? parent->metric
+                                                         : parent->rank,
+                link_metric);
+}
+
+uint16_t gnrc_rpl_mrhof_path_cost(const gnrc_rpl_parent_t *parent)
+{
+    return _path_cost(parent, gnrc_rpl_mrhof_link_metric(parent));
+}
+
+uint16_t gnrc_rpl_mrhof_dodag_path_cost(const gnrc_rpl_dodag_t *dodag)
+{
+    if (dodag->node_status == GNRC_RPL_ROOT_NODE) {
+        return 0;
+    }
+    if (dodag->parents == NULL) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return gnrc_rpl_mrhof_path_cost(dodag->parents);
+}
+
+/* RFC 6719, section 3.3: rank of a path through parent */
+static uint16_t _rank_via(const gnrc_rpl_parent_t *parent, uint16_t mhri)
+{
+    uint16_t link_metric = gnrc_rpl_mrhof_link_metric(parent);
+
+    return _add(parent->rank, (link_metric < mhri) ? mhri : link_metric);
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    /* Nothing to do in MRHOF */
+    (void) dodag;
+}
+
+uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
+{
+    uint16_t mhri = dodag->instance->min_hop_rank_inc;
+    uint16_t max_rank_inc = dodag->instance->max_rank_inc;
+    uint16_t rank, highest_rank = 0, highest_via = 0;
+
+    if (base_rank != 0) {
+        /* no parent to take a link metric from */
+        return _add(base_rank, mhri);
+    }
+    if (dodag->parents == NULL) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    /* the maximum of the rank through the preferred parent, ... */
+    rank = _rank_via(dodag->parents, mhri);
+    for (gnrc_rpl_parent_t *elt = dodag->parents; elt != NULL; elt = elt->next) {
+        uint16_t via;
+
+        if (elt->rank == GNRC_RPL_INFINITE_RANK) {
+            continue;
+        }
+        if (elt->rank > highest_rank) {
+            highest_rank = elt->rank;
+        }
+        via = _rank_via(elt, mhri);
+        if (via > highest_via) {
+            highest_via = via;
+        }
+    }
+    /* ... the highest rank in the parent set rounded to the next higher
+     * integral rank, ... */
+    highest_rank = _add((highest_rank / mhri) * mhri, mhri);
+    if (highest_rank > rank) {
+        rank = highest_rank;
+    }
+    /* ... and the highest rank through any parent minus MaxRankIncrease */
+    if ((max_rank_inc > 0) && (highest_via > max_rank_inc) &&
+        ((highest_via - max_rank_inc) > rank)) {
+        rank = highest_via - max_rank_inc;
+    }
+    return rank;
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    uint16_t link1 = gnrc_rpl_mrhof_link_metric(parent1);
+    uint16_t link2 = gnrc_rpl_mrhof_link_metric(parent2);
+    bool bad1 = link1 > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC;
+    bool bad2 = link2 > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC;
+    uint16_t cost1, cost2;
+
+    if (bad1 != bad2) {
+        return (bad1) ? 1 : -1;
+    }
+    cost1 = _path_cost(parent1, link1);
+    cost2 = _path_cost(parent2, link2);
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+bool parent_switch(gnrc_rpl_parent_t *cur, gnrc_rpl_parent_t *cand)
+{
+    uint16_t cur_link = gnrc_rpl_mrhof_link_metric(cur);
+    uint16_t cand_link = gnrc_rpl_mrhof_link_metric(cand);
+    uint16_t cur_cost = _path_cost(cur, cur_link);
+    uint16_t cand_cost = _path_cost(cand, cand_link);
+
+    if ((cur_cost == GNRC_RPL_INFINITE_RANK) ||
+        ((cur_link > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC) &&
+         (cand_link <= CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC))) {
+        return true;
+    }
+    DEBUG("RPL: MRHOF path cost %u of current, %u of candidate parent\n",
+          cur_cost, cand_cost);
+    return ((uint32_t)cand_cost + CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD) <
+           cur_cost;
+}
+
+/* Not used yet */
+gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dodag_t *d2)
+{
+    (void) d2;
+    return d1;
+}
+
+/** @} */
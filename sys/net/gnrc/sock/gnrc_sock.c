@@ -88,10 +88,31 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_register(type, &reg->entry);
 }
 
+void gnrc_sock_get_remote(gnrc_pktsnip_t *pkt, sock_ip_ep_t *remote)
+{
+    gnrc_pktsnip_t *netif;
+
+    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
+     * was implemented */
+    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
+    assert(ipv6_hdr != NULL);
+    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
+    remote->family = AF_INET6;
+    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif == NULL) {
+        remote->netif = SOCK_ADDR_ANY_NETIF;
+    }
+    else {
+        gnrc_netif_hdr_t *netif_hdr = netif->data;
+        /* TODO: use API in #5511 */
+        remote->netif = (uint16_t)netif_hdr->if_pid;
+    }
+}
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote)
 {
-    gnrc_pktsnip_t *pkt, *netif;
+    gnrc_pktsnip_t *pkt;
     msg_t msg;
 
     /* The fuzzing module is only enabled when building a fuzzing
@@ -144,21 +165,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
-    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
-     * was implemented */
-    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
-    assert(ipv6_hdr != NULL);
-    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
-    remote->family = AF_INET6;
-    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
-    if (netif == NULL) {
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-    }
-    else {
-        gnrc_netif_hdr_t *netif_hdr = netif->data;
-        /* TODO: use API in #5511 */
-        remote->netif = (uint16_t)netif_hdr->if_pid;
-    }
+    gnrc_sock_get_remote(pkt, remote);
     *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
@@ -173,16 +180,37 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+unsigned gnrc_sock_recv_many(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkts,
+                             unsigned num)
+{
+    msg_t msgs[GNRC_SOCK_MBOX_SIZE];
+    unsigned count = 0, got;
+
+    if (num > GNRC_SOCK_MBOX_SIZE) {
+        num = GNRC_SOCK_MBOX_SIZE;
+    }
+    got = mbox_try_get_many(&reg->mbox, msgs, num);
+    for (unsigned i = 0; i < got; i++) {
+        /* a timeout message of an earlier receive that was queued after its
+         * timer was removed is skipped */
+        if (msgs[i].type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            pkts[count++] = msgs[i].content.ptr;
+        }
+    }
+#if IS_ACTIVE(SOCK_HAS_ASYNC)
+    if (reg->async_cb.generic && cib_avail(&reg->mbox.cib)) {
+        reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
+    }
+#endif
+    return count;
+}
+
+int gnrc_sock_build(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_pktsnip_t **pkt_out)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
@@ -199,10 +227,6 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
-            }
-            else {
-                type = payload->type;
             }
             hdr = pkt->data;
             hdr->nh = nh;
@@ -234,10 +258,15 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         netif_hdr->if_pid = iface;
         pkt = gnrc_pkt_prepend(pkt, netif);
     }
+    *pkt_out = pkt;
+    return 0;
+}
+
+int gnrc_sock_send_pkt(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
 #ifdef MODULE_GNRC_NETERR
-    /* cppcheck-suppress uninitvar
-     * (reason: pkt is initialized in AF_INET6 case above, otherwise function
-     * will return early) */
+    unsigned status_subs = 0;
+
     for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
@@ -280,6 +309,38 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         last_status = err_report.content.value;
     }
 #endif
+    return 0;
+}
+
+int gnrc_sock_send_many(gnrc_pktsnip_t **pkts, unsigned num,
+                        gnrc_nettype_t type)
+{
+    if (!gnrc_netapi_dispatch_send_many(type, GNRC_NETREG_DEMUX_CTX_ALL, pkts,
+                                        num)) {
+        /* this should not happen, but just in case */
+        for (unsigned i = 0; i < num; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        return -EBADMSG;
+    }
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int res;
+
+    res = gnrc_sock_build(payload, local, remote, nh, &pkt);
+    if (res < 0) {
+        return res;
+    }
+    res = gnrc_sock_send_pkt(pkt, payload->type);
+    if (res < 0) {
+        return res;
+    }
     return payload_len;
 }
 
@@ -118,12 +118,61 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote);
 
+/**
+ * @brief   Take the packets already queued for a sock internally
+ * @internal
+ *
+ * Never blocks, the mailbox of @p reg is drained in a single pass.
+ *
+ * @return  Number of packets stored in @p pkts, at most @p num
+ */
+unsigned gnrc_sock_recv_many(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkts,
+                             unsigned num);
+
+/**
+ * @brief   Get the remote end point of a received packet internally
+ * @internal
+ */
+void gnrc_sock_get_remote(gnrc_pktsnip_t *pkt, sock_ip_ep_t *remote);
+
 /**
  * @brief   Send a packet internally
  * @internal
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Build the network layer headers of a packet internally
+ * @internal
+ *
+ * @p payload is released on error, except for -ENOMEM of the IP header.
+ *
+ * @return  0 on success, with the complete packet in @p pkt_out
+ */
+int gnrc_sock_build(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_pktsnip_t **pkt_out);
+
+/**
+ * @brief   Send a packet built with gnrc_sock_build() internally
+ * @internal
+ *
+ * @return  0 on success
+ */
+int gnrc_sock_send_pkt(gnrc_pktsnip_t *pkt, gnrc_nettype_t type);
+
+/**
+ * @brief   Send multiple packets built with gnrc_sock_build() internally
+ * @internal
+ *
+ * All packets are passed to the network stack at once. Delivery errors are
+ * not reported per packet.
+ *
+ * @return  0 on success
+ */
+int gnrc_sock_send_many(gnrc_pktsnip_t **pkts, unsigned num,
+                        gnrc_nettype_t type);
 /**
  * @}
  */
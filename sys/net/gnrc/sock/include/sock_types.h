@@ -34,6 +34,11 @@
 #endif
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef MODULE_GNRC_SOCK_TCP
+#include "mutex.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "net/sock/tcp.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -136,6 +141,30 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+#if defined(MODULE_GNRC_SOCK_TCP) || defined(DOXYGEN)
+/**
+ * @brief   TCP sock type
+ * @internal
+ */
+struct sock_tcp {
+    gnrc_tcp_tcb_t tcb;                    /**< TCB of the connection */
+    sock_tcp_queue_t *queue;               /**< listening queue the sock belongs to */
+    bool used;                             /**< sock of a queue is connected */
+};
+
+/**
+ * @brief   TCP listening queue type
+ * @internal
+ */
+struct sock_tcp_queue {
+    mutex_t lock;                          /**< protects sock_tcp::used */
+    sock_tcp_ep_t local;                   /**< local end-point */
+    sock_tcp_t *array;                     /**< socks to accept connections with */
+    unsigned len;                          /**< length of sock_tcp_queue::array */
+    uint16_t flags;                        /**< option flags */
+};
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       GNRC implementation of @ref net_sock_tcp
+ *
+ * The TCB of @ref net_gnrc_tcp handles a single connection and
+ * gnrc_tcp_open_passive() blocks until a peer connected, so
+ * sock_tcp_accept() always blocks until a connection was established
+ * regardless of its timeout.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/tcp.h"
+#include "net/sock/tcp.h"
+#include "timex.h"
+
+#include "gnrc_sock_internal.h"
+
+/**
+ * @brief   Converts a sock timeout to a gnrc_tcp user timeout
+ */
+static uint32_t _timeout_ms(uint32_t timeout)
+{
+    if (timeout == SOCK_NO_TIMEOUT) {
+        return UINT32_MAX;
+    }
+    /* round up, 0 stays non-blocking */
+    return (timeout / US_PER_MS) + ((timeout % US_PER_MS) ? 1 : 0);
+}
+
+static int _ep_from_sock(gnrc_tcp_ep_t *ep, const sock_tcp_ep_t *sock_ep)
+{
+    const uint8_t *addr = NULL;
+    size_t addr_size = 0;
+
+    if (sock_ep->family == AF_INET6) {
+        addr = sock_ep->addr.ipv6;
+        addr_size = sizeof(sock_ep->addr.ipv6);
+    }
+    return gnrc_tcp_ep_init(ep, sock_ep->family, addr, addr_size,
+                            sock_ep->port, sock_ep->netif);
+}
+
+static void _ep_from_tcb(sock_tcp_ep_t *ep, const uint8_t *addr, uint16_t port,
+                         const gnrc_tcp_tcb_t *tcb)
+{
+    memset(ep, 0, sizeof(*ep));
+    ep->family = tcb->address_family;
+    memcpy(ep->addr.ipv6, addr, sizeof(ep->addr.ipv6));
+    ep->netif = (tcb->ll_iface > 0) ? (uint16_t)tcb->ll_iface : SOCK_ADDR_ANY_NETIF;
+    ep->port = port;
+}
+
+int sock_tcp_connect(sock_tcp_t *sock, const sock_tcp_ep_t *remote,
+                     uint16_t local_port, uint16_t flags)
+{
+    gnrc_tcp_ep_t ep;
+    int res;
+
+    assert(sock != NULL);
+    assert((remote != NULL) && (remote->port != 0));
+    (void)flags;
+
+    if ((res = _ep_from_sock(&ep, remote)) < 0) {
+        return res;
+    }
+    sock->queue = NULL;
+    sock->used = true;
+    gnrc_tcp_tcb_init(&sock->tcb);
+    res = gnrc_tcp_open_active(&sock->tcb, &ep, local_port);
+    if (res < 0) {
+        sock->used = false;
+    }
+    return res;
+}
+
+int sock_tcp_listen(sock_tcp_queue_t *queue, const sock_tcp_ep_t *local,
+                    sock_tcp_t *queue_array, unsigned queue_len,
+                    uint16_t flags)
+{
+    assert(queue != NULL);
+    assert((local != NULL) && (local->port != 0));
+    assert((queue_array != NULL) && (queue_len != 0));
+
+    if (local->family != AF_INET6) {
+        return -EAFNOSUPPORT;
+    }
+    mutex_init(&queue->lock);
+    memcpy(&queue->local, local, sizeof(queue->local));
+    queue->array = queue_array;
+    queue->len = queue_len;
+    queue->flags = flags;
+    for (unsigned i = 0; i < queue_len; i++) {
+        queue_array[i].queue = queue;
+        queue_array[i].used = false;
+    }
+    return 0;
+}
+
+void sock_tcp_disconnect(sock_tcp_t *sock)
+{
+    assert(sock != NULL);
+
+    if (!sock->used) {
+        return;
+    }
+    gnrc_tcp_close(&sock->tcb);
+    if (sock->queue != NULL) {
+        mutex_lock(&sock->queue->lock);
+        sock->used = false;
+        mutex_unlock(&sock->queue->lock);
+    }
+    else {
+        sock->used = false;
+    }
+}
+
+void sock_tcp_stop_listen(sock_tcp_queue_t *queue)
+{
+    assert(queue != NULL);
+
+    for (unsigned i = 0; i < queue->len; i++) {
+        sock_tcp_disconnect(&queue->array[i]);
+        queue->array[i].queue = NULL;
+    }
+    queue->array = NULL;
+    queue->len = 0;
+}
+
+int sock_tcp_get_local(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert((sock != NULL) && (ep != NULL));
+
+    if (!sock->used) {
+        return -EADDRNOTAVAIL;
+    }
+    _ep_from_tcb(ep, sock->tcb.local_addr, sock->tcb.local_port, &sock->tcb);
+    return 0;
+}
+
+int sock_tcp_get_remote(sock_tcp_t *sock, sock_tcp_ep_t *ep)
+{
+    assert((sock != NULL) && (ep != NULL));
+
+    if (!sock->used || (sock->tcb.peer_port == 0)) {
+        return -ENOTCONN;
+    }
+    _ep_from_tcb(ep, sock->tcb.peer_addr, sock->tcb.peer_port, &sock->tcb);
+    return 0;
+}
+
+int sock_tcp_queue_get_local(sock_tcp_queue_t *queue, sock_tcp_ep_t *ep)
+{
+    assert((queue != NULL) && (ep != NULL));
+
+    if (queue->array == NULL) {
+        return -EADDRNOTAVAIL;
+    }
+    memcpy(ep, &queue->local, sizeof(*ep));
+    return 0;
+}
+
+int sock_tcp_accept(sock_tcp_queue_t *queue, sock_tcp_t **sock,
+                    uint32_t timeout)
+{
+    sock_tcp_t *new_sock = NULL;
+    gnrc_tcp_ep_t ep;
+    int res;
+
+    assert((queue != NULL) && (sock != NULL));
+    (void)timeout;
+
+    if (queue->array == NULL) {
+        return -EINVAL;
+    }
+    if ((res = _ep_from_sock(&ep, &queue->local)) < 0) {
+        return res;
+    }
+
+    mutex_lock(&queue->lock);
+    for (unsigned i = 0; i < queue->len; i++) {
+        if (!queue->array[i].used) {
+            new_sock = &queue->array[i];
+            new_sock->used = true;
+            break;
+        }
+    }
+    mutex_unlock(&queue->lock);
+    if (new_sock == NULL) {
+        return -ENOMEM;
+    }
+
+    gnrc_tcp_tcb_init(&new_sock->tcb);
+    res = gnrc_tcp_open_passive(&new_sock->tcb, &ep);
+    if (res < 0) {
+        mutex_lock(&queue->lock);
+        new_sock->used = false;
+        mutex_unlock(&queue->lock);
+        return (res == -EISCONN) ? -ECONNABORTED : res;
+    }
+    *sock = new_sock;
+    return 0;
+}
+
+ssize_t sock_tcp_read(sock_tcp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout)
+{
+    assert((sock != NULL) && (data != NULL) && (max_len > 0));
+
+    if (!sock->used) {
+        return -ENOTCONN;
+    }
+    return gnrc_tcp_recv(&sock->tcb, data, max_len, _timeout_ms(timeout));
+}
+
+ssize_t sock_tcp_read_buf(sock_tcp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout)
+{
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+
+    if (!sock->used) {
+        *buf_ctx = NULL;
+        return -ENOTCONN;
+    }
+    return gnrc_tcp_recv_buf(&sock->tcb, data, buf_ctx, _timeout_ms(timeout));
+}
+
+ssize_t sock_tcp_write(sock_tcp_t *sock, const void *data, size_t len)
+{
+    assert(sock != NULL);
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+
+    if (!sock->used) {
+        return -ENOTCONN;
+    }
+    if (len == 0) {
+        return 0;
+    }
+    return gnrc_tcp_send(&sock->tcb, data, len, 0);
+}
+
+/** @} */
@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "kernel_defines.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -30,6 +31,12 @@
 
 #include "gnrc_sock_internal.h"
 
+/**
+ * @brief   Number of packets sock_udp_send_many() passes to the network stack
+ *          at once
+ */
+#define GNRC_SOCK_UDP_SEND_MANY_CHUNK   (8U)
+
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
 #endif
@@ -174,6 +181,33 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *remote)
     return 0;
 }
 
+/* sets the remote end point of a received packet and checks it against the
+ * remote of sock, tmp is the remote from the network layer */
+static int _check_remote(sock_udp_t *sock, gnrc_pktsnip_t *pkt,
+                         const sock_ip_ep_t *tmp, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    udp_hdr_t *hdr;
+
+    assert(udp);
+    hdr = udp->data;
+    if (remote != NULL) {
+        /* return remote to possibly block if wrong remote */
+        memcpy(remote, tmp, sizeof(*tmp));
+        remote->port = byteorder_ntohs(hdr->src_port);
+    }
+    if ((sock->remote.family != AF_UNSPEC) &&  /* check remote end-point if set */
+        ((sock->remote.port != byteorder_ntohs(hdr->src_port)) ||
+        /* We only have IPv6 for now, so just comparing the whole end point
+         * should suffice */
+        ((memcmp(&sock->remote.addr, &ipv6_addr_unspecified,
+                 sizeof(ipv6_addr_t)) != 0) &&
+         (memcmp(&sock->remote.addr, &tmp->addr, sizeof(ipv6_addr_t)) != 0)))) {
+        return -EPROTO;
+    }
+    return 0;
+}
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -198,8 +232,7 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
 ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
                           uint32_t timeout, sock_udp_ep_t *remote)
 {
-    gnrc_pktsnip_t *pkt, *udp;
-    udp_hdr_t *hdr;
+    gnrc_pktsnip_t *pkt;
     sock_ip_ep_t tmp;
     int res;
 
@@ -218,23 +251,10 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
     if (res < 0) {
         return res;
     }
-    udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
-    assert(udp);
-    hdr = udp->data;
-    if (remote != NULL) {
-        /* return remote to possibly block if wrong remote */
-        memcpy(remote, &tmp, sizeof(tmp));
-        remote->port = byteorder_ntohs(hdr->src_port);
-    }
-    if ((sock->remote.family != AF_UNSPEC) &&  /* check remote end-point if set */
-        ((sock->remote.port != byteorder_ntohs(hdr->src_port)) ||
-        /* We only have IPv6 for now, so just comparing the whole end point
-         * should suffice */
-        ((memcmp(&sock->remote.addr, &ipv6_addr_unspecified,
-                 sizeof(ipv6_addr_t)) != 0) &&
-         (memcmp(&sock->remote.addr, &tmp.addr, sizeof(ipv6_addr_t)) != 0)))) {
+    res = _check_remote(sock, pkt, &tmp, remote);
+    if (res < 0) {
         gnrc_pktbuf_release(pkt);
-        return -EPROTO;
+        return res;
     }
     *data = pkt->data;
     *buf_ctx = pkt;
@@ -242,10 +262,10 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+/* checks the end points and builds the complete packet to send */
+static int _build(sock_udp_t *sock, const void *data, size_t len,
+                  const sock_udp_ep_t *remote, gnrc_pktsnip_t **pkt_out)
 {
-    int res;
     gnrc_pktsnip_t *payload, *pkt;
     uint16_t src_port = 0, dst_port;
     sock_ip_ep_t local;
@@ -335,17 +355,139 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
-    if (res > 0) {
-        res -= sizeof(udp_hdr_t);
-    }
+    return gnrc_sock_build(pkt, &local, rem, PROTNUM_UDP, pkt_out);
+}
+
 #ifdef SOCK_HAS_ASYNC
+static void _sent(sock_udp_t *sock)
+{
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+}
+#else
+static inline void _sent(sock_udp_t *sock)
+{
+    (void)sock;
+}
 #endif  /* SOCK_HAS_ASYNC */
-    return res;
+
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    res = _build(sock, data, len, remote, &pkt);
+    if (res < 0) {
+        return res;
+    }
+    res = gnrc_sock_send_pkt(pkt, GNRC_NETTYPE_UDP);
+    _sent(sock);
+    return (res < 0) ? res : (ssize_t)len;
+}
+
+/* copies the payload of a received packet, truncated to the buffer space */
+static void _copy_msg(sock_udp_msg_t *msg, const gnrc_pktsnip_t *pkt)
+{
+    size_t len = pkt->size;
+
+    msg->flags = 0;
+    if (len > msg->len) {
+        len = msg->len;
+        msg->flags |= SOCK_UDP_MSG_FLAG_TRUNC;
+    }
+    memcpy(msg->data, pkt->data, len);
+    msg->msg_len = len;
+}
+
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count, uint32_t timeout)
+{
+    gnrc_pktsnip_t *pkts[GNRC_SOCK_MBOX_SIZE];
+    void *data = NULL, *ctx = NULL;
+    size_t num = 1;
+    unsigned max, got;
+    ssize_t res;
+
+    assert((sock != NULL) && (msgs != NULL) && (count > 0));
+    /* only block for the first message */
+    res = sock_udp_recv_buf(sock, &data, &ctx, timeout, &msgs[0].remote);
+    if (res < 0) {
+        return res;
+    }
+    _copy_msg(&msgs[0], ctx);
+    gnrc_pktbuf_release(ctx);
+    /* take all further messages from the mbox in one pass */
+    max = ((count - 1) < ARRAY_SIZE(pkts)) ? (count - 1) : ARRAY_SIZE(pkts);
+    got = gnrc_sock_recv_many(&sock->reg, pkts, max);
+    for (unsigned i = 0; i < got; i++) {
+        sock_ip_ep_t tmp;
+
+        gnrc_sock_get_remote(pkts[i], &tmp);
+        /* messages from a wrong remote are skipped */
+        if (_check_remote(sock, pkts[i], &tmp, &msgs[num].remote) == 0) {
+            _copy_msg(&msgs[num++], pkts[i]);
+        }
+        gnrc_pktbuf_release(pkts[i]);
+    }
+    return num;
+}
+
+ssize_t sock_udp_send_many(sock_udp_t *sock, sock_udp_msg_t *msgs,
+                           size_t count)
+{
+    size_t num = 0;
+    ssize_t res = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (count > 0));
+#ifdef MODULE_GNRC_NETERR
+    /* the status of each packet is only reported to a single send */
+    while (num < count) {
+        sock_udp_msg_t *msg = &msgs[num];
+
+        res = sock_udp_send(sock, msg->data, msg->len,
+                            (msg->remote.port != 0) ? &msg->remote : NULL);
+        if (res < 0) {
+            break;
+        }
+        msg->msg_len = res;
+        num++;
+    }
+#else
+    gnrc_pktsnip_t *pkts[GNRC_SOCK_UDP_SEND_MANY_CHUNK];
+
+    while ((num < count) && (res == 0)) {
+        unsigned built = 0;
+
+        while (((num + built) < count) && (built < ARRAY_SIZE(pkts))) {
+            sock_udp_msg_t *msg = &msgs[num + built];
+
+            res = _build(sock, msg->data, msg->len,
+                         (msg->remote.port != 0) ? &msg->remote : NULL,
+                         &pkts[built]);
+            if (res < 0) {
+                break;
+            }
+            msg->msg_len = msg->len;
+            built++;
+        }
+        if (built == 0) {
+            break;
+        }
+        /* pass all packets built to the network stack at once */
+        if (gnrc_sock_send_many(pkts, built, GNRC_NETTYPE_UDP) < 0) {
+            res = -EBADMSG;
+            break;
+        }
+        for (unsigned i = 0; i < built; i++) {
+            _sent(sock);
+        }
+        num += built;
+    }
+#endif
+    return (num > 0) ? (ssize_t)num : res;
 }
 
 #ifdef SOCK_HAS_ASYNC
@@ -483,13 +483,21 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local)
 #endif
 }
 
-ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
-                      const uint32_t timeout_duration_ms)
+/**
+ * @brief Sends data and waits until it was acknowledged.
+ *
+ * @param[in,out] tcb                   TCB holding the connection information.
+ * @param[in]     data                  Data to send. Unused if @p pkt is not NULL.
+ * @param[in,out] pkt                   Snips to send or NULL. Sent snips are released.
+ * @param[in]     len                   Number of bytes to send.
+ * @param[in]     timeout_duration_ms   User specified timeout in milliseconds.
+ *
+ * @returns   See gnrc_tcp_send().
+ */
+static ssize_t _send(gnrc_tcp_tcb_t *tcb, const void *data, gnrc_pktsnip_t **pkt,
+                     const size_t len, const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
-    assert(tcb != NULL);
-    assert(data != NULL);
-
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -497,6 +505,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     evtimer_mbox_event_t event_probe_timeout;
     uint32_t probe_timeout_duration_ms = 0;
     ssize_t ret = 0;
+    size_t sent = 0;
     bool probing_mode = false;
 
     /* Lock the TCB for this function call */
@@ -521,8 +530,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until everything was sent and acked */
+    while (ret >= 0 && (sent < len || tcb->rtx_num > 0)) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
@@ -543,9 +552,15 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data as far as the windows allow, if we are not probing */
+        if (sent < len && !probing_mode) {
+            if (pkt != NULL) {
+                sent += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND_PKT, NULL, pkt, len - sent);
+            }
+            else {
+                sent += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *) data + sent,
+                                      len - sent);
+            }
         }
 
         /* Wait for responses */
@@ -606,16 +621,53 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     _unsched_mbox(&event_user_timeout);
     mutex_unlock(&(tcb->function_lock));
     TCP_DEBUG_LEAVE;
-    return ret;
+    return (ret < 0) ? ret : (ssize_t) sent;
 }
 
-ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
     assert(tcb != NULL);
     assert(data != NULL);
 
+    ssize_t ret = _send(tcb, data, NULL, len, timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+ssize_t gnrc_tcp_send_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                          const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(pkt != NULL);
+
+    ssize_t ret = _send(tcb, NULL, &pkt, gnrc_pkt_len(pkt), timeout_duration_ms);
+
+    /* Release everything that was not sent */
+    if (pkt != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+/**
+ * @brief Receives data.
+ *
+ * @param[in,out] tcb                   TCB holding the connection information.
+ * @param[in]     event                 FSM_EVENT_CALL_RECV or FSM_EVENT_CALL_RECV_BUF.
+ * @param[out]    data                  Buffer or data pointer passed to the FSM.
+ * @param[in]     max_len               Maximum number of bytes to receive.
+ * @param[in]     timeout_duration_ms   User specified timeout in milliseconds.
+ *
+ * @returns   See gnrc_tcp_recv().
+ */
+static ssize_t _recv(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *data,
+                     const size_t max_len, const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -637,7 +689,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     /* If FIN was received (CLOSE_WAIT), no further data can be received. */
     /* Copy received data into given buffer and return number of bytes. Can be zero. */
     if (tcb->state == FSM_STATE_CLOSE_WAIT) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         mutex_unlock(&(tcb->function_lock));
         TCP_DEBUG_LEAVE;
         return ret;
@@ -645,7 +697,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
     /* If this call is non-blocking (timeout_duration_ms == 0): Try to read data and return */
     if (timeout_duration_ms == 0) {
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
         if (ret == 0) {
             TCP_DEBUG_ERROR("-EAGAIN: Not data available, try later again.");
             ret = -EAGAIN;
@@ -676,7 +728,7 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
         }
 
         /* Try to read available data */
-        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, data, max_len);
+        ret = _gnrc_tcp_fsm(tcb, event, NULL, data, max_len);
 
         /* If FIN was received (CLOSE_WAIT), no further data can be received. Leave event loop */
         if (tcb->state == FSM_STATE_CLOSE_WAIT) {
@@ -720,6 +772,53 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
     return ret;
 }
 
+ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
+                      const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    ssize_t ret = _recv(tcb, FSM_EVENT_CALL_RECV, data, max_len, timeout_duration_ms);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+ssize_t gnrc_tcp_recv_buf(gnrc_tcp_tcb_t *tcb, void **data, void **buf_ctx,
+                          const uint32_t timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(data != NULL);
+    assert(buf_ctx != NULL);
+
+    ssize_t ret = 0;
+
+    /* Drop the data handed out by the previous call */
+    if (*buf_ctx != NULL) {
+        mutex_lock(&(tcb->function_lock));
+        if (tcb->rcv_buf_raw != NULL) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV, NULL, NULL, tcb->rcv_borrowed);
+
+            /* Hand out data that wrapped around the end of the receive buffer right away */
+            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_RECV_BUF, NULL, data, 0);
+        }
+        tcb->rcv_borrowed = ret;
+        *buf_ctx = (ret > 0) ? tcb : NULL;
+        mutex_unlock(&(tcb->function_lock));
+        TCP_DEBUG_LEAVE;
+        return ret;
+    }
+
+    ret = _recv(tcb, FSM_EVENT_CALL_RECV_BUF, data, 0, timeout_duration_ms);
+    if (ret > 0) {
+        tcb->rcv_borrowed = ret;
+        *buf_ctx = tcb;
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
 void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h
+ *
+ * @}
+ */
+#include <stdint.h>
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
+#include "include/gnrc_tcp_cc.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief Calculates the minimum of two unsigned numbers.
+ *
+ * @param[in] x   First comparrison value.
+ * @param[in] y   Second comparrison value.
+ *
+ * @returns   X if x is smaller than y, if not y is returned.
+ */
+static inline uint32_t _min(const uint32_t x, const uint32_t y)
+{
+    return (x < y) ? x : y;
+}
+
+/**
+ * @brief Calculates the maximum of two unsigned numbers.
+ *
+ * @param[in] x   First comparrison value.
+ * @param[in] y   Second comparrison value.
+ *
+ * @returns   X if x is larger than y, if not y is returned.
+ */
+static inline uint32_t _max(const uint32_t x, const uint32_t y)
+{
+    return (x > y) ? x : y;
+}
+
+/**
+ * @brief Size of the largest segment the sender transmits (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   SMSS in bytes.
+ */
+static uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss > 0) ? _min(tcb->mss, CONFIG_GNRC_TCP_MSS) : CONFIG_GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Amount of data that has been sent but not yet acknowledged.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Flight size in bytes.
+ */
+static uint32_t _flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+/**
+ * @brief Sets the congestion window. Data beyond the retransmit queue can't
+ *        be in flight, so the window is limited to its capacity.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     cwnd   New congestion window.
+ */
+static void _set_cwnd(gnrc_tcp_tcb_t *tcb, const uint32_t cwnd)
+{
+    tcb->cwnd = _min(cwnd, CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE * _smss(tcb));
+}
+
+/**
+ * @brief Halves the slow start threshold after a loss, see RFC 5681 equation (4).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _reduce_ssthresh(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->ssthresh = _max(_flight_size(tcb) / 2, 2 * _smss(tcb));
+}
+
+/**
+ * @brief Retransmits the next packet that is considered lost by the SACK information.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _resend_lost(gnrc_tcp_tcb_t *tcb)
+{
+    int idx = _gnrc_tcp_pkt_get_lost(tcb);
+
+    if (idx >= 0) {
+        _gnrc_tcp_pkt_resend(tcb, idx);
+    }
+}
+
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    /* Initial window, see RFC 5681 section 3.1 */
+    if (smss > 2190) {
+        _set_cwnd(tcb, 2 * smss);
+    }
+    else if (smss > 1095) {
+        _set_cwnd(tcb, 3 * smss);
+    }
+    else {
+        _set_cwnd(tcb, 4 * smss);
+    }
+    tcb->ssthresh = UINT32_MAX;
+    tcb->dupacks = 0;
+    tcb->recover = tcb->snd_una;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_cc_get_usable_window(const gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t wnd = _min(tcb->cwnd, tcb->snd_wnd);
+    uint32_t flight = _flight_size(tcb);
+
+    if (tcb->rtx_num >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE || flight >= wnd) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    TCP_DEBUG_LEAVE;
+    return wnd - flight;
+}
+
+void _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, const uint32_t acked)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    tcb->dupacks = 0;
+
+    /* Partial acknowledgment during loss recovery: the next packet was lost as well */
+    if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+        if (tcb->rtx_num > 0 && !((tcb->rtx_sacked | tcb->rtx_resent) & 1)) {
+            _gnrc_tcp_pkt_resend(tcb, 0);
+        }
+        /* Deflate window by the amount of acknowledged data, see RFC 6582 section 3.2 */
+        if (tcb->status & STATUS_FAST_RECOVERY) {
+            uint32_t cwnd = (tcb->cwnd > acked) ? tcb->cwnd - acked : 0;
+            if (acked >= smss) {
+                cwnd += smss;
+            }
+            _set_cwnd(tcb, _max(cwnd, smss));
+            _resend_lost(tcb);
+            TCP_DEBUG_LEAVE;
+            return;
+        }
+    }
+    /* Full acknowledgment: loss recovery is over */
+    else {
+        tcb->recover = tcb->snd_una;
+        tcb->rtx_resent = 0;
+        if (tcb->status & STATUS_FAST_RECOVERY) {
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+            _set_cwnd(tcb, _min(tcb->ssthresh, _flight_size(tcb) + smss));
+            TCP_DEBUG_LEAVE;
+            return;
+        }
+    }
+
+    /* Slow start and congestion avoidance, see RFC 5681 section 3.1 */
+    if (tcb->cwnd < tcb->ssthresh) {
+        _set_cwnd(tcb, tcb->cwnd + _min(acked, smss));
+    }
+    else {
+        _set_cwnd(tcb, tcb->cwnd + _max(smss * smss / tcb->cwnd, 1));
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_cc_dupack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _smss(tcb);
+
+    /* Inflate window: the duplicate ACK signals a segment that left the network */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        _set_cwnd(tcb, tcb->cwnd + smss);
+        _resend_lost(tcb);
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    if (tcb->dupacks < GNRC_TCP_CC_DUPACK_THRESHOLD) {
+        tcb->dupacks += 1;
+    }
+
+    /* Enter fast retransmit unless the loss was already handled, see RFC 6582 section 3.2 */
+    if (tcb->dupacks < GNRC_TCP_CC_DUPACK_THRESHOLD ||
+        LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    TCP_DEBUG_INFO("Fast retransmit.");
+    _reduce_ssthresh(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_FAST_RECOVERY;
+    tcb->rtx_resent = 0;
+    _gnrc_tcp_pkt_resend(tcb, 0);
+    _set_cwnd(tcb, tcb->ssthresh + GNRC_TCP_CC_DUPACK_THRESHOLD * smss);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* Reduce ssthresh only once if the same packet times out repeatedly */
+    if (tcb->retries == 0) {
+        _reduce_ssthresh(tcb);
+    }
+    /* Restart with the loss window, see RFC 5681 section 3.1 */
+    _set_cwnd(tcb, _smss(tcb));
+    tcb->dupacks = 0;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+
+    /* The peer may discard selectively acknowledged data, see RFC 2018 section 8 */
+    tcb->rtx_sacked = 0;
+    tcb->rtx_resent = 1;
+    TCP_DEBUG_LEAVE;
+}
@@ -25,6 +25,7 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_cc.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
@@ -92,10 +93,13 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->rtx_num > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        while (tcb->rtx_num > 0) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[--tcb->rtx_num]);
+        }
+        tcb->rtx_sacked = 0;
+        tcb->rtx_resent = 0;
     }
     TCP_DEBUG_LEAVE;
     return 0;
@@ -195,8 +199,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             mutex_unlock(&list->lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            /* Connection is synchronized, the peers MSS is known */
+            _gnrc_tcp_cc_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -235,6 +244,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     }
 
     tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->status &= ~(STATUS_SACK_PERMITTED | STATUS_FAST_RECOVERY | STATUS_RTT_PENDING);
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -266,6 +276,25 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     return ret;
 }
 
+/**
+ * @brief Calculates the payload size of the next segment to send.
+ *
+ * @param[in] tcb    TCB holding the connection information.
+ * @param[in] left   Number of bytes left to send.
+ *
+ * @returns   Payload size of the next segment. Zero if nothing can be sent.
+ */
+static size_t _get_segment_size(gnrc_tcp_tcb_t *tcb, size_t left)
+{
+    /* Send segments as long as send window, congestion window and retransmit queue allow */
+    size_t payload = _gnrc_tcp_cc_get_usable_window(tcb);
+
+    payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
+    payload = (payload < tcb->mss) ? payload : tcb->mss;
+    payload = (payload < left) ? payload : left;
+    return payload;
+}
+
 /**
  * @brief FSM Handling function for sending data.
  *
@@ -278,27 +307,83 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while (sent < len) {
+        size_t payload = _get_segment_size(tcb, len - sent);
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
-        /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        if (payload == 0) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            /* Try again after the next acknowledgment released space in pktbuf */
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
+}
+
+/**
+ * @brief FSM Handling function for sending data from packet buffer snips.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in,out] pkt   Snips to send. Sent data is removed from @p pkt.
+ *
+ * @returns   Number of successfully transmitted bytes.
+ */
+static int _fsm_call_send_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **pkt)
+{
+    TCP_DEBUG_ENTER;
+    size_t sent = 0;
+
+    while (*pkt != NULL) {
+        gnrc_pktsnip_t *pay_snp = *pkt;
+        size_t payload = _get_segment_size(tcb, pay_snp->size);
+
+        if (payload == 0) {
+            break;
+        }
+
+        /* Split off the part of the snip that fits into this segment */
+        if (payload < pay_snp->size) {
+            pay_snp = gnrc_pktbuf_mark(*pkt, payload, GNRC_NETTYPE_UNDEF);
+            if (pay_snp == NULL) {
+                break;
+            }
+            (*pkt)->next = pay_snp->next;
+        }
+        else {
+            *pkt = pay_snp->next;
+        }
+        pay_snp->next = NULL;
+
+        /* Keep the payload if building the packet fails */
+        gnrc_pktbuf_hold(pay_snp, 1);
+
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        if (_gnrc_tcp_pkt_build_snip(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                     tcb->snd_nxt, tcb->rcv_nxt, pay_snp) < 0) {
+            /* Try again after the next acknowledgment released space in pktbuf */
+            pay_snp->next = *pkt;
+            *pkt = pay_snp;
+            break;
+        }
+        gnrc_pktbuf_release(pay_snp);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        sent += payload;
+    }
+    TCP_DEBUG_LEAVE;
+    return sent;
 }
 
 /**
@@ -306,6 +391,7 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer to store received data into.
+ *                      If NULL, up to @p len bytes are dropped from the receive buffer.
  * @param[in]     len   Maximum number of bytes to receive.
  *
  * @returns   Number of successfully received bytes.
@@ -320,7 +406,8 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = (buf != NULL) ? ringbuffer_get(&(tcb->rcv_buf), buf, len)
+                                : ringbuffer_remove(&(tcb->rcv_buf), len);
 
     /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: open window to available buffer size */
     if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
@@ -337,6 +424,27 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     return rcvd;
 }
 
+/**
+ * @brief FSM handling function for accessing received data without copying.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[out]    data   Pointer to the oldest received data in the receive buffer.
+ *
+ * @returns   Number of contiguous bytes at @p data.
+ */
+static int _fsm_call_recv_buf(gnrc_tcp_tcb_t *tcb, void **data)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &(tcb->rcv_buf);
+    size_t rcvd = rb->size - rb->start;
+
+    /* The data is not consumed here, the window is opened once it is dropped */
+    rcvd = (rcvd < rb->avail) ? rcvd : rb->avail;
+    *data = (rcvd > 0) ? rb->buf + rb->start : NULL;
+    TCP_DEBUG_LEAVE;
+    return rcvd;
+}
+
 /**
  * @brief FSM handling function for starting connection teardown sequence.
  *
@@ -673,8 +781,21 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_cc_ack(tcb, acked);
+
+                    /* Signal user, the windows may allow sending new data */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: a later segment arrived, an earlier one might be lost */
+                else if (seg_ack == tcb->snd_una && tcb->snd_una != tcb->snd_nxt &&
+                         pay_len == 0 && !(ctl & MSK_FIN) && seg_wnd == tcb->snd_wnd) {
+                    _gnrc_tcp_cc_dupack(tcb);
+
+                    /* Signal user, an inflated congestion window may allow sending new data */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -699,25 +820,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_num == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -774,7 +895,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_num == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -818,9 +939,10 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_num > 0) {
+        _gnrc_tcp_cc_timeout(tcb);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -907,9 +1029,15 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_CALL_SEND :
             ret = _fsm_call_send(tcb, buf, len);
             break;
+        case FSM_EVENT_CALL_SEND_PKT :
+            ret = _fsm_call_send_pkt(tcb, buf);
+            break;
         case FSM_EVENT_CALL_RECV :
             ret = _fsm_call_recv(tcb, buf, len);
             break;
+        case FSM_EVENT_CALL_RECV_BUF :
+            ret = _fsm_call_recv_buf(tcb, buf);
+            break;
         case FSM_EVENT_CALL_CLOSE :
             ret = _fsm_call_close(tcb);
             break;
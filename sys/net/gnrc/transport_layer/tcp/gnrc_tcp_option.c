@@ -16,8 +16,10 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include "kernel_defines.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -25,8 +27,15 @@
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    /* SACK is permitted if the peer sends the SACK permitted option along with its SYN */
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~STATUS_SACK_PERMITTED;
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +73,38 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (!IS_ACTIVE(CONFIG_GNRC_TCP_DISABLE_SACK) && (ctl & MSK_SYN)) {
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                if (tcb->status & STATUS_SACK_PERMITTED) {
+                    /* Each block consists of the left and the right edge */
+                    for (uint8_t i = 0; i < option->length - TCP_OPTION_LENGTH_MIN;
+                         i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        _gnrc_tcp_pkt_sack(tcb, byteorder_bebuftohl(&option->value[i]),
+                                           byteorder_bebuftohl(&option->value[i + 4]));
+                    }
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
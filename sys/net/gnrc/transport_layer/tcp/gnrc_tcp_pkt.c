@@ -20,6 +20,7 @@
 #include <utlist.h>
 #include <errno.h>
 #include "byteorder.h"
+#include "kernel_defines.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "net/inet_csum.h"
@@ -36,6 +37,10 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE > 16
+#error "CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE must not exceed 16"
+#endif
+
 /**
  * @brief Calculates the maximum of two unsigned numbers.
  *
@@ -152,9 +157,6 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 {
     TCP_DEBUG_ENTER;
     gnrc_pktsnip_t *pay_snp = NULL;
-    gnrc_pktsnip_t *tcp_snp = NULL;
-    tcp_hdr_t tcp_hdr;
-    uint8_t offset = TCP_HDR_OFFSET_MIN;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -166,6 +168,21 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             return -ENOMEM;
         }
     }
+    int ret = _gnrc_tcp_pkt_build_snip(tcb, out_pkt, seq_con, ctl, seq_num, ack_num, pay_snp);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+int _gnrc_tcp_pkt_build_snip(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const uint16_t ctl,
+                             const uint32_t seq_num, const uint32_t ack_num,
+                             gnrc_pktsnip_t *pay_snp)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *tcp_snp = NULL;
+    tcp_hdr_t tcp_hdr;
+    uint8_t offset = TCP_HDR_OFFSET_MIN;
+    size_t payload_len = gnrc_pkt_len(pay_snp);
 
     /* Fill TCP header */
     tcp_hdr.src_port = byteorder_htons(tcb->local_port);
@@ -181,6 +198,12 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (ctl & MSK_SYN) {
         offset += 1;
     }
+    /* Add SACK permitted option if SYN is sent and SACK was not refused by the peer */
+    bool sack_perm = !IS_ACTIVE(CONFIG_GNRC_TCP_DISABLE_SACK) && (ctl & MSK_SYN) &&
+                     (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED));
+    if (sack_perm) {
+        offset += 1;
+    }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
         _gnrc_tcp_option_build_offset_control(offset, ctl));
@@ -217,8 +240,16 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* If SACK is permitted: Add SACK permitted option */
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
+
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -287,12 +318,17 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
+        /* Time a single segment at once, the measurement ends with its acknowledgment */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt + seq_con;
+        }
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
     else {
-        tcb->retries += 1;
+        /* Drop running measurement: an acknowledgment would be ambiguous (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -375,6 +411,57 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Extracts the sequence number of a packet.
+ *
+ * @param[in] pkt   Packet to extract the sequence number from.
+ *
+ * @returns   Sequence number of @p pkt.
+ */
+static uint32_t _get_seq_num(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    return byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+}
+
+/**
+ * @brief Calculates the RTO from the current round trip time estimates.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there was no measurement yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief (Re-)starts the retransmission timer for the oldest unacknowledged packet.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -390,8 +477,34 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* A retransmission is always the oldest packet in the retransmit queue */
+    if (retransmit) {
+        if (tcb->rtx_num == 0 || tcb->pkt_retransmit[0] != pkt) {
+            TCP_DEBUG_ERROR("-EINVAL: pkt is not in retransmit queue.");
+            TCP_DEBUG_LEAVE;
+            return -EINVAL;
+        }
+
+        /* Increase users: every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+        tcb->retries += 1;
+
+        /* Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+        _sched_retransmit(tcb);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Check if retransmit queue is full */
+    if (tcb->rtx_num >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -408,44 +521,33 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Append pkt and increase users: every send attempt consumes a user */
+    tcb->pkt_retransmit[tcb->rtx_num++] = pkt;
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
-    }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
+    /* The timer runs for the oldest packet only */
+    if (tcb->rtx_num == 1) {
+        tcb->retries = 0;
+        _calc_rto(tcb);
+        _sched_retransmit(tcb);
     }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+int _gnrc_tcp_pkt_resend(gnrc_tcp_tcb_t *tcb, const uint8_t idx)
+{
+    TCP_DEBUG_ENTER;
+    if (idx >= tcb->rtx_num) {
+        TCP_DEBUG_ERROR("-EINVAL: No such packet in retransmit queue.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
     }
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    /* Increase users: every send attempt consumes a user */
+    gnrc_pktbuf_hold(tcb->pkt_retransmit[idx], 1);
+    tcb->rtx_resent |= (1U << idx);
+    _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[idx], 0, true);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -453,35 +555,47 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    uint8_t acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_num == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release every packet that is acknowledged as a whole from pktbuf */
+    while (acked < tcb->rtx_num) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[acked];
+        uint32_t seg = _get_seq_num(pkt) + _gnrc_tcp_pkt_get_seg_len(pkt) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
-        /* Measure round trip time */
+    /* Remove acknowledged packets from the queue */
+    tcb->rtx_num -= acked;
+    memmove(tcb->pkt_retransmit, tcb->pkt_retransmit + acked,
+            tcb->rtx_num * sizeof(tcb->pkt_retransmit[0]));
+    tcb->rtx_sacked >>= acked;
+    tcb->rtx_resent >>= acked;
+    tcb->retries = 0;
+
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
+        tcb->status &= ~STATUS_RTT_PENDING;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -496,10 +610,49 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Stop timer if everything was acknowledged, restart it for the next packet if not */
+    if (tcb->rtx_num == 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
+    else {
+        _calc_rto(tcb);
+        _sched_retransmit(tcb);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    /* Mark each packet that lies completely inside of the block */
+    for (uint8_t i = 0; i < tcb->rtx_num; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t seq = _get_seq_num(pkt);
+
+        if (LEQ_32_BIT(left, seq) &&
+            LEQ_32_BIT(seq + _gnrc_tcp_pkt_get_seg_len(pkt), right)) {
+            tcb->rtx_sacked |= (1U << i);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+int _gnrc_tcp_pkt_get_lost(const gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    /* A packet is lost if a later packet was selectively acknowledged */
+    for (uint8_t i = 0; (tcb->rtx_sacked >> i) > 1; i++) {
+        if (!((tcb->rtx_sacked | tcb->rtx_resent) & (1U << i))) {
+            TCP_DEBUG_LEAVE;
+            return i;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return -1;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
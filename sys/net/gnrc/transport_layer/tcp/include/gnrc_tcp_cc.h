@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP congestion control declarations (NewReno, RFC 5681 and RFC 6582).
+ */
+
+#ifndef GNRC_TCP_CC_H
+#define GNRC_TCP_CC_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit.
+ */
+#define GNRC_TCP_CC_DUPACK_THRESHOLD (3U)
+
+/**
+ * @brief Initializes congestion control after the connection was synchronized.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Returns the amount of data that can currently be sent.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that can be sent beyond snd_nxt.
+ */
+uint32_t _gnrc_tcp_cc_get_usable_window(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates congestion control on an ACK of new data.
+ *
+ * @pre snd_una and the retransmit queue are already updated.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+void _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, const uint32_t acked);
+
+/**
+ * @brief Updates congestion control on a duplicate ACK.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_dupack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates congestion control on a retransmission timeout.
+ *
+ * @pre Called before the oldest packet is retransmitted.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CC_H */
+/** @} */
@@ -46,6 +46,9 @@ extern "C" {
 #define STATUS_PASSIVE        (1 << 0)
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
+#define STATUS_SACK_PERMITTED (1 << 3)
+#define STATUS_FAST_RECOVERY  (1 << 4)
+#define STATUS_RTT_PENDING    (1 << 5)
 /** @} */
 
 /**
@@ -100,7 +103,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0)
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0)
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y))
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y))
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y))
 /** @} */
 
 /**
@@ -52,7 +52,9 @@ typedef enum {
 typedef enum {
     FSM_EVENT_CALL_OPEN,          /* User function call: open */
     FSM_EVENT_CALL_SEND,          /* User function call: send */
+    FSM_EVENT_CALL_SEND_PKT,      /* User function call: send_pkt */
     FSM_EVENT_CALL_RECV,          /* User function call: recv */
+    FSM_EVENT_CALL_RECV_BUF,      /* User function call: recv_buf */
     FSM_EVENT_CALL_CLOSE,         /* User function call: close */
     FSM_EVENT_CALL_ABORT,         /* User function call: abort */
     FSM_EVENT_RCVD_PKT,           /* Packet received from peer */
@@ -69,7 +71,9 @@ typedef enum {
  * @param[in,out] tcb     TCB holding the connection information.
  * @param[in]     event   Current event that triggers FSM transition.
  * @param[in]     in_pkt  Incoming packet. Only not NULL in case of event RCVD_PKT.
- * @param[in,out] buf     Buffer for send and receive functions.
+ * @param[in,out] buf     Buffer for send and receive functions. Pointer to the
+ *                        snips to send in case of event CALL_SEND_PKT and
+ *                        pointer to the data pointer in case of event CALL_RECV_BUF.
  * @param[in]     len     Number of bytes to send or receive.
  *
  * @returns   Zero on success
@@ -63,6 +63,25 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         const uint32_t seq_num, const uint32_t ack_num,
                         void *payload, const size_t payload_len);
 
+/**
+ * @brief Build and allocate a TCB packet around an already allocated payload.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[out]    out_pkt   Pointer to packet to build.
+ * @param[out]    seq_con   Sequence number consumption of built packet.
+ * @param[in]     ctl       Control bits to set in @p out_pkt.
+ * @param[in]     seq_num   Sequence number of the new packet.
+ * @param[in]     ack_num   Acknowledgment number of the new packet.
+ * @param[in]     pay_snp   Payload snips, may be NULL. Released on error.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+int _gnrc_tcp_pkt_build_snip(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const uint16_t ctl,
+                             const uint32_t seq_num, const uint32_t ack_num,
+                             gnrc_pktsnip_t *pay_snp);
+
 /**
  * @brief Sends packet to peer.
  *
@@ -123,7 +142,18 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Retransmits a packet from the retransmission mechanism without timer backoff.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     idx   Index of the packet in the retransmit queue.
+ *
+ * @returns   Zero on success.
+ *            -EINVAL if there is no packet at @p idx.
+ */
+int _gnrc_tcp_pkt_resend(gnrc_tcp_tcb_t *tcb, const uint8_t idx);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -133,6 +163,29 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission mechanism as selectively acknowledged.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    Left edge of the SACK block.
+ * @param[in]     right   Right edge of the SACK block.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right);
+
+/**
+ * @brief Searches the retransmission mechanism for a lost packet.
+ *
+ * A packet is considered lost if it was neither selectively acknowledged nor
+ * retransmitted during the current loss recovery, but a later packet was
+ * selectively acknowledged.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Index of the first lost packet in the retransmit queue.
+ *            -1 if no packet is considered lost.
+ */
+int _gnrc_tcp_pkt_get_lost(const gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
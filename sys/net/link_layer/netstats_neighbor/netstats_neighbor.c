@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+static unsigned _find(const netstats_nb_table_t *table,
+                      const uint8_t *l2_addr, uint8_t len)
+{
+    for (unsigned i = 0; i < CONFIG_NETSTATS_NB_SIZE; i++) {
+        const netstats_nb_t *nb = &table->nbs[i];
+
+        if ((nb->l2_addr_len == len) &&
+            (memcmp(nb->l2_addr, l2_addr, len) == 0)) {
+            return i;
+        }
+    }
+    return NETSTATS_NB_NONE;
+}
+
+/* returns a free entry or the one not sent to for the longest time */
+static unsigned _find_free(netstats_nb_table_t *table)
+{
+    unsigned res = 0;
+    uint16_t oldest = 0;
+
+    for (unsigned i = 0; i < CONFIG_NETSTATS_NB_SIZE; i++) {
+        const netstats_nb_t *nb = &table->nbs[i];
+        uint16_t age = table->clock - nb->last_used;
+
+        if (nb->l2_addr_len == 0) {
+            return i;
+        }
+        if (age > oldest) {
+            oldest = age;
+            res = i;
+        }
+    }
+    return res;
+}
+
+void netstats_nb_init(netstats_nb_table_t *table)
+{
+    memset(table, 0, sizeof(*table));
+}
+
+const netstats_nb_t *netstats_nb_get(const netstats_nb_table_t *table,
+                                     const uint8_t *l2_addr, uint8_t len)
+{
+    unsigned idx;
+
+    if ((len == 0) || (len > CONFIG_NETSTATS_NB_L2ADDR_MAXLEN)) {
+        return NULL;
+    }
+    idx = _find(table, l2_addr, len);
+    return (idx == NETSTATS_NB_NONE) ? NULL : &table->nbs[idx];
+}
+
+void netstats_nb_record(netstats_nb_table_t *table, const uint8_t *l2_addr,
+                        uint8_t len)
+{
+    unsigned idx = NETSTATS_NB_NONE;
+
+    if ((len > 0) && (len <= CONFIG_NETSTATS_NB_L2ADDR_MAXLEN)) {
+        idx = _find(table, l2_addr, len);
+        if (idx == NETSTATS_NB_NONE) {
+            netstats_nb_t *nb;
+
+            idx = _find_free(table);
+            nb = &table->nbs[idx];
+            DEBUG("netstats_nb: new neighbor at %u\n", idx);
+            /* status of frames still in flight to a replaced neighbor must not
+             * be attributed to the new one */
+            for (unsigned i = 0; i < table->queue_len; i++) {
+                unsigned q = (table->queue_first + i) %
+                             CONFIG_NETSTATS_NB_QUEUE_SIZE;
+
+                if (table->queue[q] == idx) {
+                    table->queue[q] = NETSTATS_NB_NONE;
+                }
+            }
+            memset(nb, 0, sizeof(*nb));
+            memcpy(nb->l2_addr, l2_addr, len);
+            nb->l2_addr_len = len;
+            nb->etx = CONFIG_NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+        }
+        table->nbs[idx].last_used = table->clock;
+    }
+    table->clock++;
+    if (table->queue_len == CONFIG_NETSTATS_NB_QUEUE_SIZE) {
+        /* device did not report the status of the oldest frame, drop it */
+        DEBUG("netstats_nb: queue full, dropping oldest frame\n");
+        table->queue_first = (table->queue_first + 1) %
+                             CONFIG_NETSTATS_NB_QUEUE_SIZE;
+        table->queue_len--;
+    }
+    table->queue[(table->queue_first + table->queue_len) %
+                 CONFIG_NETSTATS_NB_QUEUE_SIZE] = idx;
+    table->queue_len++;
+}
+
+void netstats_nb_update_tx(netstats_nb_table_t *table,
+                           netstats_nb_result_t result, uint8_t retries)
+{
+    netstats_nb_t *nb;
+    unsigned idx;
+    uint32_t sample;
+
+    if (table->queue_len == 0) {
+        DEBUG("netstats_nb: no frame awaiting status\n");
+        return;
+    }
+    idx = table->queue[table->queue_first];
+    table->queue_first = (table->queue_first + 1) %
+                         CONFIG_NETSTATS_NB_QUEUE_SIZE;
+    table->queue_len--;
+    if ((idx == NETSTATS_NB_NONE) || (result == NETSTATS_NB_BUSY)) {
+        /* a frame that never made it onto the medium tells nothing about the
+         * link */
+        return;
+    }
+    assert(idx < CONFIG_NETSTATS_NB_SIZE);
+    nb = &table->nbs[idx];
+    sample = retries + 1U;
+    if (result == NETSTATS_NB_NOACK) {
+        sample += CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY;
+        nb->tx_failed++;
+    }
+    sample *= NETSTATS_NB_ETX_DIVISOR;
+    if (nb->tx_count == 0) {
+        /* first sample replaces the initial guess */
+        nb->etx = (sample > UINT16_MAX) ? UINT16_MAX : sample;
+    }
+    else {
+        sample = ((uint32_t)nb->etx * (100U - CONFIG_NETSTATS_NB_EWMA_ALPHA) +
+                  sample * CONFIG_NETSTATS_NB_EWMA_ALPHA) / 100U;
+        nb->etx = (sample > UINT16_MAX) ? UINT16_MAX : sample;
+    }
+    if (nb->tx_count < UINT16_MAX) {
+        nb->tx_count++;
+    }
+    DEBUG("netstats_nb: ETX of neighbor %u now %u/%u\n", idx,
+          (unsigned)nb->etx, NETSTATS_NB_ETX_DIVISOR);
+}
+
+void netstats_nb_drop_last(netstats_nb_table_t *table)
+{
+    if (table->queue_len == 0) {
+        DEBUG("netstats_nb: no frame to drop\n");
+        return;
+    }
+    table->queue_len--;
+}
+
+/** @} */
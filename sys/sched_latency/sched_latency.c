@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_latency
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency statistics implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "periph/timer.h"
+#include "sched_latency.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define _TIMER_MASK ((uint32_t)((1ULL << CONFIG_SCHED_LATENCY_TIMER_WIDTH) - 1))
+
+typedef struct {
+    uint32_t woken;         /**< counter value at the last wakeup */
+    uint32_t started;       /**< counter value at the last switch in */
+    bool pending;           /**< thread was woken up but did not run yet */
+    bool running;           /**< started is valid */
+} _stamps_t;
+
+static sched_latency_t _stats[KERNEL_PID_LAST + 1];
+static _stamps_t _stamps[KERNEL_PID_LAST + 1];
+static sched_latency_hist_t _lateness;
+static bool _active;
+
+#if CONFIG_SCHED_LATENCY_PROBE_US
+static ztimer_t _probe;
+static uint32_t _probe_target;
+#endif
+
+static inline uint32_t _stamp(void)
+{
+    return timer_read(CONFIG_SCHED_LATENCY_TIMER_DEV);
+}
+
+static uint32_t _elapsed_us(uint32_t since, uint32_t now)
+{
+    uint32_t ticks = (now - since) & _TIMER_MASK;
+
+    if (CONFIG_SCHED_LATENCY_TIMER_FREQ == US_PER_SEC) {
+        return ticks;
+    }
+    return ((uint64_t)ticks * US_PER_SEC) / CONFIG_SCHED_LATENCY_TIMER_FREQ;
+}
+
+static void _record(sched_latency_hist_t *hist, uint32_t value)
+{
+    unsigned bucket = (value == 0) ? 0 : bitarithm_msb(value) + 1;
+
+    if (bucket >= CONFIG_SCHED_LATENCY_BUCKETS) {
+        bucket = CONFIG_SCHED_LATENCY_BUCKETS - 1;
+    }
+    hist->buckets[bucket]++;
+    if (value > hist->max) {
+        hist->max = value;
+    }
+}
+
+#if CONFIG_SCHED_LATENCY_PROBE_US
+static void _probe_cb(void *arg)
+{
+    (void)arg;
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    /* the timer is never early, a negative difference can only be caused by
+     * the timer being late by more than the whole range */
+    _record(&_lateness, now - _probe_target);
+    _probe_target = now + CONFIG_SCHED_LATENCY_PROBE_US;
+    ztimer_set(ZTIMER_USEC, &_probe, CONFIG_SCHED_LATENCY_PROBE_US);
+}
+#endif
+
+void sched_latency_init(void)
+{
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+
+    /* the current thread was switched in before recording started */
+    if (me != NULL) {
+        _stamps[me->pid].started = _stamp();
+        _stamps[me->pid].running = true;
+    }
+    _active = true;
+    irq_restore(state);
+
+#if CONFIG_SCHED_LATENCY_PROBE_US
+    _probe.callback = _probe_cb;
+    _probe_target = ztimer_now(ZTIMER_USEC) + CONFIG_SCHED_LATENCY_PROBE_US;
+    ztimer_set(ZTIMER_USEC, &_probe, CONFIG_SCHED_LATENCY_PROBE_US);
+#endif
+}
+
+void sched_latency_reset(void)
+{
+    unsigned state = irq_disable();
+
+    memset(_stats, 0, sizeof(_stats));
+    memset(&_lateness, 0, sizeof(_lateness));
+    irq_restore(state);
+}
+
+int sched_latency_get(kernel_pid_t pid, sched_latency_t *stats)
+{
+    if (!pid_is_valid(pid)) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+
+    *stats = _stats[pid];
+    irq_restore(state);
+    return 0;
+}
+
+void sched_latency_get_timer_lateness(sched_latency_hist_t *hist)
+{
+    unsigned state = irq_disable();
+
+    *hist = _lateness;
+    irq_restore(state);
+}
+
+uint32_t sched_latency_hist_count(const sched_latency_hist_t *hist)
+{
+    uint32_t count = 0;
+
+    for (unsigned i = 0; i < CONFIG_SCHED_LATENCY_BUCKETS; i++) {
+        count += hist->buckets[i];
+    }
+    return count;
+}
+
+uint32_t sched_latency_hist_percentile(const sched_latency_hist_t *hist,
+                                       unsigned percent)
+{
+    uint32_t count = sched_latency_hist_count(hist);
+    /* number of values at or below the percentile, rounded up */
+    uint32_t rank = ((uint64_t)count * percent + 99) / 100;
+    uint32_t seen = 0;
+
+    if (count == 0) {
+        return 0;
+    }
+    for (unsigned i = 0; i < CONFIG_SCHED_LATENCY_BUCKETS - 1; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            uint32_t upper = (1UL << i) - 1;
+
+            return (upper < hist->max) ? upper : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+void sched_latency_wakeup(const thread_t *thread)
+{
+    if (!_active) {
+        return;
+    }
+    _stamps[thread->pid].woken = _stamp();
+    _stamps[thread->pid].pending = true;
+}
+
+void sched_latency_run(const thread_t *prev, const thread_t *next)
+{
+    if (!_active) {
+        return;
+    }
+
+    uint32_t now = _stamp();
+
+    if ((next != NULL) && _stamps[next->pid].pending) {
+        _record(&_stats[next->pid].wakeup,
+                _elapsed_us(_stamps[next->pid].woken, now));
+        _stamps[next->pid].pending = false;
+    }
+    if (prev == next) {
+        return;
+    }
+    if ((prev != NULL) && _stamps[prev->pid].running) {
+        _record(&_stats[prev->pid].slice,
+                _elapsed_us(_stamps[prev->pid].started, now));
+        _stamps[prev->pid].running = false;
+    }
+    if (next != NULL) {
+        _stamps[next->pid].started = now;
+        _stamps[next->pid].running = true;
+    }
+}
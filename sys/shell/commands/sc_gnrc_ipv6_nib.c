@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <kernel_defines.h>
 
@@ -73,6 +74,9 @@ static void _usage_nib_neigh(char **argv)
     printf("       %s %s add <iface> <ipv6 addr> [<l2 addr>]\n", argv[0], argv[1]);
     printf("       %s %s del <iface> <ipv6 addr>\n", argv[0], argv[1]);
     printf("       %s %s show [iface]\n", argv[0], argv[1]);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    printf("       %s %s stats\n", argv[0], argv[1]);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 }
 
 static void _usage_nib_prefix(char **argv)
@@ -119,6 +123,25 @@ static int _nib_neigh(int argc, char **argv)
     else if ((argc > 2) && (strcmp(argv[2], "help") == 0)) {
         _usage_nib_neigh(argv);
     }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    else if ((argc > 2) && (strcmp(argv[2], "stats") == 0)) {
+        gnrc_ipv6_nib_nc_hash_stats_t stats;
+        uint32_t lookups;
+
+        gnrc_ipv6_nib_nc_get_hash_stats(&stats);
+        lookups = stats.hits + stats.misses;
+        printf("hash table: %u of %u slots used\n", stats.used,
+               2 * CONFIG_GNRC_IPV6_NIB_NUMOF);
+        printf("lookups: %" PRIu32 " (hits: %" PRIu32 ", misses: %" PRIu32
+               ")\n", lookups, stats.hits, stats.misses);
+        printf("probes: %" PRIu32 " (avg: %" PRIu32 ".%02" PRIu32
+               ", max: %u)\n", stats.probes,
+               lookups ? stats.probes / lookups : 0,
+               lookups ? (uint32_t)(((uint64_t)(stats.probes % lookups) * 100) /
+                                    lookups) : 0,
+               stats.max_probes);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     else if ((argc > 4) && (strcmp(argv[2], "add") == 0)) {
         ipv6_addr_t ipv6_addr;
         uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
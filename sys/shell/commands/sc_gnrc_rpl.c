@@ -25,6 +25,9 @@
 #include "utlist.h"
 #include "trickle.h"
 #include "xtimer.h"
+#ifdef MODULE_GNRC_RPL_MRHOF
+#include "net/gnrc/rpl/mrhof.h"
+#endif
 #ifdef MODULE_GNRC_RPL_P2P
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
@@ -230,6 +233,10 @@ int _stats(void)
     printf("DAO-ACK   #bytes: %10" PRIu32 " / %-10" PRIu32 "  %10" PRIu32 " / %-10" PRIu32 "\n",
            gnrc_rpl_netstats.dao_ack_rx_ucast_bytes, gnrc_rpl_netstats.dao_ack_tx_ucast_bytes,
            gnrc_rpl_netstats.dao_ack_rx_mcast_bytes, gnrc_rpl_netstats.dao_ack_tx_mcast_bytes);
+    printf("DAO     #targets: %10" PRIu32 " (TX)\n", gnrc_rpl_netstats.dao_tx_target_count);
+    printf("DAO   #coalesced: %10" PRIu32 "\n", gnrc_rpl_netstats.dao_coalesced_count);
+    printf("DAO-ACK #batched: %10" PRIu32 "\n", gnrc_rpl_netstats.dao_ack_batched_count);
+    printf("FT   #aggregated: %10" PRIu32 "\n", gnrc_rpl_netstats.route_aggregated_count);
     return 0;
 }
 #endif
@@ -316,6 +323,16 @@ int _gnrc_rpl_dodag_show(void)
 
         gnrc_rpl_parent_t *parent = NULL;
         LL_FOREACH(gnrc_rpl_instances[i].dodag.parents, parent) {
+#ifdef MODULE_GNRC_RPL_MRHOF
+            if (gnrc_rpl_instances[i].of->ocp == GNRC_RPL_MRHOF_OCP) {
+                /* link metric and path cost in units of 1/128 ETX */
+                printf("\t\tparent [addr: %s | rank: %d | link: %u | cost: %u]\n",
+                       ipv6_addr_to_str(addr_str, &parent->addr, sizeof(addr_str)),
+                       parent->rank, gnrc_rpl_mrhof_link_metric(parent),
+                       gnrc_rpl_mrhof_path_cost(parent));
+                continue;
+            }
+#endif
             printf("\t\tparent [addr: %s | rank: %d]\n",
                     ipv6_addr_to_str(addr_str, &parent->addr, sizeof(addr_str)),
                     parent->rank);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command printing the scheduler latency statistics
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "sched_latency.h"
+#include "thread.h"
+
+static void _print_hist(const sched_latency_hist_t *hist)
+{
+    printf(" | %8" PRIu32 " %6" PRIu32 " %6" PRIu32 " %6" PRIu32,
+           sched_latency_hist_count(hist),
+           sched_latency_hist_percentile(hist, 50),
+           sched_latency_hist_percentile(hist, 99),
+           hist->max);
+}
+
+static void _print_usage(const char *cmd)
+{
+    printf("usage: %s [reset]\n", cmd);
+}
+
+int _sched_latency_handler(int argc, char **argv)
+{
+    sched_latency_hist_t lateness;
+
+    if (argc > 1) {
+        if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+            sched_latency_reset();
+            return 0;
+        }
+        _print_usage(argv[0]);
+        return 1;
+    }
+
+    printf("\tpid | %-20s | %-36s | %-36s\n", "name",
+           "wakeup latency [us]", "slice [us]");
+    printf("\t    | %-20s | %8s %6s %6s %6s | %8s %6s %6s %6s\n", "",
+           "count", "p50", "p99", "max", "count", "p50", "p99", "max");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        sched_latency_t stats;
+        const char *name = thread_getname(i);
+
+        if ((thread_get(i) == NULL) || (sched_latency_get(i, &stats) < 0)) {
+            continue;
+        }
+        printf("\t%3" PRIkernel_pid " | %-20s", i, (name) ? name : "-");
+        _print_hist(&stats.wakeup);
+        _print_hist(&stats.slice);
+        puts("");
+    }
+    sched_latency_get_timer_lateness(&lateness);
+    /* the timer lateness is shown in the wakeup latency columns */
+    printf("\t  - | %-20s", "timer lateness");
+    _print_hist(&lateness);
+    puts("");
+    return 0;
+}
@@ -49,12 +49,17 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    (void)clock;
+    return (t->base.pprev != NULL);
+#else
     if (!clock->list.next) {
         return 0;
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
+#endif
 }
 
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
@@ -93,7 +98,11 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    if (IS_USED(MODULE_ZTIMER_WHEEL)) {
+        /* the timer might have become the next event of the wheel */
+        _ztimer_update(clock);
+    }
+    else if (clock->list.next == &timer->base) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -106,8 +115,35 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     irq_restore(state);
 }
 
+#if MODULE_ZTIMER_WHEEL && MODULE_PM_LAYERED
+static unsigned _wheel_is_empty(const ztimer_clock_t *clock)
+{
+    if (clock->list.next) {
+        return 0;
+    }
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (clock->wheel_map[level]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
+#if MODULE_ZTIMER_WHEEL
+#ifdef MODULE_PM_LAYERED
+    if (_wheel_is_empty(clock) &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->required_pm_mode);
+    }
+#endif
+    /* the wheel stores the absolute target, ztimer_update_head_offset() made
+     * sure the wheel time (list.offset) is now */
+    entry->offset += clock->list.offset;
+    ztimer_wheel_add(clock, entry);
+#else
     uint32_t delta_sum = 0;
 
     ztimer_base_t *list = &clock->list;
@@ -142,7 +178,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     list->next = entry;
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
-
+#endif
 }
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
@@ -175,6 +211,10 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 
 void ztimer_update_head_offset(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    /* moves all timers that are due to the list of expired timers */
+    ztimer_wheel_advance(clock, ztimer_now(clock));
+#else
     uint32_t old_base = clock->list.offset;
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
@@ -213,15 +253,26 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
     }
 
     clock->list.offset = now;
+#endif
 }
 
 static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     DEBUG("_del_entry_from_list()\n");
-    ztimer_base_t *list = &clock->list;
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_del(clock, entry);
+#ifdef MODULE_PM_LAYERED
+    if (_wheel_is_empty(clock) &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->required_pm_mode);
+    }
+#endif
+#else
+    ztimer_base_t *list = &clock->list;
+
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -251,12 +302,20 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         pm_unblock(clock->required_pm_mode);
     }
 #endif
+#endif
 }
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
     ztimer_base_t *entry = clock->list.next;
 
+#if MODULE_ZTIMER_WHEEL
+    /* all timers on the list of expired timers are due */
+    if (entry) {
+        _del_entry_from_list(clock, entry);
+    }
+    return (ztimer_t *)entry;
+#else
     if (entry && (entry->offset == 0)) {
         clock->list.next = entry->next;
         if (!entry->next) {
@@ -273,8 +332,81 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     else {
         return NULL;
     }
+#endif
+}
+
+#if MODULE_ZTIMER_WHEEL
+static void _ztimer_update(ztimer_clock_t *clock)
+{
+    uint32_t target;
+
+    if (clock->list.next) {
+        /* expired timers are waiting for the handler */
+        clock->ops->set(clock, 0);
+    }
+    else if (ztimer_wheel_next(clock, &target)) {
+        uint32_t now = ztimer_now(clock);
+        uint32_t val = 0;
+
+        /* target might already have passed if the wheel was not advanced */
+        if ((target - clock->list.offset) > (now - clock->list.offset)) {
+            val = target - now;
+        }
+#ifdef MODULE_ZTIMER_EXTEND
+        if (clock->max_value < UINT32_MAX) {
+            val = _min_u32(val, clock->max_value >> 1);
+        }
+#endif
+        clock->ops->set(clock, val);
+    }
+    else {
+#if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
+        if (IS_USED(MODULE_ZTIMER_NOW64) || (clock->max_value < UINT32_MAX)) {
+            /* ensure there's at least one ISR per half period */
+            clock->ops->set(clock, clock->max_value >> 1);
+            return;
+        }
+#endif
+        clock->ops->cancel(clock);
+    }
 }
 
+void ztimer_handler(ztimer_clock_t *clock)
+{
+    DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
+              clock));
+    if (IS_ACTIVE(ENABLE_DEBUG)) {
+        _ztimer_print(clock);
+    }
+
+    /* calling now triggers checkpointing, advancing the wheel moves all
+     * timers that are due to the list of expired timers */
+    ztimer_update_head_offset(clock);
+
+    ztimer_t *entry = _now_next(clock);
+    while (entry) {
+        DEBUG("ztimer_handler(): trigger %p at %" PRIu32 "\n",
+              (void *)entry, clock->ops->now(clock));
+        entry->callback(entry->arg);
+        entry = _now_next(clock);
+        if (!entry) {
+            /* See if any more alarms expired during callback processing */
+            ztimer_update_head_offset(clock);
+            entry = _now_next(clock);
+        }
+    }
+
+    _ztimer_update(clock);
+
+    if (IS_ACTIVE(ENABLE_DEBUG)) {
+        _ztimer_print(clock);
+    }
+    DEBUG("ztimer_handler(): %p done.\n", (void *)clock);
+    if (!irq_is_in()) {
+        thread_yield_higher();
+    }
+}
+#else /* MODULE_ZTIMER_WHEEL */
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
@@ -372,6 +504,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         thread_yield_higher();
     }
 }
+#endif /* MODULE_ZTIMER_WHEEL */
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
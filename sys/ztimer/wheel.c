@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel
+ *
+ * The clock's `list.offset` holds the wheel time, i.e., the point in time up
+ * to which the wheel has been processed. A timer with target time `t` is kept
+ * at the level of the most significant digit in which `t` and the wheel time
+ * differ, in the slot given by that digit of `t`. Each slot is a doubly-linked
+ * list (via `next` and `pprev`), so timers can be added and removed in
+ * constant time.
+ *
+ * The clock's `list.next` holds the timers that are due and wait for their
+ * callback to be executed by ztimer_handler().
+ *
+ * @}
+ */
+#include <assert.h>
+#include <stdint.h>
+
+#include "bitarithm.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _BITS       CONFIG_ZTIMER_WHEEL_BITS
+#define _MASK       (ZTIMER_WHEEL_SLOTS - 1)
+
+static_assert((_BITS == 1) || (_BITS == 2) || (_BITS == 4),
+              "CONFIG_ZTIMER_WHEEL_BITS must be 1, 2 or 4");
+
+static inline unsigned _digit(uint32_t time, unsigned level)
+{
+    return (time >> (level * _BITS)) & _MASK;
+}
+
+/* mask of all bits below the digit of the given level */
+static inline uint32_t _low_mask(unsigned level)
+{
+    return (uint32_t)((1ULL << (level * _BITS)) - 1);
+}
+
+/* level at which target is stored relative to the wheel time */
+static unsigned _level(uint32_t target, uint32_t wheel_time)
+{
+    uint32_t diff = target ^ wheel_time;
+    unsigned level = ZTIMER_WHEEL_LEVELS - 1;
+
+    while ((level > 0) && !(diff >> (level * _BITS))) {
+        level--;
+    }
+    return level;
+}
+
+static inline void _link(ztimer_base_t **head, ztimer_base_t *entry)
+{
+    entry->next = *head;
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = head;
+    *head = entry;
+}
+
+static void _insert(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    unsigned level = _level(entry->offset, clock->list.offset);
+    unsigned slot = _digit(entry->offset, level);
+
+    DEBUG("ztimer_wheel: %p target %" PRIu32 " in level %u slot %u\n",
+          (void *)entry, entry->offset, level, slot);
+    _link(&clock->wheel[level][slot], entry);
+    clock->wheel_map[level] |= 1U << slot;
+}
+
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    _insert(clock, entry);
+}
+
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t **pprev = entry->pprev;
+    /* pprev might point into the list of expired timers or into another
+     * timer, so compare addresses as integers */
+    size_t idx = ((uintptr_t)pprev - (uintptr_t)&clock->wheel[0][0]) /
+                 sizeof(ztimer_base_t *);
+
+    assert(pprev != NULL);
+    *pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = pprev;
+    }
+    /* entry was the first of a wheel slot and that slot is now empty */
+    if ((idx < (ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS)) && !*pprev) {
+        clock->wheel_map[idx / ZTIMER_WHEEL_SLOTS] &= ~(1U << (idx & _MASK));
+    }
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+/* first occupied slot at or after start, counting past the end of the level
+ * (so the result is in [start, start + ZTIMER_WHEEL_SLOTS)) */
+static unsigned _next_slot(uint32_t map, unsigned start)
+{
+    unsigned shift = start & _MASK;
+    uint32_t rot = ((map >> shift) | (map << (ZTIMER_WHEEL_SLOTS - shift))) &
+                   ((1UL << ZTIMER_WHEEL_SLOTS) - 1);
+
+    return start + bitarithm_lsb((unsigned)rot);
+}
+
+int ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *target)
+{
+    uint32_t wheel_time = clock->list.offset;
+    uint32_t min_diff = UINT32_MAX;
+    int res = 0;
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        uint32_t map = clock->wheel_map[level];
+
+        if (!map) {
+            continue;
+        }
+        /* on level 0 a timer might be due right now, on higher levels the
+         * slot of the current digit is reached again only after a full
+         * rotation */
+        unsigned slot = _next_slot(map, _digit(wheel_time, level) +
+                                   ((level > 0) ? 1 : 0));
+        uint32_t event = (wheel_time & ~_low_mask(level + 1)) +
+                         ((uint32_t)slot << (level * _BITS));
+        uint32_t diff = event - wheel_time;
+
+        if (!res || (diff < min_diff)) {
+            min_diff = diff;
+            *target = event;
+            res = 1;
+        }
+    }
+    return res;
+}
+
+static void _cascade(ztimer_clock_t *clock, unsigned level, unsigned slot)
+{
+    ztimer_base_t *entry = clock->wheel[level][slot];
+
+    clock->wheel[level][slot] = NULL;
+    clock->wheel_map[level] &= ~(1U << slot);
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+
+        _insert(clock, entry);
+        entry = next;
+    }
+}
+
+static void _expire(ztimer_clock_t *clock, unsigned slot)
+{
+    ztimer_base_t *entry = clock->wheel[0][slot];
+
+    clock->wheel[0][slot] = NULL;
+    clock->wheel_map[0] &= ~(1U << slot);
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+
+        _link(&clock->list.next, entry);
+        entry = next;
+    }
+}
+
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    uint32_t event;
+
+    while (ztimer_wheel_next(clock, &event) &&
+           ((event - clock->list.offset) <= (now - clock->list.offset))) {
+        clock->list.offset = event;
+        /* cascade from the top, so timers cascaded to lower slots that start
+         * at the same time are handled in the same step */
+        for (unsigned level = ZTIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+            if (!(event & _low_mask(level))) {
+                unsigned slot = _digit(event, level);
+
+                if (clock->wheel_map[level] & (1U << slot)) {
+                    _cascade(clock, level, slot);
+                }
+            }
+        }
+        if (clock->wheel_map[0] & (1U << _digit(event, 0))) {
+            _expire(clock, _digit(event, 0));
+        }
+    }
+    clock->list.offset = now;
+}
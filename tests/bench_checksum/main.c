@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Checksum throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "checksum/crc16_ccitt.h"
+#include "checksum/crc8.h"
+#include "checksum/fletcher16.h"
+#include "checksum/fletcher32.h"
+#include "checksum/ucrc16.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE      (512U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000U)
+#endif
+
+#define CRC8_POLY           (0x31)
+
+static uint16_t _buf[BENCH_BUF_SIZE / sizeof(uint16_t)];
+static volatile uint32_t _sink;
+
+#define BENCH_CHECKSUM(name, func)                                          \
+    {                                                                       \
+        uint32_t start = ztimer_now(ZTIMER_USEC);                           \
+        for (unsigned i = 0; i < BENCH_RUNS; i++) {                         \
+            _sink = func;                                                   \
+        }                                                                   \
+        _print_result(name, ztimer_now(ZTIMER_USEC) - start);               \
+    }
+
+static void _print_result(const char *name, uint32_t time)
+{
+    /* bytes per microsecond are MB/s */
+    uint32_t rate = ((uint64_t)BENCH_BUF_SIZE * BENCH_RUNS * 1000) / time;
+
+    printf("%20s: %8" PRIu32 " us --- %4" PRIu32 ".%03" PRIu32 " MB/s\n",
+           name, time, rate / 1000, rate % 1000);
+}
+
+int main(void)
+{
+    const uint8_t *buf = (const uint8_t *)_buf;
+    uint32_t state = 0x12345678;
+
+    for (unsigned i = 0; i < BENCH_BUF_SIZE / sizeof(uint16_t); i++) {
+        state = state * 1103515245 + 12345;
+        _buf[i] = state >> 16;
+    }
+
+    puts("Checksum benchmark\n");
+    printf("Verifying crc16_ccitt_calc() against ucrc16_calc_be(): ");
+    if (crc16_ccitt_calc(buf, BENCH_BUF_SIZE) !=
+        ucrc16_calc_be(buf, BENCH_BUF_SIZE, UCRC16_CCITT_POLY_BE, 0x1d0f)) {
+        puts("FAIL");
+        return 1;
+    }
+    puts("OK\n");
+
+    BENCH_CHECKSUM("crc16_ccitt_calc", crc16_ccitt_calc(buf, BENCH_BUF_SIZE));
+    BENCH_CHECKSUM("crc8", crc8(buf, BENCH_BUF_SIZE, CRC8_POLY, 0xff));
+    BENCH_CHECKSUM("ucrc16_calc_be",
+                   ucrc16_calc_be(buf, BENCH_BUF_SIZE, UCRC16_CCITT_POLY_BE, 0));
+    BENCH_CHECKSUM("ucrc16_calc_le",
+                   ucrc16_calc_le(buf, BENCH_BUF_SIZE, UCRC16_CCITT_POLY_LE, 0));
+    BENCH_CHECKSUM("fletcher16", fletcher16(buf, BENCH_BUF_SIZE));
+    BENCH_CHECKSUM("fletcher32",
+                   fletcher32(_buf, BENCH_BUF_SIZE / sizeof(uint16_t)));
+    BENCH_CHECKSUM("inet_csum", inet_csum(0, buf, BENCH_BUF_SIZE));
+    BENCH_CHECKSUM("inet_csum unaligned",
+                   inet_csum(0, buf + 1, BENCH_BUF_SIZE - 2));
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# The default timeout is not enough for this test on some of the slower boards
+TIMEOUT = 60
+KERNELS = ("crc16_ccitt_calc", "crc8", "ucrc16_calc_be", "ucrc16_calc_le",
+           "fletcher16", "fletcher32", "inet_csum", "inet_csum unaligned")
+
+
+def testfunc(child):
+    child.expect_exact("Verifying crc16_ccitt_calc() against ucrc16_calc_be(): OK")
+    for kernel in KERNELS:
+        child.expect(r"\s+{}: \s*\d+ us --- \s*\d+\.\d{{3}} MB/s\r\n".format(kernel),
+                     timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
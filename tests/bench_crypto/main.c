@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       AES and block cipher modes of operation benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "crypto/modes/ocb.h"
+#include "kernel_defines.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE      (512U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (200U)
+#endif
+
+#define TAG_LEN             (16U)
+#define CCM_LEN_ENCODING    (2U)
+
+static const uint8_t _key[AES_KEY_SIZE] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+
+static const uint8_t _nonce[13] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+};
+
+static uint8_t _in[BENCH_BUF_SIZE];
+static uint8_t _out[BENCH_BUF_SIZE + TAG_LEN];
+static uint8_t _check[BENCH_BUF_SIZE + TAG_LEN];
+static cipher_t _cipher;
+
+#define BENCH_CIPHER(name, func)                                            \
+    {                                                                       \
+        uint32_t start = ztimer_now(ZTIMER_USEC);                           \
+        for (unsigned i = 0; i < BENCH_RUNS; i++) {                         \
+            if ((func) < 0) {                                               \
+                puts("Error in " name);                                     \
+                return -1;                                                  \
+            }                                                               \
+        }                                                                   \
+        _print_result(name, ztimer_now(ZTIMER_USEC) - start);               \
+    }
+
+static void _print_result(const char *name, uint32_t time)
+{
+    /* bytes per microsecond are MB/s */
+    uint32_t rate = ((uint64_t)BENCH_BUF_SIZE * BENCH_RUNS * 1000) / time;
+
+    printf("%20s: %8" PRIu32 " us --- %4" PRIu32 ".%03" PRIu32 " MB/s",
+           name, time, rate / 1000, rate % 1000);
+#ifdef CLOCK_CORECLOCK
+    uint32_t cycles = ((uint64_t)time * (CLOCK_CORECLOCK / KHZ(1))) /
+                      ((uint64_t)BENCH_BUF_SIZE * BENCH_RUNS * 1000 / 10);
+    printf(" --- %4" PRIu32 ".%" PRIu32 " cycles/B",
+           cycles / 10, cycles % 10);
+#endif
+    puts("");
+}
+
+static int _aes_single(uint8_t *out)
+{
+    for (unsigned i = 0; i < BENCH_BUF_SIZE; i += AES_BLOCK_SIZE) {
+        if (cipher_encrypt(&_cipher, _in + i, out + i) != 1) {
+            return -1;
+        }
+    }
+    return BENCH_BUF_SIZE;
+}
+
+static int _ctr(uint8_t *out)
+{
+    uint8_t nonce_counter[16] = { 0 };
+
+    memcpy(nonce_counter, _nonce, 8);
+    return cipher_encrypt_ctr(&_cipher, nonce_counter, 8, _in, BENCH_BUF_SIZE,
+                              out);
+}
+
+static int _cbc(uint8_t *out)
+{
+    uint8_t iv[16] = { 0 };
+
+    return cipher_encrypt_cbc(&_cipher, iv, _in, BENCH_BUF_SIZE, out);
+}
+
+static int _cbc_decrypt(uint8_t *out)
+{
+    uint8_t iv[16] = { 0 };
+
+    return cipher_decrypt_cbc(&_cipher, iv, _out, BENCH_BUF_SIZE, out);
+}
+
+static int _ccm(uint8_t *out)
+{
+    return cipher_encrypt_ccm(&_cipher, NULL, 0, TAG_LEN, CCM_LEN_ENCODING,
+                              _nonce, 15 - CCM_LEN_ENCODING,
+                              _in, BENCH_BUF_SIZE, out);
+}
+
+static int _ocb(uint8_t *out)
+{
+    return cipher_encrypt_ocb(&_cipher, NULL, 0, TAG_LEN, _nonce,
+                              sizeof(_nonce), _in, BENCH_BUF_SIZE, out);
+}
+
+static int _bench(void)
+{
+    BENCH_CIPHER("AES single block", _aes_single(_out));
+    BENCH_CIPHER("AES-ECB encrypt",
+                 cipher_encrypt_ecb(&_cipher, _in, BENCH_BUF_SIZE, _out));
+    BENCH_CIPHER("AES-ECB decrypt",
+                 cipher_decrypt_ecb(&_cipher, _out, BENCH_BUF_SIZE, _check));
+    BENCH_CIPHER("AES-CTR", _ctr(_out));
+    BENCH_CIPHER("AES-CBC encrypt", _cbc(_out));
+    BENCH_CIPHER("AES-CBC decrypt", _cbc_decrypt(_check));
+    BENCH_CIPHER("AES-CCM encrypt", _ccm(_out));
+    BENCH_CIPHER("AES-OCB encrypt", _ocb(_out));
+
+    return 0;
+}
+
+int main(void)
+{
+    uint32_t state = 0x12345678;
+
+    for (unsigned i = 0; i < BENCH_BUF_SIZE; i++) {
+        state = state * 1103515245 + 12345;
+        _in[i] = state >> 16;
+    }
+
+    cipher_init(&_cipher, CIPHER_AES_128, _key, sizeof(_key));
+
+    puts("AES benchmark\n");
+    printf("Verifying AES-ECB against single block encryption: ");
+    _aes_single(_check);
+    if ((cipher_encrypt_ecb(&_cipher, _in, BENCH_BUF_SIZE, _out) < 0) ||
+        (memcmp(_out, _check, BENCH_BUF_SIZE) != 0)) {
+        puts("FAIL");
+        return 1;
+    }
+    puts("OK\n");
+
+    if (_bench() < 0) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# The default timeout is not enough for this test on some of the slower boards
+TIMEOUT = 60
+KERNELS = ("AES single block", "AES-ECB encrypt", "AES-ECB decrypt", "AES-CTR",
+           "AES-CBC encrypt", "AES-CBC decrypt", "AES-CCM encrypt",
+           "AES-OCB encrypt")
+
+
+def testfunc(child):
+    child.expect_exact("Verifying AES-ECB against single block encryption: OK")
+    for kernel in KERNELS:
+        child.expect(r"\s+{}: \s*\d+ us --- \s*\d+\.\d{{3}} MB/s".format(kernel),
+                     timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Event queue post/consume throughput benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "event.h"
+#include "thread.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#define BURST_SIZE          (8U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _queue;
+static event_queue_t _waiter_queue = EVENT_QUEUE_INIT_DETACHED;
+static event_t _events[BURST_SIZE];
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    _handled++;
+}
+
+static void _post_get(void)
+{
+    event_post(&_queue, &_events[0]);
+
+    event_t *event = event_get(&_queue);
+
+    event->handler(event);
+}
+
+static void _post_get_burst(void)
+{
+    for (unsigned i = 0; i < BURST_SIZE; i++) {
+        event_post(&_queue, &_events[i]);
+    }
+    for (unsigned i = 0; i < BURST_SIZE; i++) {
+        event_t *event = event_get(&_queue);
+
+        event->handler(event);
+    }
+}
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_waiter_queue);
+    event_loop(&_waiter_queue);
+    return NULL;
+}
+
+int main(void)
+{
+    puts("Event queue post/consume benchmark\n");
+
+    for (unsigned i = 0; i < BURST_SIZE; i++) {
+        _events[i].handler = _handler;
+    }
+    event_queue_init(&_queue);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _waiter, NULL, "waiter");
+
+    BENCHMARK_FUNC("post/get", BENCH_RUNS, _post_get());
+    BENCHMARK_FUNC("post/get burst of 8", BENCH_RUNS / BURST_SIZE,
+                   _post_get_burst());
+    BENCHMARK_FUNC("post/wait other thread", BENCH_RUNS,
+                   event_post(&_waiter_queue, &_events[0]));
+
+    if (_handled != (BENCH_RUNS / BURST_SIZE) * BURST_SIZE + 2 * BENCH_RUNS) {
+        printf("handled %u events, expected %lu\n", _handled,
+               (BENCH_RUNS / BURST_SIZE) * BURST_SIZE + 2 * BENCH_RUNS);
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("\n[SUCCESS]");
+    return 0;
+}
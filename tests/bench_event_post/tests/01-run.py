@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# The default timeout is not enough for this test on some of the slower boards
+TIMEOUT = 30
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact('Event queue post/consume benchmark')
+    child.expect(BENCHMARK_REGEXP.format(func="post/get"), timeout=TIMEOUT)
+    child.expect(BENCHMARK_REGEXP.format(func="post/get burst of 8"), timeout=TIMEOUT)
+    child.expect(BENCHMARK_REGEXP.format(func="post/wait other thread"), timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gcoap request rate benchmark with many resources
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RESOURCES
+#define BENCH_RESOURCES     (256U)
+#endif
+
+#define BENCH_LISTENERS     (4U)
+#define BENCH_PATH_LEN      (sizeof("/res/000"))
+
+static char _paths[BENCH_RESOURCES][BENCH_PATH_LEN];
+static coap_resource_t _resources[BENCH_RESOURCES];
+static gcoap_listener_t _listeners[BENCH_LISTENERS];
+
+static mutex_t _resp_lock = MUTEX_INIT_LOCKED;
+static unsigned _resp_state;
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len, void *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)pdu;
+    (void)remote;
+    _resp_state = memo->state;
+    mutex_unlock(&_resp_lock);
+}
+
+static int _coap_bench(int argc, char **argv)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    uint32_t requests = 1000;
+    coap_pkt_t pdu;
+
+    if (argc > 1) {
+        requests = atoi(argv[1]);
+    }
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < requests; i++) {
+        /* spread the requests over all resources */
+        unsigned idx = (i * 7919) % BENCH_RESOURCES;
+
+        gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, _paths[idx]);
+        ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+        if (gcoap_req_send(buf, len, &remote, _resp_handler, NULL) == 0) {
+            puts("error: sending request failed");
+            return 1;
+        }
+        mutex_lock(&_resp_lock);
+        if (_resp_state != GCOAP_MEMO_RESP) {
+            printf("error: no response for %s\n", _paths[idx]);
+            return 1;
+        }
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%" PRIu32 " requests in %" PRIu32 " us = %" PRIu32
+           " requests/s\n", requests, diff,
+           (uint32_t)(((uint64_t)requests * US_PER_SEC) / diff));
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "coap_bench", "send <requests> GET requests to the own server",
+      _coap_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("gcoap lookup benchmark application.");
+    printf("resources: %u, index: %s\n", (unsigned)BENCH_RESOURCES,
+           IS_USED(MODULE_GCOAP_INDEX) ? "yes" : "no");
+
+    /* zero padded paths are in alphabetical order */
+    for (unsigned i = 0; i < BENCH_RESOURCES; i++) {
+        snprintf(_paths[i], BENCH_PATH_LEN, "/res/%03u", i);
+        _resources[i].path = _paths[i];
+        _resources[i].methods = COAP_GET;
+        _resources[i].handler = _handler;
+    }
+    for (unsigned i = 0; i < BENCH_LISTENERS; i++) {
+        unsigned first = (i * BENCH_RESOURCES) / BENCH_LISTENERS;
+        unsigned last = ((i + 1) * BENCH_RESOURCES) / BENCH_LISTENERS;
+
+        _listeners[i].resources = &_resources[first];
+        _listeners[i].resources_len = last - first;
+        gcoap_register_listener(&_listeners[i]);
+    }
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+
+from testrunner import run
+
+REQUESTS = 10000
+
+
+def testfunc(child):
+    child.expect_exact("gcoap lookup benchmark application.\r\n")
+    child.expect(r"resources: \d+, index: (yes|no)\r\n")
+    child.sendline("coap_bench {}".format(REQUESTS))
+    child.expect(r"{} requests in \d+ us = \d+ requests/s\r\n"
+                 .format(REQUESTS), timeout=60)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
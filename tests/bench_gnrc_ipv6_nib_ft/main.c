@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_ROUTES
+#define NUMOF_ROUTES    (512U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE           (6U)
+
+static const unsigned _numof[] = { 16, 128, 512 };
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+    } };
+
+/* spread the prefixes over the address space, so they do not just differ in
+ * the last bits */
+static void _route_dst(ipv6_addr_t *dst, unsigned n)
+{
+    uint32_t hash = n * 2654435761U;
+
+    ipv6_addr_from_str(dst, "2001:db8::1");
+    dst->u16[2] = byteorder_htons(hash >> 16);
+    dst->u16[3] = byteorder_htons(hash & 0xffff);
+}
+
+static void _print_result(const char *desc, unsigned numof, unsigned n,
+                          uint32_t total)
+{
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%s %4u", desc, numof);
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", buf, total, n, total/n);
+}
+
+int main(void)
+{
+    unsigned added = 0;
+
+    puts("NIB forwarding table benchmark application.\n");
+    printf("off-link entry trie: %s\n",
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) ? "on" : "off");
+
+    gnrc_ipv6_nib_init();
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        gnrc_ipv6_nib_ft_t fte;
+        ipv6_addr_t dst;
+        uint32_t before, diff;
+
+        if (_numof[i] > NUMOF_ROUTES) {
+            break;
+        }
+        for (; added < _numof[i]; added++) {
+            _route_dst(&dst, added);
+            expect(gnrc_ipv6_nib_ft_add(&dst, 64, &_next_hop, IFACE, 0) == 0);
+        }
+
+        /*
+         * test getting the route to a destination of each route in turn
+         *
+         */
+        before = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < REPEAT; n++) {
+            _route_dst(&dst, n % added);
+            expect(gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0);
+        }
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        expect(fte.dst_len == 64);
+        _print_result("ft_get()", added, REPEAT, diff);
+    }
+
+    puts("done.");
+
+    return 0;
+}
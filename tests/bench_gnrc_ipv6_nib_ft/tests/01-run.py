@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("NIB forwarding table benchmark application.\r\n")
+    child.expect(r"off-link entry trie: (on|off)\r\n")
+    while True:
+        idx = child.expect([r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n",
+                            "done.\r\n"])
+        if idx == 1:
+            break
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
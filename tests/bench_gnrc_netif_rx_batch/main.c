@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_netif receive throughput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "shell.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_PORT
+#define BENCH_PORT          (4242U)
+#endif
+
+#define RCV_MSG_QUEUE_SIZE  (32U)
+
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+#define RX_BATCH_SIZE       CONFIG_GNRC_NETIF_RX_BATCH_SIZE
+#else
+#define RX_BATCH_SIZE       (1U)
+#endif
+
+static char _rcv_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _rcv_msg_queue[RCV_MSG_QUEUE_SIZE];
+static volatile uint32_t _rx_count;
+
+static void *_rcv_thread(void *arg)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(BENCH_PORT,
+                                                           thread_getpid());
+
+    (void)arg;
+    msg_init_queue(_rcv_msg_queue, RCV_MSG_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            _rx_count++;
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static int _rx_bench(int argc, char **argv)
+{
+    uint32_t seconds = 1;
+
+    if (argc > 1) {
+        seconds = atoi(argv[1]);
+    }
+    _rx_count = 0;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    ztimer_sleep(ZTIMER_USEC, seconds * US_PER_SEC);
+    uint32_t count = _rx_count;
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("received %" PRIu32 " datagrams in %" PRIu32 " us = %" PRIu32
+           " datagrams/s\n", count, diff,
+           (uint32_t)(((uint64_t)count * US_PER_SEC) / diff));
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "rx_bench", "count UDP datagrams received on port 4242 for <seconds>",
+      _rx_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("gnrc_netif receive benchmark application.");
+    printf("rx batch: %u\n", (unsigned)RX_BATCH_SIZE);
+
+    thread_create(_rcv_stack, sizeof(_rcv_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _rcv_thread, NULL, "rx_bench");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
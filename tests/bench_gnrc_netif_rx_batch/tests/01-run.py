@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+from testrunner import run
+
+BENCH_PORT = 4242
+BENCH_SECONDS = 5
+PAYLOAD = bytes(64)
+
+
+def get_bridge(tap):
+    out = subprocess.check_output(["bridge", "link"]).decode()
+    for line in out.splitlines():
+        if tap in line and "master" in line:
+            return line.split("master")[1].split()[0]
+    return tap
+
+
+def flood(dst, iface, stop):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    addr = (dst, BENCH_PORT, 0, socket.if_nametoindex(iface))
+    while not stop.is_set():
+        try:
+            sock.sendto(PAYLOAD, addr)
+        except OSError:
+            # host side socket buffer is full
+            time.sleep(0)
+    sock.close()
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_netif receive benchmark application.\r\n")
+    child.expect(r"rx batch: \d+\r\n")
+    child.sendline("ifconfig")
+    child.expect(r"(?P<lladdr>fe80::[A-Fa-f:0-9]+)\s")
+    lladdr = child.match.group("lladdr").lower()
+
+    stop = threading.Event()
+    sender = threading.Thread(target=flood,
+                              args=(lladdr, get_bridge(os.environ["TAP"]),
+                                    stop))
+    sender.start()
+    try:
+        child.sendline("rx_bench {}".format(BENCH_SECONDS))
+        child.expect(r"received \d+ datagrams in \d+ us = \d+ datagrams/s\r\n",
+                     timeout=BENCH_SECONDS + 5)
+    finally:
+        stop.set()
+        sender.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN reassembly buffer benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_utils/expect.h"
+
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/sixlowpan.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_DATAGRAMS
+#define NUMOF_DATAGRAMS (4U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (100U)
+#endif
+
+#define IFACE           (6U)
+#define DATAGRAM_SIZE   (1232U)
+#define FRAG_SIZE       (96U)
+#define NUMOF_FRAGS     ((DATAGRAM_SIZE + FRAG_SIZE - 1) / FRAG_SIZE)
+
+static const uint8_t _src[] = { 0xb3, 0x47, 0x60, 0x49, 0x78, 0xfe, 0x95, 0x48 };
+static const uint8_t _dst[] = { 0xa4, 0xf2, 0xd2, 0xc9, 0x13, 0xb9, 0xbb, 0x25 };
+
+static struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint8_t dst[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+} _netif_hdr;
+
+static uint8_t _frag_buf[sizeof(sixlowpan_frag_n_t) + FRAG_SIZE];
+
+/* first every even fragment in ascending order, then every odd fragment in
+ * descending order, so that the most gaps possible are left open */
+static unsigned _frag_idx(unsigned n)
+{
+    const unsigned evens = (NUMOF_FRAGS + 1) / 2;
+
+    if (n < evens) {
+        return n * 2;
+    }
+    return ((NUMOF_FRAGS - 1 - n) * 2) + 1;
+}
+
+static gnrc_pktsnip_t *_build_frag(uint16_t tag, unsigned idx)
+{
+    sixlowpan_frag_t *hdr = (sixlowpan_frag_t *)_frag_buf;
+    unsigned offset = idx * FRAG_SIZE;
+    unsigned payload = DATAGRAM_SIZE - offset;
+    size_t hdr_len;
+
+    if (payload > FRAG_SIZE) {
+        payload = FRAG_SIZE;
+    }
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (idx == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        hdr_len = sizeof(sixlowpan_frag_t);
+        /* the first fragment carries the uncompressed dispatch in addition to
+         * the start of the datagram */
+        _frag_buf[hdr_len++] = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        ((sixlowpan_frag_n_t *)hdr)->offset = offset / 8;
+        hdr_len = sizeof(sixlowpan_frag_n_t);
+    }
+    memset(&_frag_buf[hdr_len], idx, payload);
+    return gnrc_pktbuf_add(NULL, _frag_buf, hdr_len + payload,
+                           GNRC_NETTYPE_SIXLOWPAN);
+}
+
+static void _print_result(const char *desc, unsigned n, uint32_t total)
+{
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+}
+
+int main(void)
+{
+    uint32_t before, diff;
+    uint16_t tag = 0;
+
+    puts("6LoWPAN reassembly buffer benchmark application.\n");
+    printf("concurrent datagrams: %u\n", NUMOF_DATAGRAMS);
+
+    gnrc_pktbuf_init();
+    gnrc_sixlowpan_frag_rb_reset();
+    gnrc_netif_hdr_init(&_netif_hdr.hdr, sizeof(_src), sizeof(_dst));
+    _netif_hdr.hdr.if_pid = IFACE;
+    gnrc_netif_hdr_set_src_addr(&_netif_hdr.hdr, _src, sizeof(_src));
+    gnrc_netif_hdr_set_dst_addr(&_netif_hdr.hdr, _dst, sizeof(_dst));
+
+    /*
+     * test reassembling NUMOF_DATAGRAMS datagrams at the same time with
+     * interleaved and out-of-order fragments
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < REPEAT; r++) {
+        for (unsigned n = 0; n < NUMOF_FRAGS; n++) {
+            for (unsigned d = 0; d < NUMOF_DATAGRAMS; d++) {
+                gnrc_sixlowpan_frag_rb_t *rbuf;
+                gnrc_pktsnip_t *frag = _build_frag(tag + d, _frag_idx(n));
+
+                expect(frag != NULL);
+                rbuf = gnrc_sixlowpan_frag_rb_add(&_netif_hdr.hdr, frag,
+                                                  _frag_idx(n) * FRAG_SIZE, 0);
+                expect(rbuf != NULL);
+                expect(gnrc_sixlowpan_frag_rb_dispatch_when_complete(
+                            rbuf, &_netif_hdr.hdr) == (n == (NUMOF_FRAGS - 1))
+                       );
+            }
+        }
+        tag += NUMOF_DATAGRAMS;
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    expect(gnrc_pktbuf_is_empty());
+    _print_result("frag_rb_add() per fragment",
+                  REPEAT * NUMOF_DATAGRAMS * NUMOF_FRAGS, diff);
+    _print_result("frag_rb_add() per datagram",
+                  REPEAT * NUMOF_DATAGRAMS, diff);
+
+    puts("done.");
+
+    return 0;
+}
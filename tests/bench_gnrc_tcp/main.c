@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       gnrc_tcp goodput benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8U)
+
+/* size of a single gnrc_tcp_send() call, must be a multiple of 256 to keep the
+ * pattern continuous */
+#ifndef BENCH_CHUNK_SIZE
+#define BENCH_CHUNK_SIZE    (8192U)
+#endif
+
+#ifndef BENCH_ZERO_COPY
+#define BENCH_ZERO_COPY     (0)
+#endif
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+#if !BENCH_ZERO_COPY
+static uint8_t _chunk[BENCH_CHUNK_SIZE];
+#endif
+
+static void _fill(uint8_t *buf, size_t len)
+{
+    for (unsigned i = 0; i < len; i++) {
+        buf[i] = i;
+    }
+}
+
+static int _tcp_bench(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("error: invalid endpoint");
+        return 1;
+    }
+
+    uint32_t total = strtoul(argv[2], NULL, 10);
+    uint32_t sent = 0;
+
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_open_active(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("error: open failed (%d)\n", res);
+        return 1;
+    }
+
+    uint32_t start = xtimer_now_usec() / US_PER_MS;
+    while (sent < total) {
+        size_t len = total - sent;
+
+        if (len > BENCH_CHUNK_SIZE) {
+            len = BENCH_CHUNK_SIZE;
+        }
+
+#if BENCH_ZERO_COPY
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+        if (pkt == NULL) {
+            puts("error: packet buffer full");
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        _fill(pkt->data, len);
+        ssize_t n = gnrc_tcp_send_pkt(&_tcb, pkt, 0);
+#else
+        ssize_t n = gnrc_tcp_send(&_tcb, _chunk, len, 0);
+#endif
+        if (n < 0) {
+            printf("error: send failed (%d)\n", (int)n);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += n;
+    }
+    uint32_t time = xtimer_now_usec() / US_PER_MS - start;
+
+    gnrc_tcp_close(&_tcb);
+
+    printf("sent %" PRIu32 " bytes in %" PRIu32 " ms --- %" PRIu32 " kbit/s\n",
+           sent, time, (time > 0) ? (uint32_t)(((uint64_t)sent * 8) / time) : 0);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "tcp_bench", "send <bytes> to <[addr%netif]:port>", _tcp_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+#if !BENCH_ZERO_COPY
+    _fill(_chunk, sizeof(_chunk));
+#endif
+
+    puts("gnrc_tcp goodput benchmark application.");
+    printf("segments in flight: %u, SACK: %s, zero-copy: %s\n",
+           (unsigned)CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           IS_ACTIVE(CONFIG_GNRC_TCP_DISABLE_SACK) ? "off" : "on",
+           BENCH_ZERO_COPY ? "on" : "off");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
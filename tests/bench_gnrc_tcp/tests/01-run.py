@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import subprocess
+import sys
+import threading
+
+from testrunner import run
+
+BENCH_PORT = 4242
+BENCH_BYTES = 256 * 1024
+# (delay in ms, loss in percent)
+LINKS = ((0, 0), (20, 0), (20, 1), (20, 5))
+
+
+def get_bridge(tap):
+    out = subprocess.check_output(["bridge", "link"]).decode()
+    for line in out.splitlines():
+        if tap in line and "master" in line:
+            return line.split("master")[1].split()[0]
+    return tap
+
+
+def get_host_ll_addr(iface):
+    out = subprocess.check_output(["ip", "-6", "addr", "show", "dev", iface,
+                                   "scope", "link"]).decode()
+    return re.search(r"inet6\s+([0-9a-f:]+)/\d+", out).group(1)
+
+
+def get_riot_if_id(child):
+    child.sendline("ifconfig")
+    child.expect(r"Iface\s+(\d+)\s")
+    return child.match.group(1)
+
+
+def tc(*args):
+    subprocess.check_call(["tc"] + list(args))
+
+
+def set_link(tap, delay, loss):
+    # the delay applies to the ACKs sent to RIOT
+    tc("qdisc", "add", "dev", tap, "root", "netem",
+       "delay", "{}ms".format(delay))
+    # the loss applies to the segments sent by RIOT
+    subprocess.check_call(["modprobe", "ifb"])
+    subprocess.check_call(["ip", "link", "set", "dev", "ifb0", "up"])
+    tc("qdisc", "add", "dev", tap, "ingress")
+    tc("filter", "add", "dev", tap, "parent", "ffff:", "matchall",
+       "action", "mirred", "egress", "redirect", "dev", "ifb0")
+    tc("qdisc", "add", "dev", "ifb0", "root", "netem",
+       "loss", "{}%".format(loss))
+
+
+def reset_link(tap):
+    for args in (("dev", tap, "root"), ("dev", tap, "ingress"),
+                 ("dev", "ifb0", "root")):
+        subprocess.call(["tc", "qdisc", "del"] + list(args),
+                        stderr=subprocess.DEVNULL)
+
+
+def serve(sock, result):
+    conn, _ = sock.accept()
+    received = 0
+    valid = True
+    while True:
+        data = conn.recv(4096)
+        if not data:
+            break
+        for i, byte in enumerate(data):
+            if byte != (received + i) & 0xff:
+                valid = False
+                break
+        received += len(data)
+    conn.close()
+    result.append((received, valid))
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_tcp goodput benchmark application.\r\n")
+    child.expect(r"segments in flight: \d+, SACK: (on|off), "
+                 r"zero-copy: (on|off)\r\n")
+
+    tap = os.environ["TAP"]
+    iface = get_bridge(tap)
+    addr = get_host_ll_addr(iface)
+    if_id = get_riot_if_id(child)
+
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("::", BENCH_PORT))
+    sock.listen(1)
+
+    try:
+        for delay, loss in LINKS:
+            reset_link(tap)
+            set_link(tap, delay, loss)
+
+            result = []
+            server = threading.Thread(target=serve, args=(sock, result))
+            server.start()
+            child.sendline("tcp_bench [{}%{}]:{} {}".format(
+                addr, if_id, BENCH_PORT, BENCH_BYTES))
+            child.expect(r"sent (\d+) bytes in (\d+) ms --- (\d+) kbit/s\r\n",
+                         timeout=300)
+            server.join()
+
+            assert int(child.match.group(1)) == BENCH_BYTES
+            assert result == [(BENCH_BYTES, True)]
+            print("delay {} ms, loss {} %: {} kbit/s".format(
+                delay, loss, child.match.group(3)))
+    finally:
+        reset_link(tap)
+        sock.close()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
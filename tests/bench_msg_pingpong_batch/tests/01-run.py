@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for batch in (1, 2, 4, 8, 16, 32):
+        child.expect(r"{{ \"batch\" : {}, \"result\" : \d+(, \"ticks\" : \d+)? }}"
+                     .format(batch))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       littlefs2 benchmark with and without a MTD page cache
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "fs/littlefs2_fs.h"
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#ifndef BENCH_FILES
+#define BENCH_FILES         (16U)
+#endif
+
+#ifndef BENCH_APPENDS
+#define BENCH_APPENDS       (64U)
+#endif
+
+#ifndef BENCH_CHUNK
+#define BENCH_CHUNK         (64U)
+#endif
+
+#define MOUNT_POINT         "/bench"
+
+static uint8_t _chunk[BENCH_CHUNK];
+static uint8_t _buf[BENCH_CHUNK];
+
+#if IS_USED(MODULE_MTD_CACHE)
+static mtd_cache_line_t _lines[MTD_CACHE_LINES];
+static uint8_t _cache_buf[MTD_CACHE_LINES * MTD_PAGE_SIZE];
+
+static mtd_cache_t _cache = {
+    .mtd = {
+        .driver = &mtd_cache_driver,
+    },
+    .lines = _lines,
+    .buf = _cache_buf,
+    .lines_numof = ARRAY_SIZE(_lines),
+    .policy = MTD_CACHE_POLICY,
+    .lock = MUTEX_INIT,
+};
+#endif
+
+static littlefs2_desc_t _fs_desc = {
+    .lock = MUTEX_INIT,
+};
+
+static vfs_mount_t _mount = {
+    .fs = &littlefs2_file_system,
+    .mount_point = MOUNT_POINT,
+    .private_data = &_fs_desc,
+};
+
+static void _stats(mtd_cache_stats_t *stats)
+{
+#if IS_USED(MODULE_MTD_CACHE)
+    mtd_cache_get_stats(&_cache, stats);
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+static void _print_result(const char *name, uint32_t start,
+                          const mtd_cache_stats_t *before)
+{
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+    mtd_cache_stats_t after;
+
+    _stats(&after);
+    printf("%8s: %10" PRIu32 " us --- hits: %8" PRIu32 " misses: %8" PRIu32
+           "\n", name, time, after.hits - before->hits,
+           after.misses - before->misses);
+}
+
+static int _write_file(const char *path, int flags)
+{
+    int fd = vfs_open(path, flags, 0);
+
+    if (fd < 0) {
+        return fd;
+    }
+
+    int res = vfs_write(fd, _chunk, sizeof(_chunk));
+
+    vfs_close(fd);
+    return (res == (int)sizeof(_chunk)) ? 0 : -1;
+}
+
+static int _check_file(const char *path, unsigned chunks)
+{
+    int fd = vfs_open(path, O_RDONLY, 0);
+
+    if (fd < 0) {
+        return fd;
+    }
+    for (unsigned i = 0; i < chunks; i++) {
+        if ((vfs_read(fd, _buf, sizeof(_buf)) != (ssize_t)sizeof(_buf)) ||
+            (memcmp(_buf, _chunk, sizeof(_buf)) != 0)) {
+            vfs_close(fd);
+            return -1;
+        }
+    }
+    vfs_close(fd);
+    return 0;
+}
+
+static int _bench(void)
+{
+    char path[32];
+    mtd_cache_stats_t stats;
+    uint32_t start;
+
+    _stats(&stats);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_FILES; i++) {
+        snprintf(path, sizeof(path), MOUNT_POINT "/file%u", i);
+        if (_write_file(path, O_CREAT | O_WRONLY) < 0) {
+            printf("Error creating %s\n", path);
+            return -1;
+        }
+    }
+    _print_result("create", start, &stats);
+
+    _stats(&stats);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_APPENDS; i++) {
+        if (_write_file(MOUNT_POINT "/log", O_CREAT | O_WRONLY | O_APPEND) < 0) {
+            puts("Error appending to " MOUNT_POINT "/log");
+            return -1;
+        }
+    }
+    _print_result("append", start, &stats);
+
+    _stats(&stats);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_FILES; i++) {
+        snprintf(path, sizeof(path), MOUNT_POINT "/file%u", i);
+        if (_check_file(path, 1) < 0) {
+            printf("Error reading %s\n", path);
+            return -1;
+        }
+    }
+    if (_check_file(MOUNT_POINT "/log", BENCH_APPENDS) < 0) {
+        puts("Error reading " MOUNT_POINT "/log");
+        return -1;
+    }
+    _print_result("read", start, &stats);
+
+    return 0;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_chunk); i++) {
+        _chunk[i] = i;
+    }
+
+#if IS_USED(MODULE_MTD_CACHE)
+    _cache.parent = MTD_0;
+    _fs_desc.dev = &_cache.mtd;
+    printf("littlefs2 on mtd_cache (%u pages, %s)\n", (unsigned)MTD_CACHE_LINES,
+           (MTD_CACHE_POLICY == MTD_CACHE_WRITE_BACK) ? "write-back"
+                                                      : "write-through");
+#else
+    _fs_desc.dev = MTD_0;
+    puts("littlefs2 on mtd_native");
+#endif
+
+    printf("Formatting littlefs2: ");
+    if ((vfs_format(&_mount) < 0) || (vfs_mount(&_mount) < 0)) {
+        puts("FAIL");
+        return 1;
+    }
+    puts("OK\n");
+
+    int res = _bench();
+
+    vfs_umount(&_mount);
+    if (res < 0) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# formatting and accessing the file backed flash emulation is slow
+TIMEOUT = 120
+WORKLOADS = ("create", "append", "read")
+
+
+def testfunc(child):
+    child.expect_exact("Formatting littlefs2: OK", timeout=TIMEOUT)
+    for workload in WORKLOADS:
+        child.expect(r"\s+{}: \s*\d+ us --- hits: \s*\d+ misses: \s*\d+\r\n"
+                     .format(workload), timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       nanocoap request parsing and option lookup benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/nanocoap.h"
+#include "shell.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define BENCH_BUF_SIZE      (128U)
+
+static uint8_t _req_buf[BENCH_BUF_SIZE];
+static size_t _req_len;
+
+static void _build_req(void)
+{
+    coap_pkt_t pkt;
+    uint8_t token[4] = { 0xDE, 0xAD, 0xBE, 0xEF };
+
+    size_t len = coap_build_hdr((coap_hdr_t *)_req_buf, COAP_TYPE_CON,
+                                token, sizeof(token), COAP_METHOD_POST, 0x1234);
+    coap_pkt_init(&pkt, _req_buf, sizeof(_req_buf), len);
+
+    coap_opt_add_uint(&pkt, COAP_OPT_OBSERVE, 0);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, "/sensors/temp/value", '/');
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uri_query(&pkt, "unit", "celsius");
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, 0x12);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK1, 0x1234a);
+    _req_len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+
+    memcpy(pkt.payload, "21.5", 4);
+    _req_len += 4;
+}
+
+static int _parse_req(void)
+{
+    coap_pkt_t pkt;
+    uint8_t *value;
+    uint32_t observe, blknum;
+    unsigned szx;
+
+    if (coap_parse(&pkt, _req_buf, _req_len) < 0) {
+        return -1;
+    }
+    if ((coap_opt_get_uint(&pkt, COAP_OPT_OBSERVE, &observe) < 0)
+            || (coap_opt_get_opaque(&pkt, COAP_OPT_URI_PATH, &value) < 0)
+            || (coap_get_content_type(&pkt) != COAP_FORMAT_CBOR)
+            || (coap_opt_get_opaque(&pkt, COAP_OPT_URI_QUERY, &value) < 0)
+            || (coap_get_blockopt(&pkt, COAP_OPT_BLOCK2, &blknum, &szx) < 0)
+            || (coap_get_blockopt(&pkt, COAP_OPT_BLOCK1, &blknum, &szx) < 0)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int _parse_bench(int argc, char **argv)
+{
+    uint32_t rounds = 10000;
+
+    if (argc > 1) {
+        rounds = atoi(argv[1]);
+    }
+    if (rounds == 0) {
+        printf("usage: %s [<rounds>]\n", argv[0]);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < rounds; i++) {
+        if (_parse_req() < 0) {
+            puts("error: parsing request failed");
+            return 1;
+        }
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("%" PRIu32 " rounds in %" PRIu32 " us = %" PRIu32 " ns/round\n",
+           rounds, diff, (uint32_t)(((uint64_t)diff * NS_PER_US) / rounds));
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "parse_bench", "parse a request and read its options <rounds> times",
+      _parse_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("nanocoap parse benchmark application.");
+    printf("index: %s\n", IS_USED(MODULE_NANOCOAP_OPTION_INDEX) ? "yes" : "no");
+
+    _build_req();
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       netdev_tap per-frame receive cost benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "netdev_tap.h"
+#include "netdev_tap_params.h"
+#include "shell.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MSG_TYPE_ISR        (0x3456)
+#define RX_MSG_QUEUE_SIZE   (8U)
+
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _rx_msg_queue[RX_MSG_QUEUE_SIZE];
+static kernel_pid_t _rx_pid;
+static netdev_tap_t _tap;
+
+static uint32_t _frames;
+static uint32_t _interrupts;
+static uint32_t _busy_us;
+static uint32_t _empty;
+
+static void _recv(netdev_t *dev)
+{
+    /* receive like gnrc_netif_ethernet does */
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
+    gnrc_pktsnip_t *pkt;
+
+    if (len <= 0) {
+        _empty++;
+        return;
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        /* drop the frame */
+        dev->driver->recv(dev, NULL, len, NULL);
+        return;
+    }
+    if (dev->driver->recv(dev, pkt->data, len, NULL) > 0) {
+        _frames++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _event_cb(netdev_t *dev, netdev_event_t event)
+{
+    if (event == NETDEV_EVENT_ISR) {
+        msg_t msg = { .type = MSG_TYPE_ISR };
+
+        if (msg_send(&msg, _rx_pid) <= 0) {
+            puts("bench_netdev_tap_rx: possibly lost interrupt.");
+        }
+    }
+    else if (event == NETDEV_EVENT_RX_COMPLETE) {
+        _recv(dev);
+    }
+}
+
+static void *_rx_thread(void *arg)
+{
+    netdev_t *dev = &_tap.netdev;
+
+    (void)arg;
+    _rx_pid = thread_getpid();
+    msg_init_queue(_rx_msg_queue, RX_MSG_QUEUE_SIZE);
+    dev->event_callback = _event_cb;
+    if (dev->driver->init(dev) < 0) {
+        puts("bench_netdev_tap_rx: unable to initialize TAP.");
+        return NULL;
+    }
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == MSG_TYPE_ISR) {
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+
+            dev->driver->isr(dev);
+            _busy_us += ztimer_now(ZTIMER_USEC) - start;
+            _interrupts++;
+        }
+    }
+    return NULL;
+}
+
+static int _rx_bench(int argc, char **argv)
+{
+    uint32_t seconds = 1;
+
+    if (argc > 1) {
+        seconds = atoi(argv[1]);
+    }
+
+    unsigned state = irq_disable();
+    _frames = 0;
+    _interrupts = 0;
+    _busy_us = 0;
+    _empty = 0;
+    irq_restore(state);
+
+    ztimer_sleep(ZTIMER_USEC, seconds * US_PER_SEC);
+
+    state = irq_disable();
+    uint32_t frames = _frames;
+    uint32_t interrupts = _interrupts;
+    uint32_t busy_us = _busy_us;
+    uint32_t empty = _empty;
+    irq_restore(state);
+
+    printf("received %" PRIu32 " frames in %" PRIu32 " interrupts: %" PRIu32
+           " ns per frame\n", frames, interrupts,
+           (frames > 0) ? (uint32_t)(((uint64_t)busy_us * 1000) / frames) : 0);
+    printf("receive events without a frame: %" PRIu32 "\n", empty);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "rx_bench", "count frames received for <seconds>", _rx_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("netdev_tap receive benchmark application.");
+    printf("rx burst: %u\n", (unsigned)CONFIG_NETDEV_TAP_RX_BURST);
+
+    netdev_tap_setup(&_tap, &netdev_tap_params[0]);
+    thread_create(_rx_stack, sizeof(_rx_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _rx_thread, NULL, "rx_bench");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import subprocess
+import sys
+import threading
+import time
+
+from testrunner import run
+
+BENCH_PORT = 4242
+BENCH_SECONDS = 5
+PAYLOAD = bytes(64)
+
+
+def get_bridge(tap):
+    out = subprocess.check_output(["bridge", "link"]).decode()
+    for line in out.splitlines():
+        if tap in line and "master" in line:
+            return line.split("master")[1].split()[0]
+    return tap
+
+
+def flood(iface, stop):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    addr = ("ff02::1", BENCH_PORT, 0, socket.if_nametoindex(iface))
+    while not stop.is_set():
+        try:
+            sock.sendto(PAYLOAD, addr)
+        except OSError:
+            # host side socket buffer is full
+            time.sleep(0)
+    sock.close()
+
+
+def testfunc(child):
+    child.expect_exact("netdev_tap receive benchmark application.\r\n")
+    child.expect(r"rx burst: \d+\r\n")
+
+    stop = threading.Event()
+    sender = threading.Thread(target=flood,
+                              args=(get_bridge(os.environ["TAP"]), stop))
+    sender.start()
+    try:
+        child.sendline("rx_bench {}".format(BENCH_SECONDS))
+        child.expect(r"received \d+ frames in \d+ interrupts: \d+ ns per frame"
+                     r"\r\n", timeout=BENCH_SECONDS + 5)
+        child.expect(r"receive events without a frame: \d+\r\n")
+    finally:
+        stop.set()
+        sender.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
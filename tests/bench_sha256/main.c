@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       SHA-256 benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BUF_SIZE
+#define BENCH_BUF_SIZE      (1024U)
+#endif
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100U)
+#endif
+
+#ifndef BENCH_CHAIN_LEN
+#define BENCH_CHAIN_LEN     (1000U)
+#endif
+
+/* SHA-256 of the buffer with BENCH_BUF_SIZE = 1024 */
+static const uint8_t _expected[SHA256_DIGEST_LENGTH] = {
+    0x78, 0x5b, 0x07, 0x51, 0xfc, 0x2c, 0x53, 0xdc,
+    0x14, 0xa4, 0xce, 0x3d, 0x80, 0x0e, 0x69, 0xef,
+    0x9c, 0xe1, 0x00, 0x9e, 0xb3, 0x27, 0xcc, 0xf4,
+    0x58, 0xaf, 0xe0, 0x9c, 0x24, 0x2c, 0x26, 0xc9,
+};
+
+static uint8_t _buf[BENCH_BUF_SIZE];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+
+static void _print_result(const char *name, uint32_t time, uint32_t bytes)
+{
+    /* bytes per microsecond are MB/s */
+    uint32_t rate = ((uint64_t)bytes * 1000) / time;
+
+    printf("%20s: %8" PRIu32 " us --- %4" PRIu32 ".%03" PRIu32 " MB/s\n",
+           name, time, rate / 1000, rate % 1000);
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    for (unsigned i = 0; i < BENCH_BUF_SIZE; i++) {
+        _buf[i] = i;
+    }
+
+    puts("SHA-256 benchmark\n");
+    if (BENCH_BUF_SIZE == 1024) {
+        printf("Verifying sha256(): ");
+        sha256(_buf, BENCH_BUF_SIZE, _digest);
+        if (memcmp(_digest, _expected, sizeof(_digest)) != 0) {
+            puts("FAIL");
+            return 1;
+        }
+        puts("OK\n");
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        sha256(_buf, BENCH_BUF_SIZE, _digest);
+    }
+    _print_result("sha256", ztimer_now(ZTIMER_USEC) - start,
+                  BENCH_BUF_SIZE * BENCH_RUNS);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        hmac_sha256(_buf, SHA256_DIGEST_LENGTH, _buf, BENCH_BUF_SIZE, _digest);
+    }
+    _print_result("hmac_sha256", ztimer_now(ZTIMER_USEC) - start,
+                  BENCH_BUF_SIZE * BENCH_RUNS);
+
+    /* every element of the chain is the hash of a single 64 byte block */
+    start = ztimer_now(ZTIMER_USEC);
+    sha256_chain(_buf, SHA256_DIGEST_LENGTH, BENCH_CHAIN_LEN, _digest);
+    _print_result("sha256_chain", ztimer_now(ZTIMER_USEC) - start,
+                  SHA256_INTERNAL_BLOCK_SIZE * BENCH_CHAIN_LEN);
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# The default timeout is not enough for this test on some of the slower boards
+TIMEOUT = 60
+KERNELS = ("sha256", "hmac_sha256", "sha256_chain")
+
+
+def testfunc(child):
+    child.expect_exact("Verifying sha256(): OK")
+    for kernel in KERNELS:
+        child.expect(r"\s+{}: \s*\d+ us --- \s*\d+\.\d{{3}} MB/s\r\n".format(kernel),
+                     timeout=TIMEOUT)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
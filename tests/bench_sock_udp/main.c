@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       sock_udp batched send and receive benchmark
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "shell.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BENCH_PORT
+#define BENCH_PORT          (4242U)
+#endif
+
+#define BENCH_PAYLOAD_LEN   (64U)
+#define BENCH_BURST_MAX     (32U)
+
+static char _rcv_stack[THREAD_STACKSIZE_DEFAULT];
+static uint8_t _rcv_bufs[BENCH_BURST_MAX][BENCH_PAYLOAD_LEN];
+static uint8_t _snd_buf[BENCH_PAYLOAD_LEN];
+static sock_udp_msg_t _rcv_msgs[BENCH_BURST_MAX];
+static sock_udp_msg_t _snd_msgs[BENCH_BURST_MAX];
+static sock_udp_t _rcv_sock;
+static sock_udp_t _snd_sock;
+
+static mutex_t _start = MUTEX_INIT_LOCKED;
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _burst;
+static bool _many;
+
+static void _recv_burst(void)
+{
+    unsigned num = 0;
+
+    while (num < _burst) {
+        if (_many) {
+            ssize_t res = sock_udp_recv_many(&_rcv_sock, _rcv_msgs,
+                                             _burst - num, SOCK_NO_TIMEOUT);
+            if (res < 0) {
+                printf("error: sock_udp_recv_many() returned %d\n", (int)res);
+                return;
+            }
+            num += res;
+        }
+        else {
+            ssize_t res = sock_udp_recv(&_rcv_sock, _rcv_bufs[0],
+                                        sizeof(_rcv_bufs[0]), SOCK_NO_TIMEOUT,
+                                        &_rcv_msgs[0].remote);
+            if (res < 0) {
+                printf("error: sock_udp_recv() returned %d\n", (int)res);
+                return;
+            }
+            num++;
+        }
+    }
+}
+
+static void _send_burst(void)
+{
+    if (_many) {
+        ssize_t res = sock_udp_send_many(&_snd_sock, _snd_msgs, _burst);
+        if (res != (ssize_t)_burst) {
+            printf("error: sock_udp_send_many() returned %d\n", (int)res);
+        }
+        return;
+    }
+    for (unsigned i = 0; i < _burst; i++) {
+        ssize_t res = sock_udp_send(&_snd_sock, _snd_buf, sizeof(_snd_buf),
+                                    &_snd_msgs[i].remote);
+        if (res < 0) {
+            printf("error: sock_udp_send() returned %d\n", (int)res);
+        }
+    }
+}
+
+static void *_rcv_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        mutex_lock(&_start);
+        _recv_burst();
+        mutex_unlock(&_done);
+    }
+    return NULL;
+}
+
+static int _udp_bench(int argc, char **argv)
+{
+    if (argc < 4) {
+        printf("usage: %s <single|many> <burst> <rounds>\n", argv[0]);
+        return 1;
+    }
+    _many = (strcmp(argv[1], "many") == 0);
+    _burst = atoi(argv[2]);
+    uint32_t rounds = atoi(argv[3]);
+    if ((_burst == 0) || (_burst > BENCH_BURST_MAX) || (rounds == 0)) {
+        printf("error: burst must be between 1 and %u\n", BENCH_BURST_MAX);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (uint32_t i = 0; i < rounds; i++) {
+        /* the receiving thread has a lower priority, so the whole burst
+         * is queued at its sock before it starts reading */
+        mutex_unlock(&_start);
+        _send_burst();
+        mutex_lock(&_done);
+    }
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+    uint32_t count = _burst * rounds;
+
+    printf("%s: %" PRIu32 " datagrams in %" PRIu32 " us = %" PRIu32
+           " ns/datagram\n", _many ? "many" : "single", count, diff,
+           (uint32_t)(((uint64_t)diff * NS_PER_US) / count));
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "udp_bench", "send and receive <rounds> bursts of <burst> datagrams",
+      _udp_bench },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = BENCH_PORT };
+
+    puts("sock_udp batch benchmark application.");
+
+    local.port = BENCH_PORT;
+    sock_udp_create(&_rcv_sock, &local, NULL, 0);
+    local.port = 0;
+    sock_udp_create(&_snd_sock, &local, NULL, 0);
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    for (unsigned i = 0; i < BENCH_BURST_MAX; i++) {
+        _rcv_msgs[i].data = _rcv_bufs[i];
+        _rcv_msgs[i].len = sizeof(_rcv_bufs[i]);
+        _snd_msgs[i].data = _snd_buf;
+        _snd_msgs[i].len = sizeof(_snd_buf);
+        _snd_msgs[i].remote = remote;
+    }
+
+    thread_create(_rcv_stack, sizeof(_rcv_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _rcv_thread, NULL, "udp_rcv");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
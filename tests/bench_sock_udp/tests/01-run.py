@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+
+from testrunner import run
+
+BURSTS = (1, 8, 32)
+ROUNDS = 1000
+
+
+def testfunc(child):
+    child.expect_exact("sock_udp batch benchmark application.\r\n")
+    for burst in BURSTS:
+        for mode in ("single", "many"):
+            child.sendline("udp_bench {} {} {}".format(mode, burst, ROUNDS))
+            child.expect(r"{}: {} datagrams in \d+ us = \d+ ns/datagram\r\n"
+                         .format(mode, burst * ROUNDS), timeout=30)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer set / remove benchmark with many armed timers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+
+#include "kernel_defines.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS   (512U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT   (1000U)
+#endif
+
+#ifndef BASE
+#define BASE    (100000000LU)
+#endif
+
+#ifndef SPREAD
+#define SPREAD  (10000LU)
+#endif
+
+static ztimer_t _timers[NUMOF_TIMERS];
+static ztimer_t _probe;
+
+/* This variable is set by any timer that actually triggers.  As the test is
+ * only testing set/remove operations, timers are not supposed to trigger.
+ * Thus, after every test there's an 'expect(!_triggers)'
+ */
+static unsigned _triggers;
+
+static const unsigned _armed[] = { 0, 8, 32, 128, 512 };
+
+static void _callback(void *arg)
+{
+    unsigned *triggers = arg;
+    *triggers += 1;
+}
+
+static void _print_result(const char *desc, unsigned armed, unsigned n,
+                          uint32_t total)
+{
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%s %4u", desc, armed);
+    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", buf, total, n, total/n);
+}
+
+static void _bench(unsigned armed)
+{
+    unsigned n;
+    uint32_t before, diff;
+
+    for (n = 0; n < armed; n++) {
+        ztimer_set(ZTIMER_USEC, &_timers[n], BASE + (SPREAD * n));
+    }
+
+    /*
+     * test setting and removing one more timer that ends up in the middle
+     * of the armed ones REPEAT times
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        ztimer_set(ZTIMER_USEC, &_probe, BASE + (SPREAD * armed / 2));
+        ztimer_remove(ZTIMER_USEC, &_probe);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    _print_result("set() + remove()", armed, REPEAT, diff);
+    expect(!_triggers);
+
+    /*
+     * test re-setting the probe timer REPEAT times, implicitly removing it
+     * before each set
+     *
+     */
+    before = ztimer_now(ZTIMER_USEC);
+    for (n = 0; n < REPEAT; n++) {
+        ztimer_set(ZTIMER_USEC, &_probe, BASE + (SPREAD * armed / 2));
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    ztimer_remove(ZTIMER_USEC, &_probe);
+
+    _print_result("re-set()", armed, REPEAT, diff);
+    expect(!_triggers);
+
+    for (n = 0; n < armed; n++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[n]);
+    }
+}
+
+int main(void)
+{
+    puts("ztimer many timers benchmark application.\n");
+    printf("backend: %s\n", IS_USED(MODULE_ZTIMER_WHEEL) ? "wheel" : "list");
+
+    /* initializing timer structs */
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
+        _timers[n].callback = _callback;
+        _timers[n].arg = &_triggers;
+    }
+    _probe.callback = _callback;
+    _probe.arg = &_triggers;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_armed); i++) {
+        if (_armed[i] > NUMOF_TIMERS) {
+            break;
+        }
+        _bench(_armed[i]);
+    }
+
+    _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, NUMOF_TIMERS,
+                  sizeof(_timers));
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Multi-producer event_post() test application
+ *
+ * Several threads with priorities above, equal to and below the one of the
+ * consumer post to the same event queue. Each producer posts its events twice
+ * per round, the second post must have no effect. The consumer checks that
+ * the events of every producer are handled once and in order.
+ *
+ * main() has the lowest priority and only runs once all other threads are
+ * blocked or done. If event_post() missed to wake up the consumer, the
+ * producers would still be waiting for their rounds then.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "kernel_defines.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define PRODUCERS               (4U)
+#define EVENTS_PER_PRODUCER     (4U)
+#define ROUNDS                  (1000U)
+
+#define FLAG_ROUND_DONE         (0x2)
+
+#define CONSUMER_PRIO           (THREAD_PRIORITY_MAIN - 2)
+
+typedef struct {
+    event_t super;
+    uint8_t producer;
+    uint8_t idx;
+} test_event_t;
+
+static const uint8_t _prios[PRODUCERS] = {
+    CONSUMER_PRIO - 1,
+    CONSUMER_PRIO,
+    CONSUMER_PRIO,
+    CONSUMER_PRIO + 1,
+};
+
+static char _consumer_stack[THREAD_STACKSIZE_DEFAULT];
+static char _producer_stacks[PRODUCERS][THREAD_STACKSIZE_DEFAULT];
+
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+static test_event_t _events[PRODUCERS][EVENTS_PER_PRODUCER];
+static thread_t *_producers[PRODUCERS];
+static unsigned _next[PRODUCERS];
+static unsigned _handled[PRODUCERS];
+static unsigned _rounds[PRODUCERS];
+static unsigned _errors;
+
+static void _handler(event_t *event)
+{
+    test_event_t *ev = container_of(event, test_event_t, super);
+    unsigned p = ev->producer;
+
+    if (ev->idx != _next[p]) {
+        printf("producer %u: got event %u, expected %u\n",
+               p, ev->idx, _next[p]);
+        _errors++;
+    }
+    _next[p] = (ev->idx + 1) % EVENTS_PER_PRODUCER;
+    _handled[p]++;
+    if (_next[p] == 0) {
+        thread_flags_set(_producers[p], FLAG_ROUND_DONE);
+    }
+}
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+static void *_producer(void *arg)
+{
+    unsigned p = (uintptr_t)arg;
+
+    for (unsigned r = 0; r < ROUNDS; r++) {
+        for (unsigned i = 0; i < EVENTS_PER_PRODUCER; i++) {
+            event_post(&_queue, &_events[p][i].super);
+            /* let the other producers and the consumer interleave */
+            thread_yield();
+            /* posting the event again while it is still queued must have no
+             * effect */
+            if ((_handled[p] - r * EVENTS_PER_PRODUCER) <= i) {
+                event_post(&_queue, &_events[p][i].super);
+            }
+        }
+        thread_flags_wait_any(FLAG_ROUND_DONE);
+        _rounds[p]++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    puts("Multi-producer event_post() test");
+
+    for (unsigned p = 0; p < PRODUCERS; p++) {
+        for (unsigned i = 0; i < EVENTS_PER_PRODUCER; i++) {
+            _events[p][i].super.handler = _handler;
+            _events[p][i].producer = p;
+            _events[p][i].idx = i;
+        }
+    }
+    thread_create(_consumer_stack, sizeof(_consumer_stack), CONSUMER_PRIO,
+                  THREAD_CREATE_STACKTEST, _consumer, NULL, "consumer");
+    for (unsigned p = 0; p < PRODUCERS; p++) {
+        kernel_pid_t pid = thread_create(_producer_stacks[p],
+                                         sizeof(_producer_stacks[p]),
+                                         _prios[p], THREAD_CREATE_WOUT_YIELD |
+                                         THREAD_CREATE_STACKTEST,
+                                         _producer, (void *)(uintptr_t)p,
+                                         "producer");
+        _producers[p] = thread_get(pid);
+    }
+    /* all other threads run before main() gets the CPU again */
+    thread_yield();
+
+    for (unsigned p = 0; p < PRODUCERS; p++) {
+        printf("producer %u: %u rounds, %u events\n", p, _rounds[p],
+               _handled[p]);
+        if ((_rounds[p] != ROUNDS) ||
+            (_handled[p] != ROUNDS * EVENTS_PER_PRODUCER)) {
+            _errors++;
+        }
+    }
+    puts((_errors) ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+PRODUCERS = 4
+
+
+def testfunc(child):
+    child.expect_exact('Multi-producer event_post() test')
+    for p in range(PRODUCERS):
+        child.expect_exact('producer {}: 1000 rounds, 4000 events'.format(p))
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
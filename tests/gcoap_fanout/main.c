@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for notifying many observers with gcoap_obs_fanout
+ *
+ * The observers are UDP sockets of the application, registered with the own
+ * gcoap server over the IPv6 loopback address.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#define OBSERVERS           (3U)
+#define OBSERVER_PORT       (5700U)
+#define INTERVAL_US         (CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS * US_PER_MS)
+/* time to wait for a packet that is expected to arrive without delay */
+#define RECV_TIMEOUT_US     (20U * US_PER_MS)
+
+enum {
+    RES_A,
+    RES_B,
+    RES_C,
+    RES_NUMOF,
+};
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len, void *ctx)
+{
+    (void)ctx;
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static const coap_resource_t _resources[] = {
+    [RES_A] = { "/fan/a", COAP_GET, _handler, NULL },
+    [RES_B] = { "/fan/b", COAP_GET, _handler, NULL },
+    [RES_C] = { "/fan/c", COAP_GET, _handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static sock_udp_t _socks[OBSERVERS];
+static uint8_t _tokens[OBSERVERS][RES_NUMOF][GCOAP_TOKENLEN_MAX];
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+/* registers (COAP_OBS_REGISTER) or deregisters an observer of a resource */
+static int _observe(unsigned obs, unsigned res, uint32_t value)
+{
+    sock_udp_ep_t server = { .family = AF_INET6, .port = CONFIG_GCOAP_PORT };
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&server.addr.ipv6);
+    gcoap_req_init(&pdu, _buf, sizeof(_buf), COAP_METHOD_GET, NULL);
+    if (value == COAP_OBS_REGISTER) {
+        memcpy(_tokens[obs][res], pdu.token, coap_get_token_len(&pdu));
+    }
+    else {
+        memcpy(pdu.token, _tokens[obs][res], coap_get_token_len(&pdu));
+    }
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, value);
+    coap_opt_add_uri_path(&pdu, _resources[res].path);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if (sock_udp_send(&_socks[obs], _buf, len, &server) != len) {
+        return -1;
+    }
+    len = sock_udp_recv(&_socks[obs], _buf, sizeof(_buf), RECV_TIMEOUT_US,
+                        NULL);
+    if ((len <= 0) || (coap_parse(&pdu, _buf, len) < 0) ||
+        (coap_get_code(&pdu) != COAP_CODE_205)) {
+        return -1;
+    }
+    /* the response of a registration is the first notification */
+    return (coap_has_observe(&pdu) == (value == COAP_OBS_REGISTER)) ? 0 : -1;
+}
+
+static ssize_t _notify(unsigned res, char value)
+{
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    if (gcoap_obs_fanout_init(&pdu, _buf, sizeof(_buf),
+                              &_resources[res]) != GCOAP_OBS_INIT_OK) {
+        return -1;
+    }
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    pdu.payload[0] = value;
+    return gcoap_obs_fanout_send(_buf, len + 1, &_resources[res]);
+}
+
+/* returns the payload of the next notification of an observer, or 0 */
+static char _recv_notification(unsigned obs, unsigned res, uint32_t timeout)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    ssize_t len = sock_udp_recv(&_socks[obs], buf, sizeof(buf), timeout, NULL);
+
+    if ((len <= 0) || (coap_parse(&pdu, buf, len) < 0) ||
+        !coap_has_observe(&pdu) || (pdu.payload_len != 1) ||
+        (memcmp(pdu.token, _tokens[obs][res], coap_get_token_len(&pdu)) != 0)) {
+        return 0;
+    }
+    return pdu.payload[0];
+}
+
+static void _wait_intervals_end(void)
+{
+    /* an interval without notification returns the buffer to the pool */
+    ztimer_sleep(ZTIMER_MSEC, 3 * CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS);
+}
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        sock_udp_ep_t local = { .family = AF_INET6,
+                                .port = OBSERVER_PORT + i };
+
+        sock_udp_create(&_socks[i], &local, NULL, 0);
+    }
+}
+
+static void tear_down(void)
+{
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        sock_udp_close(&_socks[i]);
+    }
+}
+
+static void test_gcoap_obs_fanout__coalesce(void)
+{
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _observe(i, RES_A, COAP_OBS_REGISTER));
+    }
+    /* the first notification is sent right away to all observers */
+    TEST_ASSERT_EQUAL_INT(OBSERVERS, _notify(RES_A, '1'));
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        TEST_ASSERT_EQUAL_INT('1', _recv_notification(i, RES_A,
+                                                      RECV_TIMEOUT_US));
+    }
+    /* the next ones within the interval are coalesced into the latest */
+    TEST_ASSERT_EQUAL_INT(0, _notify(RES_A, '2'));
+    TEST_ASSERT_EQUAL_INT(0, _notify(RES_A, '3'));
+    TEST_ASSERT_EQUAL_INT(0, _recv_notification(0, RES_A, RECV_TIMEOUT_US));
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        TEST_ASSERT_EQUAL_INT('3', _recv_notification(i, RES_A,
+                                                      2 * INTERVAL_US));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _recv_notification(0, RES_A, 2 * INTERVAL_US));
+    _wait_intervals_end();
+}
+
+static void test_gcoap_obs_fanout__pool_exhausted(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _observe(0, RES_B, COAP_OBS_REGISTER));
+    TEST_ASSERT_EQUAL_INT(0, _observe(0, RES_C, COAP_OBS_REGISTER));
+    /* the pool has a buffer for CONFIG_GCOAP_OBS_FANOUT_PENDING_MAX (2)
+     * rate limited resources */
+    TEST_ASSERT_EQUAL_INT(OBSERVERS, _notify(RES_A, 'a'));
+    TEST_ASSERT_EQUAL_INT(1, _notify(RES_B, 'b'));
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _notify(RES_C, 'c'));
+    TEST_ASSERT_EQUAL_INT('a', _recv_notification(0, RES_A, RECV_TIMEOUT_US));
+    TEST_ASSERT_EQUAL_INT('b', _recv_notification(0, RES_B, RECV_TIMEOUT_US));
+    TEST_ASSERT_EQUAL_INT(0, _recv_notification(0, RES_C, RECV_TIMEOUT_US));
+    _wait_intervals_end();
+    /* the buffers are back in the pool */
+    TEST_ASSERT_EQUAL_INT(1, _notify(RES_C, 'c'));
+    TEST_ASSERT_EQUAL_INT('c', _recv_notification(0, RES_C, RECV_TIMEOUT_US));
+    _wait_intervals_end();
+}
+
+static void test_gcoap_obs_fanout__last_observer_leaves(void)
+{
+    coap_pkt_t pdu;
+
+    TEST_ASSERT_EQUAL_INT(OBSERVERS, _notify(RES_A, '1'));
+    TEST_ASSERT_EQUAL_INT(0, _notify(RES_A, '2'));
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        TEST_ASSERT_EQUAL_INT('1', _recv_notification(i, RES_A,
+                                                      RECV_TIMEOUT_US));
+        TEST_ASSERT_EQUAL_INT(0, _observe(i, RES_A, COAP_OBS_DEREGISTER));
+    }
+    TEST_ASSERT_EQUAL_INT(GCOAP_OBS_INIT_UNUSED,
+                          gcoap_obs_fanout_init(&pdu, _buf, sizeof(_buf),
+                                                &_resources[RES_A]));
+    /* the held back notification is dropped at the end of the interval and
+     * the buffer of the resource is returned, although it was not idle */
+    ztimer_sleep(ZTIMER_MSEC, (3 * CONFIG_GCOAP_OBS_FANOUT_INTERVAL_MS) / 2);
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _recv_notification(i, RES_A,
+                                                    RECV_TIMEOUT_US));
+    }
+    TEST_ASSERT_EQUAL_INT(1, _notify(RES_B, 'b'));
+    TEST_ASSERT_EQUAL_INT(1, _notify(RES_C, 'c'));
+    _wait_intervals_end();
+}
+
+static Test *tests_gcoap_obs_fanout(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gcoap_obs_fanout__coalesce),
+        new_TestFixture(test_gcoap_obs_fanout__pool_exhausted),
+        new_TestFixture(test_gcoap_obs_fanout__last_observer_leaves),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_obs_fanout_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gcoap_obs_fanout_tests;
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+
+    TESTS_START();
+    TESTS_RUN(tests_gcoap_obs_fanout());
+    TESTS_END();
+    return 0;
+}
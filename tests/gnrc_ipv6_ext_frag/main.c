@@ -24,7 +24,6 @@
 #include <string.h>
 
 #include "byteorder.h"
-#include "clist.h"
 #include "embUnit.h"
 #include "net/ipv6/addr.h"
 #include "net/ipv6/ext/frag.h"
@@ -135,7 +134,7 @@ static void test_ipv6_ext_frag_rbuf_free(void)
     rbuf->pkt = pkt;
     gnrc_ipv6_ext_frag_rbuf_free(rbuf);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits.numof);
     TEST_ASSERT_EQUAL_INT(1, pkt->users);
     gnrc_pktbuf_release(pkt);
     TEST_ASSERT(gnrc_pktbuf_is_sane());
@@ -155,7 +154,7 @@ static void test_ipv6_ext_frag_rbuf_del(void)
     gnrc_ipv6_ext_frag_rbuf_del(rbuf);
     TEST_ASSERT_NULL(rbuf->pkt);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits.numof);
     TEST_ASSERT(gnrc_pktbuf_is_sane());
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
@@ -178,7 +177,7 @@ static void test_ipv6_ext_frag_rbuf_gc(void)
     gnrc_ipv6_ext_frag_rbuf_gc();
     TEST_ASSERT_NULL(rbuf->pkt);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits.numof);
 }
 
 static void test_ipv6_ext_frag_reass_in_order(void)
@@ -190,7 +189,6 @@ static void test_ipv6_ext_frag_reass_in_order(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
 
     ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
     ipv6->hl = TEST_HL;
@@ -210,13 +208,9 @@ static void test_ipv6_ext_frag_reass_in_order(void)
     TEST_ASSERT_MESSAGE(ipv6 == rbuf->ipv6, "IPv6 header is not the same");
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(!rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET, rbuf->limits.ints[0].end);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
 
     /* prepare 2nd fragment */
@@ -244,18 +238,12 @@ static void test_ipv6_ext_frag_reass_in_order(void)
                           rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(!rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    /* the limits of every fragment are kept */
+    TEST_ASSERT_EQUAL_INT(2, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET, rbuf->limits.ints[0].end);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET, rbuf->limits.ints[1].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET, rbuf->limits.ints[1].end);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
 
     /* prepare 3rd fragment */
@@ -300,7 +288,6 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
 
 
     ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
@@ -318,13 +305,9 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET, rbuf->limits.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->limits.ints[0].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
                        rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
@@ -351,18 +334,12 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_NOT_NULL(rbuf->pkt);
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    /* the limits of every fragment are kept */
+    TEST_ASSERT_EQUAL_INT(2, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET, rbuf->limits.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET, rbuf->limits.ints[0].end);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET, rbuf->limits.ints[1].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->limits.ints[1].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG2_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG2_OFFSET,
                        rbuf->pkt->size - TEST_FRAG2_OFFSET) == 0);
@@ -409,7 +386,6 @@ static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
     static const uint32_t foreign_id = TEST_ID + 44U;
 
 
@@ -431,13 +407,9 @@ static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(foreign_id, rbuf->id);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET, rbuf->limits.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->limits.ints[0].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
                        rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
@@ -481,6 +453,95 @@ static void test_ipv6_ext_frag_reass_one_frag(void)
     gnrc_pktbuf_is_empty();
 }
 
+static gnrc_pktsnip_t *_build_frag(const uint8_t *data, size_t size,
+                                   unsigned offset, bool more)
+{
+    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, data, size,
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *ipv6 = ipv6_snip->data;
+    ipv6_ext_frag_t *frag = pkt->data;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    ipv6_ext_frag_set_offset(frag, offset);
+    if (more) {
+        ipv6_ext_frag_set_more(frag);
+    }
+    frag->id = byteorder_htonl(TEST_ID);
+    return pkt;
+}
+
+static void test_ipv6_ext_frag_reass_duplicate(void)
+{
+    gnrc_pktsnip_t *pkt = _build_frag(_test_frag1, sizeof(_test_frag1),
+                                      TEST_FRAG1_OFFSET, true);
+    ipv6_hdr_t *ipv6 = pkt->next->data;
+    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+
+    /* receive 1st fragment */
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(ipv6, TEST_ID)));
+    /* receive 1st fragment again */
+    pkt = _build_frag(_test_frag1, sizeof(_test_frag1), TEST_FRAG1_OFFSET,
+                      true);
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* the exact duplicate is ignored, but the datagram is kept */
+    TEST_ASSERT_NOT_NULL(rbuf->ipv6);
+    TEST_ASSERT_NOT_NULL(rbuf->pkt);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits.numof);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits.frags);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test_frag1) - sizeof(ipv6_ext_frag_t),
+                          rbuf->pkt->size);
+    TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
+}
+
+static void test_ipv6_ext_frag_reass_overlap_within(void)
+{
+    gnrc_pktsnip_t *pkt = _build_frag(_test_frag1, sizeof(_test_frag1),
+                                      TEST_FRAG1_OFFSET, true);
+    ipv6_hdr_t *ipv6 = pkt->next->data;
+    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+
+    /* receive 1st fragment */
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(ipv6, TEST_ID)));
+    /* receive a fragment within the 1st fragment, but with different limits
+     * (see https://tools.ietf.org/html/rfc5722#section-4) */
+    pkt = _build_frag(_test_frag1, sizeof(ipv6_ext_frag_t) + 8U,
+                      TEST_FRAG1_OFFSET + 8U, true);
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* the whole datagram is discarded */
+    TEST_ASSERT_NULL(rbuf->ipv6);
+    TEST_ASSERT_NULL(rbuf->pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_ipv6_ext_frag_reass_empty(void)
+{
+    gnrc_pktsnip_t *pkt = _build_frag(_test_frag1, sizeof(_test_frag1),
+                                      TEST_FRAG1_OFFSET, true);
+    ipv6_hdr_t *ipv6 = pkt->next->data;
+    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+
+    /* receive 1st fragment */
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(ipv6, TEST_ID)));
+    /* receive a fragment without any data */
+    pkt = _build_frag(_test_frag2, sizeof(ipv6_ext_frag_t),
+                      TEST_FRAG2_OFFSET, true);
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* the fragment is rejected with the datagram */
+    TEST_ASSERT_NULL(rbuf->ipv6);
+    TEST_ASSERT_NULL(rbuf->pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void run_unittests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -492,6 +553,9 @@ static void run_unittests(void)
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order),
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order_rbuf_full),
         new_TestFixture(test_ipv6_ext_frag_reass_one_frag),
+        new_TestFixture(test_ipv6_ext_frag_reass_duplicate),
+        new_TestFixture(test_ipv6_ext_frag_reass_overlap_within),
+        new_TestFixture(test_ipv6_ext_frag_reass_empty),
     };
 
     EMB_UNIT_TESTCALLER(ipv6_ext_frag_tests, NULL, tear_down_tests, fixtures);
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the batched receive mode of gnrc_netif
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/netdev_test.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MSG_QUEUE_SIZE      (8U)
+/* time for a batch to arrive, if it is not held back */
+#define RECV_TIMEOUT_US     (10U * US_PER_MS)
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netreg_entry_t _entry;
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+
+/* number of frames received per call of the ISR handler */
+static unsigned _burst;
+/* sequence number of the next received frame */
+static uint8_t _rx_seq;
+/* sequence number of the next frame expected by the test */
+static uint8_t _expected_seq;
+
+static void _isr(netdev_t *dev)
+{
+    for (unsigned i = 0; i < _burst; i++) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_TEST;
+    return sizeof(uint16_t);
+}
+
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, &_rx_seq, sizeof(_rx_seq),
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+    if ((pkt == NULL) || (hdr == NULL)) {
+        gnrc_pktbuf_release(pkt);
+        gnrc_pktbuf_release(hdr);
+        return NULL;
+    }
+    gnrc_netif_hdr_set_netif(hdr->data, netif);
+    _rx_seq++;
+    return gnrc_pkt_append(pkt, hdr);
+}
+
+/* loops every frame back, like a device reporting a frame it received while
+ * sending */
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    int res = gnrc_pkt_len(pkt);
+
+    gnrc_pktbuf_release(pkt);
+    netif->dev->event_callback(netif->dev, NETDEV_EVENT_RX_COMPLETE);
+    return res;
+}
+
+static const gnrc_netif_ops_t _ops = {
+    .init = gnrc_netif_default_init,
+    .send = _send,
+    .recv = _recv,
+    .get = gnrc_netif_get_from_netdev,
+    .set = gnrc_netif_set_from_netdev,
+};
+
+/* receives the next batch and checks the sequence of its packets
+ *
+ * returns number of packets in the batch, or -1 if the order was wrong */
+static int _recv_batch(void)
+{
+    msg_t msg;
+    int numof = 0;
+    bool in_order = true;
+
+    if ((ztimer_msg_receive_timeout(ZTIMER_USEC, &msg, RECV_TIMEOUT_US) < 0) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_RCV_BATCH)) {
+        return 0;
+    }
+    for (gnrc_pktsnip_t *pkt = msg.content.ptr, *next; pkt; pkt = next) {
+        next = gnrc_netif_hdr_rx_batch_next(pkt);
+        if (*((uint8_t *)pkt->data) != _expected_seq++) {
+            in_order = false;
+        }
+        gnrc_pktbuf_release(pkt);
+        numof++;
+    }
+    return (in_order) ? numof : -1;
+}
+
+static void set_up(void)
+{
+    _expected_seq = _rx_seq;
+}
+
+static void test_rx_batch__isr(void)
+{
+    _burst = 3;
+    netdev_trigger_event_isr(&_dev.netdev);
+    TEST_ASSERT_EQUAL_INT(3, _recv_batch());
+    TEST_ASSERT_EQUAL_INT(0, _recv_batch());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_rx_batch__isr_exceeds_batch_size(void)
+{
+    _burst = CONFIG_GNRC_NETIF_RX_BATCH_SIZE + 2;
+    netdev_trigger_event_isr(&_dev.netdev);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_RX_BATCH_SIZE, _recv_batch());
+    TEST_ASSERT_EQUAL_INT(2, _recv_batch());
+    TEST_ASSERT_EQUAL_INT(0, _recv_batch());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_rx_batch__outside_isr(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* the frame received while sending is passed on without waiting for the
+     * next interrupt */
+    TEST_ASSERT(gnrc_netif_send(&_netif, pkt) > 0);
+    TEST_ASSERT_EQUAL_INT(1, _recv_batch());
+    /* and so is a frame received before an interrupt in the same thread */
+    _burst = 2;
+    pkt = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(gnrc_netif_send(&_netif, pkt) > 0);
+    netdev_trigger_event_isr(&_dev.netdev);
+    TEST_ASSERT_EQUAL_INT(1, _recv_batch());
+    TEST_ASSERT_EQUAL_INT(2, _recv_batch());
+    TEST_ASSERT_EQUAL_INT(0, _recv_batch());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_netif_rx_batch(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rx_batch__isr),
+        new_TestFixture(test_rx_batch__isr_exceeds_batch_size),
+        new_TestFixture(test_rx_batch__outside_isr),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netif_rx_batch_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_netif_rx_batch_tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    gnrc_netif_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                      GNRC_NETIF_PRIO, "netif", &_dev.netdev, &_ops);
+    gnrc_netreg_entry_init_rx_batch(&_entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                                    thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_entry);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_rx_batch());
+    TESTS_END();
+    return 0;
+}
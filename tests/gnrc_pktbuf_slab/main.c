@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the slab pool backend of the GNRC packet buffer
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/pktbuf.h"
+
+#define TEST_STRING8    "PJxmyOy"
+#define TEST_STRING16   "lyaHmq2BGyh0hXs"
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static void tear_down(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_init(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+}
+
+static void test_pktbuf_slab_add__size_classes(void)
+{
+    gnrc_pktsnip_t *hdr, *frame, *mtu;
+
+    hdr = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    frame = gnrc_pktbuf_add(hdr, NULL, CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE,
+                            GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(frame);
+    mtu = gnrc_pktbuf_add(frame, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(mtu);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING8, hdr->data);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_FRAME_SIZE, frame->size);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE, mtu->size);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(mtu);
+}
+
+static void test_pktbuf_slab_add__memfull(void)
+{
+    gnrc_pktsnip_t *pkt = NULL, *tmp;
+    unsigned count = 0;
+
+    /* every snip needs a descriptor and a data chunk, and data falls back to
+     * the bigger pools once the header pool is exhausted */
+    while ((tmp = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST)) != NULL) {
+        pkt = tmp;
+        count++;
+    }
+    TEST_ASSERT(count > 0);
+    TEST_ASSERT(count <= CONFIG_GNRC_PKTBUF_SLAB_HDR_NUMOF);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_release__reuse(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2;
+    void *data;
+
+    pkt1 = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE,
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt1);
+    data = pkt1->data;
+    gnrc_pktbuf_release(pkt1);
+    pkt2 = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE,
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    /* freed slot is handed out first again */
+    TEST_ASSERT(data == pkt2->data);
+    gnrc_pktbuf_release(pkt2);
+}
+
+static void test_pktbuf_slab_mark__shares_slot(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    uint8_t *data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT(pkt->data == (data + 8));
+    TEST_ASSERT_EQUAL_INT(8, hdr->size);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, hdr->data, 8));
+    TEST_ASSERT_EQUAL_STRING(&TEST_STRING16[8], pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* the shared slot must survive removal of the marked snip */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_STRING(&TEST_STRING16[8], pkt->data);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_mark__equally_sized(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, sizeof(TEST_STRING16), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, pkt->size);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_realloc_data__in_place(void)
+{
+    gnrc_pktsnip_t *pkt;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 2 * sizeof(TEST_STRING8)));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING8, pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 4));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_realloc_data__move(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt,
+                                                      CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING8, pkt->data);
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_realloc_data(pkt,
+                                                           CONFIG_GNRC_PKTBUF_SLAB_MTU_SIZE + 1));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_realloc_data__shared(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    uint8_t *hdr_data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    hdr_data = hdr->data;
+    /* growing the marked snip in place would overwrite pkt's data */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 12));
+    TEST_ASSERT(hdr_data != hdr->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, hdr->data, 8));
+    TEST_ASSERT_EQUAL_STRING(&TEST_STRING16[8], pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_merge(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, &TEST_STRING16[8], sizeof(TEST_STRING16) - 8,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, TEST_STRING16, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_merge(pkt));
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, pkt->data);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_start_write(void)
+{
+    gnrc_pktsnip_t *pkt, *pkt_copy;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    pkt_copy = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(pkt_copy);
+    TEST_ASSERT(pkt != pkt_copy);
+    TEST_ASSERT(pkt->data != pkt_copy->data);
+    TEST_ASSERT_EQUAL_STRING(pkt->data, pkt_copy->data);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    gnrc_pktbuf_release(pkt_copy);
+    gnrc_pktbuf_release(pkt);
+}
+
+Test *tests_pktbuf_slab_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_init),
+        new_TestFixture(test_pktbuf_slab_add__too_large),
+        new_TestFixture(test_pktbuf_slab_add__size_classes),
+        new_TestFixture(test_pktbuf_slab_add__memfull),
+        new_TestFixture(test_pktbuf_slab_release__reuse),
+        new_TestFixture(test_pktbuf_slab_mark__shares_slot),
+        new_TestFixture(test_pktbuf_slab_mark__equally_sized),
+        new_TestFixture(test_pktbuf_slab_realloc_data__in_place),
+        new_TestFixture(test_pktbuf_slab_realloc_data__move),
+        new_TestFixture(test_pktbuf_slab_realloc_data__shared),
+        new_TestFixture(test_pktbuf_slab_merge),
+        new_TestFixture(test_pktbuf_slab_start_write),
+    };
+
+    EMB_UNIT_TESTCALLER(pktbuf_slab_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&pktbuf_slab_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_pktbuf_slab_tests());
+    TESTS_END();
+    return 0;
+}
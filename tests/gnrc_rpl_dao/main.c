@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Test application for the RPL DAO handling in storing mode
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/netif.h"
+#include "shell.h"
+
+static char _line_buf[SHELL_DEFAULT_BUFSIZE];
+
+int main(void)
+{
+    char addr_str[GNRC_NETIF_L2ADDR_MAXLEN * 3];
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+
+    printf("iface: %" PRIkernel_pid "\n", netif->pid);
+    printf("l2_addr: %s\n", gnrc_netif_addr_to_str(netif->l2addr,
+                                                   netif->l2addr_len,
+                                                   addr_str));
+    shell_run(NULL, _line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import socket
+import struct
+import sys
+import time
+
+from testrunner import run
+from scapy.all import ZEP2, Dot15d4Data, Dot15d4FCS, IPv6, raw
+from scapy.layers.inet6 import ICMPv6Unknown
+
+ZEP_V2_VERSION = 2
+ZEP_V2_TYPE_DATA = 1
+
+SIXLOWPAN_UNCOMP = 0x41
+
+ICMPV6_RPL_CTRL = 155
+RPL_DAO = 2
+RPL_DAO_K_BIT = 0x80
+RPL_OPT_TARGET = 5
+RPL_OPT_TRANSIT = 6
+
+INSTANCE_ID = 1
+DODAG_ID = "2001:db8::1"
+TARGETS = ("2001:db8::2", "2001:db8::3")
+
+
+class Node:
+    def __init__(self, child, sock):
+        self.child = child
+        self.sock = sock
+        child.expect(r"iface: (\d+)\r\n")
+        self.iface = int(child.match.group(1))
+        child.expect(r"l2_addr: ([0-9A-F:]+)\r\n")
+        self.addr = int(child.match.group(1).replace(':', ''), base=16)
+        self.seq = 0
+
+    @staticmethod
+    def ll_addr(short_addr):
+        return "fe80::ff:fe00:{:x}".format(short_addr)
+
+    def send(self, src, dst, sixlo):
+        self.seq = (self.seq + 1) & 0xff
+        payload = (
+            Dot15d4FCS(fcf_srcaddrmode=2, fcf_panidcompress=True,
+                       fcf_frametype="Data", seqnum=self.seq) /
+            Dot15d4Data(dest_addr=dst, dest_panid=0x23, src_addr=src) /
+            sixlo
+        )
+        packet = raw(
+            ZEP2(ver=ZEP_V2_VERSION, type=ZEP_V2_TYPE_DATA, channel=26,
+                 length=len(payload)) / payload
+        )
+        self.sock.sendto(packet, ("localhost", 17755))
+
+
+def dao(seq, target):
+    base = struct.pack("!BBBB", INSTANCE_ID, RPL_DAO_K_BIT, 0, seq)
+    opt_target = struct.pack("!BBBB16s", RPL_OPT_TARGET, 18, 0, 128,
+                             socket.inet_pton(socket.AF_INET6, target))
+    opt_transit = struct.pack("!BBBBBB", RPL_OPT_TRANSIT, 4, 0, 0, 0, 5)
+    return base + opt_target + opt_transit
+
+
+def send_dao(node, child, seq, target):
+    node.send(child, node.addr & 0xffff, bytes([SIXLOWPAN_UNCOMP]) + raw(
+        IPv6(src=Node.ll_addr(child), dst=Node.ll_addr(node.addr & 0xffff),
+             hlim=64) /
+        ICMPv6Unknown(type=ICMPV6_RPL_CTRL, code=RPL_DAO, msgbody=dao(seq, target))
+    ))
+
+
+def expect_stat(child, name, value):
+    child.sendline("rpl stats")
+    child.expect(r"{}: +(\d+)".format(name))
+    assert int(child.match.group(1)) == value, \
+        "{} is {}, expected {}".format(name, child.match.group(1), value)
+
+
+def testfunc(child):
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        s.bind(("", 17754))
+        s.settimeout(5)
+        node = Node(child, s)
+        child_addr = (node.addr - 1) & 0xffff
+        child.sendline("ifconfig {} add {}/64".format(node.iface, DODAG_ID))
+        child.expect_exact("success")
+        child.sendline("rpl init {}".format(node.iface))
+        child.expect_exact("successfully initialized RPL on interface {}"
+                           .format(node.iface))
+        child.sendline("rpl root {} {}".format(INSTANCE_ID, DODAG_ID))
+        child.expect_exact("successfully added a new RPL DODAG")
+
+        # two DAOs of the same child within the coalescing delay
+        send_dao(node, child_addr, 1, TARGETS[0])
+        send_dao(node, child_addr, 2, TARGETS[1])
+        time.sleep(1)
+        # routes to both halves of 2001:db8::2/127 are aggregated
+        child.sendline("nib route")
+        child.expect(r"2001:db8::2/127 via {}".format(Node.ll_addr(child_addr)))
+        expect_stat(child, r"FT   #aggregated", 1)
+        # only the DAO-ACK to the latest DAO is sent
+        expect_stat(child, r"DAO-ACK #batched", 1)
+        child.sendline("rpl stats")
+        child.expect(r"DAO-ACK #packets: +\d+ / (\d+) ")
+        assert int(child.match.group(1)) == 1
+        print("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=5))
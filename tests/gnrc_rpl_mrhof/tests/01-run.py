@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import socket
+import struct
+import sys
+import time
+
+from testrunner import run
+from scapy.all import ZEP2, Dot15d4Data, Dot15d4FCS, IPv6, raw
+from scapy.layers.inet6 import ICMPv6Unknown
+
+ZEP_V2_VERSION = 2
+ZEP_V2_TYPE_DATA = 1
+
+SIXLOWPAN_UNCOMP = 0x41
+BROADCAST = 0xffff
+
+ICMPV6_RPL_CTRL = 155
+RPL_DIO = 1
+RPL_OPT_MC = 2
+RPL_OPT_DODAG_CONF = 4
+RPL_OPT_PREFIX_INFO = 8
+RPL_MC_ETX = 7
+RPL_MOP_STORING = 2
+MRHOF_OCP = 1
+
+MHRI = 256
+PARENT_RANK = 2 * MHRI
+DODAG_ID = socket.inet_pton(socket.AF_INET6, "2001:db8::1")
+PREFIX = socket.inet_pton(socket.AF_INET6, "2001:db8::")
+# no acknowledgments with ZEP, so every link the node sent on has ETX 1
+LINK_METRIC = 128
+
+
+class Node:
+    def __init__(self, child, sock):
+        self.child = child
+        self.sock = sock
+        child.expect(r"iface: (\d+)\r\n")
+        self.iface = int(child.match.group(1))
+        child.expect(r"l2_addr: ([0-9A-F:]+)\r\n")
+        self.addr = int(child.match.group(1).replace(':', ''), base=16)
+        self.seq = 0
+
+    @staticmethod
+    def ll_addr(short_addr):
+        return "fe80::ff:fe00:{:x}".format(short_addr)
+
+    def send(self, src, dst, sixlo):
+        self.seq = (self.seq + 1) & 0xff
+        payload = (
+            Dot15d4FCS(fcf_srcaddrmode=2, fcf_panidcompress=True,
+                       fcf_frametype="Data", seqnum=self.seq) /
+            Dot15d4Data(dest_addr=dst, dest_panid=0x23, src_addr=src) /
+            sixlo
+        )
+        packet = raw(
+            ZEP2(ver=ZEP_V2_VERSION, type=ZEP_V2_TYPE_DATA, channel=26,
+                 length=len(payload)) / payload
+        )
+        self.sock.sendto(packet, ("localhost", 17755))
+
+    def preferred_parent(self):
+        self.child.sendline("rpl")
+        self.child.expect(r"parent \[addr: (\S+) \| rank: (\d+) \| "
+                          r"link: (\d+) \| cost: (\d+)\]")
+        return self.child.match.group(1), int(self.child.match.group(4))
+
+
+def dio(path_cost):
+    base = struct.pack("!BBHBBBB16s", 0, 0, PARENT_RANK,
+                       RPL_MOP_STORING << 3, 0, 0, 0, DODAG_ID)
+    dodag_conf = struct.pack("!BBBBBBHHHBBH", RPL_OPT_DODAG_CONF, 14, 0,
+                             20, 3, 10, 0, MHRI, MRHOF_OCP, 0, 5, 60)
+    prefix_info = struct.pack("!BBBBIII16s", RPL_OPT_PREFIX_INFO, 30, 64,
+                              0x40, 0xffffffff, 0xffffffff, 0, PREFIX)
+    mc = struct.pack("!BBBHBH", RPL_OPT_MC, 6, RPL_MC_ETX, 0, 2, path_cost)
+    return base + dodag_conf + prefix_info + mc
+
+
+def send_dio(node, parent, path_cost):
+    node.send(parent, BROADCAST, bytes([SIXLOWPAN_UNCOMP]) + raw(
+        IPv6(src=Node.ll_addr(parent), dst="ff02::1a", hlim=255) /
+        ICMPv6Unknown(type=ICMPV6_RPL_CTRL, code=RPL_DIO,
+                      msgbody=dio(path_cost))
+    ))
+
+
+def expect_preferred(node, parent, cost, retries=10):
+    for _ in range(retries):
+        addr, pcost = node.preferred_parent()
+        if (addr == Node.ll_addr(parent)) and (pcost == cost):
+            return
+        time.sleep(0.1)
+    assert False, "{} (cost {}) not preferred, got {} (cost {})".format(
+        Node.ll_addr(parent), cost, addr, pcost
+    )
+
+
+def testfunc(child):
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        s.bind(("", 17754))
+        s.settimeout(5)
+        node = Node(child, s)
+        parent_a = (node.addr - 1) & 0xffff
+        parent_b = (node.addr - 2) & 0xffff
+        # send a frame to both routers, so both links have the same ETX
+        for parent in (parent_a, parent_b):
+            child.sendline("ping6 -c 1 -W 100 {}".format(Node.ll_addr(parent)))
+            child.expect(r"1 packets transmitted")
+        child.sendline("rpl init {}".format(node.iface))
+        child.expect_exact("successfully initialized RPL on interface {}"
+                           .format(node.iface))
+
+        # join via router A
+        send_dio(node, parent_a, 384)
+        expect_preferred(node, parent_a, 384 + LINK_METRIC)
+        # router B is better, but not by PARENT_SWITCH_THRESHOLD
+        send_dio(node, parent_b, 256)
+        time.sleep(0.5)
+        expect_preferred(node, parent_a, 384 + LINK_METRIC, retries=1)
+        # router B is better by more than PARENT_SWITCH_THRESHOLD
+        send_dio(node, parent_b, 128)
+        expect_preferred(node, parent_b, 128 + LINK_METRIC)
+        print("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=5))
@@ -235,10 +235,9 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
-    TEST_ASSERT_NOT_NULL(entry->super.ints);
-    TEST_ASSERT_NULL(entry->super.ints->next);
-    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
-    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+    TEST_ASSERT_EQUAL_INT(1, entry->super.ints.numof);
+    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints.ints[0].end);
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
@@ -262,7 +261,7 @@ static void _rbuf_create_first_fragment(void)
     /* current_size must be the offset of fragment 2, not the size of
      * fragment 1 (fragment dispatch was removed, IPHC was applied etc.). */
     _test_entry(entry, TEST_FRAGMENT2_OFFSET,
-                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT2_OFFSET - 1);
+                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT2_OFFSET);
 }
 
 static void test_rbuf_add__success_first_fragment(void)
@@ -288,7 +287,7 @@ static void test_rbuf_add__success_subsequent_fragment(void)
     /* current_size must be the offset of fragment 3, not the size of
      * fragment 2 (fragment dispatch was removed, IPHC was applied etc.). */
     _test_entry(entry, TEST_FRAGMENT3_OFFSET - TEST_FRAGMENT2_OFFSET,
-                TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT3_OFFSET - 1);
+                TEST_FRAGMENT2_OFFSET, TEST_FRAGMENT3_OFFSET);
     _check_pktbuf(entry);
 }
 
@@ -311,7 +310,7 @@ static void test_rbuf_add__success_duplicate_fragments(void)
     /* current_size must be the offset of fragment 4, not the size of
      * fragment 3 (fragment dispatch was removed, IPHC was applied etc.). */
     _test_entry(entry, TEST_FRAGMENT4_OFFSET - TEST_FRAGMENT3_OFFSET,
-                TEST_FRAGMENT3_OFFSET, TEST_FRAGMENT4_OFFSET - 1);
+                TEST_FRAGMENT3_OFFSET, TEST_FRAGMENT4_OFFSET);
     _check_pktbuf(entry);
 }
 
@@ -468,7 +467,7 @@ static void test_rbuf_add__overlap_lhs(void)
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         const gnrc_sixlowpan_frag_rb_t *entry = &rbuf[i];
         if (!gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
-            static const size_t pkt3_offset = TEST_FRAGMENT3_OFFSET - 8U - 1;
+            static const size_t pkt3_offset = TEST_FRAGMENT3_OFFSET - 8U;
 
             rbuf_entries++;
             /* only _fragment2 should now in the reassembly buffer according to
@@ -517,7 +516,7 @@ static void test_rbuf_add__overlap_rhs(void)
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         const gnrc_sixlowpan_frag_rb_t *entry = &rbuf[i];
         if (!gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
-            static const size_t pkt3_offset = TEST_FRAGMENT3_OFFSET + 8U - 1U;
+            static const size_t pkt3_offset = TEST_FRAGMENT3_OFFSET + 8U;
 
             rbuf_entries++;
             /* only _fragment2 should now in the reassembly buffer according to
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Test application for 6LoWPAN selective fragment recovery
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktdump.h"
+#include "shell.h"
+
+#define TEST_PORT   (61616U)
+
+static char _line_buf[SHELL_DEFAULT_BUFSIZE];
+
+int main(void)
+{
+    char addr_str[GNRC_NETIF_L2ADDR_MAXLEN * 3];
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    gnrc_netreg_entry_t dump = GNRC_NETREG_ENTRY_INIT_PID(
+            TEST_PORT,
+            gnrc_pktdump_pid
+        );
+
+    printf("l2_addr: %s\n", gnrc_netif_addr_to_str(netif->l2addr,
+                                                   netif->l2addr_len,
+                                                   addr_str));
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &dump);
+    shell_run(NULL, _line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import socket
+import struct
+import sys
+
+from testrunner import run
+from scapy.all import ZEP2, Dot15d4Data, Dot15d4FCS, IPv6, UDP, raw
+
+ZEP_V2_VERSION = 2
+ZEP_V2_TYPE_DATA = 1
+ZEP_V2_HDR_LEN = 32
+
+SFR_RFRAG_DISP = 0xe8
+SFR_ACK_DISP = 0xea
+SFR_ACK_REQ = 0x80
+SIXLOWPAN_UNCOMP = 0x41
+
+TEST_PORT = 61616
+FULL_BITMAP = 0xffffffff
+
+
+class Node:
+    def __init__(self, child, sock):
+        self.child = child
+        self.sock = sock
+        child.expect(r"l2_addr: ([0-9A-F:]+)\r\n")
+        self.addr = int(child.match.group(1).replace(':', ''), base=16)
+        self.peer = (self.addr - 1) & 0xffff
+        self.seq = 0
+
+    @staticmethod
+    def ll_addr(short_addr):
+        return "fe80::ff:fe00:{:x}".format(short_addr)
+
+    def send(self, sixlo):
+        self.seq = (self.seq + 1) & 0xff
+        payload = (
+            Dot15d4FCS(fcf_srcaddrmode=2, fcf_panidcompress=True,
+                       fcf_frametype="Data", seqnum=self.seq) /
+            Dot15d4Data(dest_addr=self.addr, dest_panid=0x23,
+                        src_addr=self.peer) /
+            sixlo
+        )
+        packet = raw(
+            ZEP2(ver=ZEP_V2_VERSION, type=ZEP_V2_TYPE_DATA, channel=26,
+                 length=len(payload)) / payload
+        )
+        self.sock.sendto(packet, ("localhost", 17755))
+
+    def recv(self):
+        """Returns the 6LoWPAN payload of the next frame sent by the node"""
+        frame = self.sock.recv(256)[ZEP_V2_HDR_LEN:]
+        fcf = frame[0] | (frame[1] << 8)
+        idx = 3
+        dst_mode = (fcf >> 10) & 0x3
+        src_mode = (fcf >> 14) & 0x3
+        if dst_mode:
+            idx += 2 + (2 if dst_mode == 2 else 8)
+        if src_mode:
+            idx += (0 if (fcf & 0x40) else 2) + (2 if src_mode == 2 else 8)
+        # strip FCS
+        return frame[idx:-2]
+
+    def recv_sfr(self, disp):
+        while True:
+            sixlo = self.recv()
+            if (sixlo[0] & 0xfe) == disp:
+                return sixlo
+
+
+def rfrag(tag, seq, offset, data, ack_req=False):
+    ar_seq_fs = (seq << 10) | len(data)
+    if ack_req:
+        ar_seq_fs |= SFR_ACK_REQ << 8
+    return struct.pack("!BBHH", SFR_RFRAG_DISP, tag, ar_seq_fs, offset) + data
+
+
+def parse_rfrag(sixlo):
+    _, tag, ar_seq_fs, offset = struct.unpack("!BBHH", sixlo[:6])
+    return {
+        "tag": tag,
+        "ack_req": bool(ar_seq_fs & (SFR_ACK_REQ << 8)),
+        "seq": (ar_seq_fs >> 10) & 0x1f,
+        "frag_size": ar_seq_fs & 0x3ff,
+        "offset": offset,
+    }
+
+
+def ack(tag, bitmap):
+    return struct.pack("!BBI", SFR_ACK_DISP, tag, bitmap)
+
+
+def parse_ack(sixlo):
+    _, tag, bitmap = struct.unpack("!BBI", sixlo[:6])
+    return tag, bitmap
+
+
+def test_selective_resend(node):
+    node.child.sendline("ping6 -c 1 -s 300 {}".format(Node.ll_addr(node.peer)))
+    frags = []
+    while not frags or not frags[-1]["ack_req"]:
+        frags.append(parse_rfrag(node.recv_sfr(SFR_RFRAG_DISP)))
+    assert len(frags) > 2
+    assert [f["seq"] for f in frags] == list(range(len(frags)))
+    tag = frags[0]["tag"]
+    # pretend the second fragment was lost
+    bitmap = 0
+    for frag in frags:
+        if frag["seq"] != 1:
+            bitmap |= 0x80000000 >> frag["seq"]
+    node.send(ack(tag, bitmap))
+    resent = parse_rfrag(node.recv_sfr(SFR_RFRAG_DISP))
+    assert resent["tag"] == tag
+    assert resent["seq"] == 1
+    assert resent["offset"] == frags[1]["offset"]
+    assert resent["ack_req"]
+    node.send(ack(tag, FULL_BITMAP))
+    node.child.expect(r"\d+ packets transmitted")
+
+
+def test_reassembly(node):
+    tag = 0x42
+    payload = bytes(range(200))
+    datagram = bytes([SIXLOWPAN_UNCOMP]) + raw(
+        IPv6(src=Node.ll_addr(node.peer), dst=Node.ll_addr(node.addr)) /
+        UDP(sport=TEST_PORT, dport=TEST_PORT) /
+        payload
+    )
+    frag_size = 64
+    chunks = [datagram[i:i + frag_size]
+              for i in range(0, len(datagram), frag_size)]
+    # leave out the third fragment
+    for seq, chunk in enumerate(chunks):
+        if seq == 2:
+            continue
+        offset = len(datagram) if seq == 0 else seq * frag_size
+        node.send(rfrag(tag, seq, offset, chunk,
+                        ack_req=(seq == (len(chunks) - 1))))
+    ack_tag, bitmap = parse_ack(node.recv_sfr(SFR_ACK_DISP))
+    assert ack_tag == tag
+    expected = 0
+    for seq in range(len(chunks)):
+        if seq != 2:
+            expected |= 0x80000000 >> seq
+    assert bitmap == expected, "{:08x} != {:08x}".format(bitmap, expected)
+    # fill the gap
+    node.send(rfrag(tag, 2, 2 * frag_size, chunks[2], ack_req=True))
+    ack_tag, bitmap = parse_ack(node.recv_sfr(SFR_ACK_DISP))
+    assert ack_tag == tag
+    assert bitmap == FULL_BITMAP
+    node.child.expect("PKTDUMP: data received:")
+    node.child.expect(r"~~ SNIP  0 - size: 200 byte, type: NETTYPE_UNDEF")
+
+
+def testfunc(child):
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        s.bind(("", 17754))
+        s.settimeout(5)
+        node = Node(child, s)
+        test_selective_resend(node)
+        test_reassembly(node)
+        print("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=5))
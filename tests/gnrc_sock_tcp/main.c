@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for zero-copy receive of the GNRC sock_tcp backend
+ *
+ * A server thread accepts the connection of the main thread over the IPv6
+ * loopback address and sends with gnrc_tcp_send_pkt().
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define SERVER_PORT         (0x2c94)
+#define MSG_QUEUE_SIZE      (4)
+/* time for segments to travel the loopback */
+#define SETTLE_MS           (10U)
+
+enum {
+    _SERVER_MSG_ACCEPT = 0xe300,
+    _SERVER_MSG_WRITE,
+    _SERVER_MSG_CLOSE,
+    _SERVER_MSG_ABORT,
+    _SERVER_MSG_SYNC,
+};
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _server_msg_queue[MSG_QUEUE_SIZE];
+static kernel_pid_t _server;
+static sock_tcp_queue_t _queue;
+static sock_tcp_t _queue_array[1];
+static sock_tcp_t _sock;
+
+static void _server_write(sock_tcp_t *sock, const char *str)
+{
+    size_t len = strlen(str);
+    /* split into two snips to cover segments that must not span snips */
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, str + len / 2, len - len / 2,
+                                          GNRC_NETTYPE_UNDEF);
+
+    pkt = gnrc_pktbuf_add(pkt, str, len / 2, GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    expect((ssize_t)len == gnrc_tcp_send_pkt(&sock->tcb, pkt, 0));
+}
+
+static void *_server_func(void *arg)
+{
+    sock_tcp_t *sock = NULL;
+
+    (void)arg;
+    msg_init_queue(_server_msg_queue, MSG_QUEUE_SIZE);
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        switch (msg.type) {
+            case _SERVER_MSG_ACCEPT:
+                expect(0 == sock_tcp_accept(&_queue, &sock, SOCK_NO_TIMEOUT));
+                break;
+            case _SERVER_MSG_WRITE:
+                _server_write(sock, msg.content.ptr);
+                break;
+            case _SERVER_MSG_ABORT:
+                if (sock != NULL) {
+                    /* sends a RST */
+                    gnrc_tcp_abort(&sock->tcb);
+                }
+                /* fall through */
+            case _SERVER_MSG_CLOSE:
+                if (sock != NULL) {
+                    sock_tcp_disconnect(sock);
+                    sock = NULL;
+                }
+                break;
+            case _SERVER_MSG_SYNC:
+                msg_reply(&msg, &msg);
+                break;
+        }
+    }
+    return NULL;
+}
+
+static void _server_msg(uint16_t type, const char *str)
+{
+    msg_t msg = { .type = type, .content.ptr = (void *)str };
+
+    msg_send(&msg, _server);
+}
+
+static void _server_write_settle(const char *str)
+{
+    _server_msg(_SERVER_MSG_WRITE, str);
+    /* let all segments arrive */
+    ztimer_sleep(ZTIMER_MSEC, SETTLE_MS);
+}
+
+static void set_up(void)
+{
+    sock_tcp_ep_t remote = { .family = AF_INET6, .port = SERVER_PORT };
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    _server_msg(_SERVER_MSG_ACCEPT, NULL);
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_connect(&_sock, &remote, 0, 0));
+}
+
+static void tear_down(void)
+{
+    msg_t msg = { .type = _SERVER_MSG_SYNC };
+
+    /* both sides close concurrently, the server waits for TIME_WAIT */
+    _server_msg(_SERVER_MSG_CLOSE, NULL);
+    sock_tcp_disconnect(&_sock);
+    msg_send_receive(&msg, &msg, _server);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_sock_tcp_read_buf__partial(void)
+{
+    static const char data[] = "0123456789abcdefghij";
+    char buf[4];
+    void *ptr, *ctx = NULL;
+
+    _server_write_settle(data);
+    /* the rest of a partial sock_tcp_read() is handed out in place */
+    TEST_ASSERT_EQUAL_INT(sizeof(buf), sock_tcp_read(&_sock, buf, sizeof(buf),
+                                                     0));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(strlen(data) - sizeof(buf),
+                          sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                            SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + sizeof(buf), ptr,
+                                    strlen(data) - sizeof(buf)));
+    /* releasing the buffer context leaves nothing to read */
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NULL(ctx);
+    TEST_ASSERT_EQUAL_INT(-EAGAIN, sock_tcp_read_buf(&_sock, &ptr, &ctx, 0));
+    TEST_ASSERT_NULL(ctx);
+}
+
+static void test_sock_tcp_read_buf__receive_while_held(void)
+{
+    void *ptr, *ctx = NULL;
+
+    _server_write_settle("Hello");
+    TEST_ASSERT_EQUAL_INT(5, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("Hello", ptr, 5));
+    _server_write_settle("World");
+    /* the held data is untouched by the data received meanwhile */
+    TEST_ASSERT_EQUAL_INT(0, memcmp("Hello", ptr, 5));
+    /* releasing it hands out the data received meanwhile without blocking */
+    TEST_ASSERT_EQUAL_INT(5, sock_tcp_read_buf(&_sock, &ptr, &ctx, 0));
+    TEST_ASSERT_NOT_NULL(ctx);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("World", ptr, 5));
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_read_buf(&_sock, &ptr, &ctx, 0));
+    TEST_ASSERT_NULL(ctx);
+}
+
+static void test_sock_tcp_read_buf__eof_while_held(void)
+{
+    void *ptr, *ctx = NULL;
+
+    _server_write_settle("Hello");
+    TEST_ASSERT_EQUAL_INT(5, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    _server_msg(_SERVER_MSG_CLOSE, NULL);
+    ztimer_sleep(ZTIMER_MSEC, SETTLE_MS);
+    TEST_ASSERT_EQUAL_INT(0, memcmp("Hello", ptr, 5));
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NULL(ctx);
+    /* end of stream is signaled without blocking */
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NULL(ctx);
+}
+
+static void test_sock_tcp_read_buf__reset_while_held(void)
+{
+    void *ptr, *ctx = NULL;
+
+    _server_write_settle("Hello");
+    TEST_ASSERT_EQUAL_INT(5, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    _server_msg(_SERVER_MSG_ABORT, NULL);
+    ztimer_sleep(ZTIMER_MSEC, SETTLE_MS);
+    /* the reset frees the receive buffer, releasing the context must still
+     * be possible */
+    TEST_ASSERT_EQUAL_INT(0, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                               SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NULL(ctx);
+    TEST_ASSERT_EQUAL_INT(-ENOTCONN, sock_tcp_read_buf(&_sock, &ptr, &ctx,
+                                                       SOCK_NO_TIMEOUT));
+    TEST_ASSERT_NULL(ctx);
+}
+
+static Test *tests_sock_tcp_read_buf(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sock_tcp_read_buf__partial),
+        new_TestFixture(test_sock_tcp_read_buf__receive_while_held),
+        new_TestFixture(test_sock_tcp_read_buf__eof_while_held),
+        new_TestFixture(test_sock_tcp_read_buf__reset_while_held),
+    };
+
+    EMB_UNIT_TESTCALLER(sock_tcp_read_buf_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&sock_tcp_read_buf_tests;
+}
+
+int main(void)
+{
+    sock_tcp_ep_t local = { .family = AF_INET6, .port = SERVER_PORT };
+
+    sock_tcp_listen(&_queue, &local, _queue_array, ARRAY_SIZE(_queue_array),
+                    0);
+    _server = thread_create(_server_stack, sizeof(_server_stack),
+                            THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                            _server_func, NULL, "tcp_server");
+
+    TESTS_START();
+    TESTS_RUN(tests_sock_tcp_read_buf());
+    TESTS_END();
+    return 0;
+}
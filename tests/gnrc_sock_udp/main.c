@@ -448,6 +448,146 @@ static void test_sock_udp_recv_buf__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_many__EAGAIN(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6, .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = sizeof(_test_buffer) },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+}
+
+static void test_sock_udp_recv_many__truncated(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 2 },
+        { .data = &_test_buffer[2], .len = sizeof(_test_buffer) - 2 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    expect(1 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(2 == msgs[0].msg_len);
+    expect(SOCK_UDP_MSG_FLAG_TRUNC == msgs[0].flags);
+    expect(memcmp(msgs[0].data, "AB", 2) == 0);
+    expect(-EAGAIN == sock_udp_recv(&_sock, _test_buffer, sizeof(_test_buffer),
+                                    0, NULL));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__truncated_in_batch(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 8 },
+        { .data = &_test_buffer[8], .len = 2 },
+        { .data = &_test_buffer[10], .len = 8 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"), _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "IJ", sizeof("IJ"), _TEST_NETIF));
+    /* the second message is reported as truncated, the batch goes on */
+    expect(3 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(0 == msgs[0].flags);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(2 == msgs[1].msg_len);
+    expect(SOCK_UDP_MSG_FLAG_TRUNC == msgs[1].flags);
+    expect(memcmp(msgs[1].data, "EF", 2) == 0);
+    expect(sizeof("IJ") == msgs[2].msg_len);
+    expect(0 == msgs[2].flags);
+    expect(memcmp(msgs[2].data, "IJ", sizeof("IJ")) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__EPROTO_in_batch(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 32 },
+        { .data = &_test_buffer[32], .len = 32 },
+        { .data = &_test_buffer[64], .len = 32 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"), _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "GH", sizeof("GH"), _TEST_NETIF));
+    /* the message from the wrong remote port is skipped */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(sizeof("GH") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "GH", sizeof("GH")) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 32 },
+        { .data = &_test_buffer[32], .len = 32 },
+        { .data = &_test_buffer[64], .len = 32 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"), _TEST_NETIF));
+    /* the batch ends with the queued messages */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(AF_INET6 == msgs[0].remote.family);
+    expect(memcmp(&msgs[0].remote.addr, &src_addr,
+                  sizeof(msgs[0].remote.addr)) == 0);
+    expect(_TEST_PORT_REMOTE == msgs[0].remote.port);
+    expect(_TEST_NETIF == msgs[0].remote.netif);
+    expect(sizeof("EF") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EF", sizeof("EF")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == msgs[1].remote.port);
+    expect((0 == msgs[0].flags) && (0 == msgs[1].flags));
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -720,6 +860,50 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many__ENOTCONN(void)
+{
+    sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+    };
+
+    /* port 0 in the message and no remote of the sock */
+    expect(0 == sock_udp_create(&_sock, NULL, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-ENOTCONN == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_many__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        /* port 0: sent to the remote of the sock */
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EF", .len = sizeof("EF"), .remote = remote },
+    };
+
+    msgs[1].remote.port = _TEST_PORT_REMOTE + 1;
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(sizeof("EF") == msgs[1].msg_len);
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "EF", sizeof("EF"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -752,6 +936,11 @@ int main(void)
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__EAGAIN());
+    CALL(test_sock_udp_recv_many__truncated());
+    CALL(test_sock_udp_recv_many__truncated_in_batch());
+    CALL(test_sock_udp_recv_many__EPROTO_in_batch());
+    CALL(test_sock_udp_recv_many__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -769,6 +958,8 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_send_many__ENOTCONN());
+    CALL(test_sock_udp_send_many__socketed());
 
     puts("ALL TESTS SUCCESSFUL");
 
@@ -33,6 +33,11 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_recv__unsocketed_with_remote()")
     child.expect_exact(u"Calling test_sock_udp_recv__with_timeout()")
     child.expect_exact(u"Calling test_sock_udp_recv__non_blocking()")
+    child.expect_exact(u"Calling test_sock_udp_recv_many__EAGAIN()")
+    child.expect_exact(u"Calling test_sock_udp_recv_many__truncated()")
+    child.expect_exact(u"Calling test_sock_udp_recv_many__truncated_in_batch()")
+    child.expect_exact(u"Calling test_sock_udp_recv_many__EPROTO_in_batch()")
+    child.expect_exact(u"Calling test_sock_udp_recv_many__success()")
     child.expect_exact(u"Calling test_sock_udp_send__EAFNOSUPPORT()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_addr()")
     child.expect_exact(u"Calling test_sock_udp_send__EINVAL_netif()")
@@ -49,6 +54,8 @@ def testfunc(child):
     child.expect_exact(u"Calling test_sock_udp_send__unsocketed()")
     child.expect_exact(u"Calling test_sock_udp_send__no_sock_no_netif()")
     child.expect_exact(u"Calling test_sock_udp_send__no_sock()")
+    child.expect_exact(u"Calling test_sock_udp_send_many__ENOTCONN()")
+    child.expect_exact(u"Calling test_sock_udp_send_many__socketed()")
     child.expect_exact(u"ALL TESTS SUCCESSFUL")
 
 
@@ -12,6 +12,7 @@
 #include "shell.h"
 #include "msg.h"
 #include "net/af.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/tcp.h"
 
 #define MAIN_QUEUE_SIZE (8)
@@ -20,6 +21,8 @@
 static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
 static gnrc_tcp_tcb_t tcb;
 static char buffer[BUFFER_SIZE];
+static void *recv_buf_ctx;
+static size_t recv_buf_rcvd;
 
 void dump_args(int argc, char **argv)
 {
@@ -234,6 +237,59 @@ int gnrc_tcp_send_cmd(int argc, char **argv)
     return sent;
 }
 
+int gnrc_tcp_send_pkt_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    int timeout = atol(argv[1]);
+    size_t to_send = strlen(buffer);
+    size_t sent = 0;
+
+    while (sent < to_send) {
+        /* Split the remaining data into two snips to cover segments that
+         * must not span multiple snips */
+        size_t len = to_send - sent;
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, buffer + sent + len / 2,
+                                              len - len / 2,
+                                              GNRC_NETTYPE_UNDEF);
+        if ((pkt != NULL) && (len / 2 > 0)) {
+            gnrc_pktsnip_t *head = gnrc_pktbuf_add(pkt, buffer + sent, len / 2,
+                                                   GNRC_NETTYPE_UNDEF);
+            if (head == NULL) {
+                gnrc_pktbuf_release(pkt);
+            }
+            pkt = head;
+        }
+        if (pkt == NULL) {
+            printf("%s: returns -ENOMEM\n", argv[0]);
+            return -ENOMEM;
+        }
+
+        int ret = gnrc_tcp_send_pkt(&tcb, pkt, timeout);
+        switch (ret) {
+            case -ENOTCONN:
+                printf("%s: returns -ENOTCONN\n", argv[0]);
+                return ret;
+
+            case -ECONNRESET:
+                printf("%s: returns -ECONNRESET\n", argv[0]);
+                return ret;
+
+            case -ECONNABORTED:
+                printf("%s: returns -ECONNABORTED\n", argv[0]);
+                return ret;
+
+            case -ETIMEDOUT:
+                printf("%s: returns -ETIMEDOUT\n", argv[0]);
+                return ret;
+        }
+        sent += ret;
+    }
+
+    printf("%s: sent %u\n", argv[0], (unsigned)sent);
+    return sent;
+}
+
 int gnrc_tcp_recv_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -277,6 +333,50 @@ int gnrc_tcp_recv_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_recv_buf_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    /* Each call releases the data handed out by the previous one. The
+     * received data is appended to the internal buffer */
+    int timeout = atol(argv[1]);
+    void *data;
+
+    if (recv_buf_ctx == NULL) {
+        recv_buf_rcvd = 0;
+    }
+    int ret = gnrc_tcp_recv_buf(&tcb, &data, &recv_buf_ctx, timeout);
+    switch (ret) {
+        case -EAGAIN:
+            printf("%s: returns -EAGAIN\n", argv[0]);
+            return ret;
+
+        case -ETIMEDOUT:
+            printf("%s: returns -ETIMEDOUT\n", argv[0]);
+            return ret;
+
+        case -ENOTCONN:
+            printf("%s: returns -ENOTCONN\n", argv[0]);
+            return ret;
+
+        case -ECONNRESET:
+            printf("%s: returns -ECONNRESET\n", argv[0]);
+            return ret;
+
+        case -ECONNABORTED:
+            printf("%s: returns -ECONNABORTED\n", argv[0]);
+            return ret;
+    }
+    if (recv_buf_rcvd + ret < BUFFER_SIZE) {
+        memcpy(buffer + recv_buf_rcvd, data, ret);
+    }
+    recv_buf_rcvd += ret;
+
+    printf("%s: returns %d, held %s\n", argv[0], ret,
+           (recv_buf_ctx != NULL) ? "yes" : "no");
+    return 0;
+}
+
 int gnrc_tcp_close_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -302,8 +402,12 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_open_passive_cmd },
     { "gnrc_tcp_send", "gnrc_tcp: send data to connected peer",
       gnrc_tcp_send_cmd },
+    { "gnrc_tcp_send_pkt", "gnrc_tcp: send data to connected peer without copy",
+      gnrc_tcp_send_pkt_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
       gnrc_tcp_recv_cmd },
+    { "gnrc_tcp_recv_buf", "gnrc_tcp: recv data from connected peer without copy",
+      gnrc_tcp_recv_buf_cmd },
     { "gnrc_tcp_close", "gnrc_tcp: close connection gracefully",
       gnrc_tcp_close_cmd },
     { "gnrc_tcp_abort", "gnrc_tcp: close connection forcefully",
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import threading
+import time
+
+from testrunner import run
+from shared_func import TcpServer, generate_port_number, get_host_tap_device, \
+                        get_host_ll_addr, get_riot_if_id, setup_internal_buffer, \
+                        read_data_from_internal_buffer, verify_pktbuf_empty, \
+                        sudo_guard
+
+
+def tcp_server(port, shutdown_event, send_event, data):
+    with TcpServer(port, shutdown_event) as tcp_srv:
+        for chunk in data:
+            send_event.wait()
+            send_event.clear()
+            tcp_srv.send(chunk)
+
+
+def testfunc(child):
+    port = generate_port_number()
+    shutdown_event = threading.Event()
+    send_event = threading.Event()
+
+    # Receive two chunks of 100 bytes each, the second one arrives while
+    # the first one is still held by the application.
+    data = ['0123456789' * 10, 'abcdefghij' * 10]
+    data_len = len(data[0]) + len(data[1])
+
+    # Verify that RIOT Applications internal buffer can hold test data.
+    assert setup_internal_buffer(child) >= data_len
+
+    server_handle = threading.Thread(target=tcp_server,
+                                     args=(port, shutdown_event, send_event, data))
+    server_handle.start()
+
+    target_addr = get_host_ll_addr(get_host_tap_device()) + '%' + get_riot_if_id(child)
+
+    # Setup RIOT Node to connect to Hostsystems TCP Server
+    child.sendline('gnrc_tcp_tcb_init')
+    child.sendline('gnrc_tcp_open_active [{}]:{} 0'.format(target_addr, str(port)))
+    child.expect_exact('gnrc_tcp_open_active: returns 0')
+
+    # Hold the first chunk and let the second one arrive
+    send_event.set()
+    child.sendline('gnrc_tcp_recv_buf 1000000')
+    child.expect_exact('gnrc_tcp_recv_buf: returns {}, held yes'.format(len(data[0])))
+    send_event.set()
+    time.sleep(1)
+
+    # Releasing the first chunk hands out the second one without blocking
+    child.sendline('gnrc_tcp_recv_buf 0')
+    child.expect_exact('gnrc_tcp_recv_buf: returns {}, held yes'.format(len(data[1])))
+
+    # Releasing the second chunk leaves nothing held
+    child.sendline('gnrc_tcp_recv_buf 0')
+    child.expect_exact('gnrc_tcp_recv_buf: returns 0, held no')
+
+    # Nothing more to read
+    child.sendline('gnrc_tcp_recv_buf 0')
+    child.expect_exact('gnrc_tcp_recv_buf: returns -EAGAIN')
+
+    # Close connection and verify that pktbuf is cleared
+    shutdown_event.set()
+    child.sendline('gnrc_tcp_close')
+    server_handle.join()
+
+    verify_pktbuf_empty(child)
+
+    # Verify received Data
+    assert read_data_from_internal_buffer(child, data_len) == data[0] + data[1]
+
+    print(os.path.basename(sys.argv[0]) + ': success')
+
+
+if __name__ == '__main__':
+    sudo_guard()
+    sys.exit(run(testfunc, timeout=5, echo=False, traceback=True))
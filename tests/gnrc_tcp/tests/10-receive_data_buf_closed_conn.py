@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import struct
+import sys
+import threading
+import time
+
+from testrunner import run
+from shared_func import TcpServer, generate_port_number, get_host_tap_device, \
+                        get_host_ll_addr, get_riot_if_id, setup_internal_buffer, \
+                        verify_pktbuf_empty, sudo_guard
+
+
+def tcp_server(port, shutdown_event, reset, data):
+    with TcpServer(port, shutdown_event) as tcp_srv:
+        tcp_srv.send(data)
+        if reset:
+            # Close with RST instead of FIN
+            tcp_srv.conn.setsockopt(socket.SOL_SOCKET, socket.SO_LINGER,
+                                    struct.pack('ii', 1, 0))
+
+
+def close_while_held(child, reset):
+    port = generate_port_number()
+    shutdown_event = threading.Event()
+    data = '0123456789' * 10
+
+    # Verify that RIOT Applications internal buffer can hold test data.
+    assert setup_internal_buffer(child) >= len(data)
+
+    server_handle = threading.Thread(target=tcp_server,
+                                     args=(port, shutdown_event, reset, data))
+    server_handle.start()
+
+    target_addr = get_host_ll_addr(get_host_tap_device()) + '%' + get_riot_if_id(child)
+
+    # Setup RIOT Node to connect to Hostsystems TCP Server
+    child.sendline('gnrc_tcp_tcb_init')
+    child.sendline('gnrc_tcp_open_active [{}]:{} 0'.format(target_addr, str(port)))
+    child.expect_exact('gnrc_tcp_open_active: returns 0')
+
+    # Hold the received data while the peer closes the connection
+    child.sendline('gnrc_tcp_recv_buf 1000000')
+    child.expect_exact('gnrc_tcp_recv_buf: returns {}, held yes'.format(len(data)))
+    shutdown_event.set()
+    server_handle.join()
+    time.sleep(1)
+
+    # Releasing the held data must work after the connection was closed
+    child.sendline('gnrc_tcp_recv_buf 0')
+    child.expect_exact('gnrc_tcp_recv_buf: returns 0, held no')
+
+    # Further reads return immediately despite any given timeout
+    child.sendline('gnrc_tcp_recv_buf 1000000')
+    if reset:
+        child.expect_exact('gnrc_tcp_recv_buf: returns -ENOTCONN')
+    else:
+        child.expect_exact('gnrc_tcp_recv_buf: returns 0, held no')
+
+    child.sendline('gnrc_tcp_close')
+    child.expect_exact('gnrc_tcp_close: argc=1')
+    verify_pktbuf_empty(child)
+
+
+def testfunc(child):
+    # Peer closes gracefully (FIN) while data is held
+    close_while_held(child, reset=False)
+
+    # Peer resets the connection (RST) while data is held
+    close_while_held(child, reset=True)
+
+    print(os.path.basename(sys.argv[0]) + ': success')
+
+
+if __name__ == '__main__':
+    sudo_guard()
+    sys.exit(run(testfunc, timeout=5, echo=False, traceback=True))
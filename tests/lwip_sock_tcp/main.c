@@ -483,6 +483,83 @@ static void test_tcp_read4__success_non_blocking(void)
     expect(memcmp(exp_data.iov_base, _test_buffer, exp_data.iov_len) == 0);
 }
 
+static void test_tcp_read_buf4__success_partial(void)
+{
+    static const sock_tcp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
+                                          .family = AF_INET,
+                                          .port = _TEST_PORT_REMOTE,
+                                          .netif = SOCK_ADDR_ANY_NETIF };
+    msg_t msg = { .type = _SERVER_MSG_START };
+    static const struct iovec exp_data = { .iov_base = "Hello!",
+                                           .iov_len = sizeof("Hello!") };
+    void *data = NULL, *ctx = NULL;
+
+    _server_addr.family = AF_INET;
+    _server_addr.port = _TEST_PORT_REMOTE;
+    _server_addr.netif = SOCK_ADDR_ANY_NETIF;
+
+    msg_send(&msg, _server);        /* start server on _TEST_PORT_LOCAL */
+    msg.type = _SERVER_MSG_ACCEPT;
+    msg_send(&msg, _server);        /* let server accept */
+
+    expect(0 == sock_tcp_connect(&_sock, &remote, 0, SOCK_FLAGS_REUSE_EP));
+    msg.type = _SERVER_MSG_WRITE;
+    msg.content.ptr = (void *)&exp_data;
+    msg_send(&msg, _server);        /* write expected data at server */
+    /* the rest of a partial sock_tcp_read() is handed out in place */
+    expect(2 == sock_tcp_read(&_sock, _test_buffer, 2, SOCK_NO_TIMEOUT));
+    expect(((ssize_t)exp_data.iov_len - 2) == sock_tcp_read_buf(&_sock, &data,
+                                                                &ctx,
+                                                                SOCK_NO_TIMEOUT));
+    expect(ctx != NULL);
+    expect(memcmp((char *)exp_data.iov_base + 2, data,
+                  exp_data.iov_len - 2) == 0);
+    /* releasing the buffer context leaves nothing to read */
+    expect(0 == sock_tcp_read_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+    expect(-EAGAIN == sock_tcp_read_buf(&_sock, &data, &ctx, 0));
+    expect(ctx == NULL);
+}
+
+static void test_tcp_read_buf4__ECONNRESET_while_held(void)
+{
+    static const sock_tcp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
+                                          .family = AF_INET,
+                                          .port = _TEST_PORT_REMOTE,
+                                          .netif = SOCK_ADDR_ANY_NETIF };
+    msg_t msg = { .type = _SERVER_MSG_START };
+    static const struct iovec exp_data = { .iov_base = "Hello!",
+                                           .iov_len = sizeof("Hello!") };
+    void *data = NULL, *ctx = NULL;
+
+    _server_addr.family = AF_INET;
+    _server_addr.port = _TEST_PORT_REMOTE;
+    _server_addr.netif = SOCK_ADDR_ANY_NETIF;
+
+    msg_send(&msg, _server);        /* start server on _TEST_PORT_LOCAL */
+    msg.type = _SERVER_MSG_ACCEPT;
+    msg_send(&msg, _server);        /* let server accept */
+
+    expect(0 == sock_tcp_connect(&_sock, &remote, 0, SOCK_FLAGS_REUSE_EP));
+    msg.type = _SERVER_MSG_WRITE;
+    msg.content.ptr = (void *)&exp_data;
+    msg_send(&msg, _server);        /* write expected data at server */
+    expect(((ssize_t)exp_data.iov_len) == sock_tcp_read_buf(&_sock, &data,
+                                                            &ctx,
+                                                            SOCK_NO_TIMEOUT));
+    expect(ctx != NULL);
+    expect(memcmp(exp_data.iov_base, data, exp_data.iov_len) == 0);
+    msg.type = _SERVER_MSG_CLOSE;
+    msg_send(&msg, _server);        /* close connection while data is held */
+    /* the held data is still accessible and can be released */
+    expect(memcmp(exp_data.iov_base, data, exp_data.iov_len) == 0);
+    expect(0 == sock_tcp_read_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+    expect(-ECONNRESET == sock_tcp_read_buf(&_sock, &data, &ctx,
+                                            SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+}
+
 /* ENOTCONN not applicable since lwIP always tries to send */
 
 static void test_tcp_write4__ENOTCONN(void)
@@ -915,6 +992,83 @@ static void test_tcp_read6__success_non_blocking(void)
     expect(memcmp(exp_data.iov_base, _test_buffer, exp_data.iov_len) == 0);
 }
 
+static void test_tcp_read_buf6__success_partial(void)
+{
+    static const sock_tcp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE,
+                                          .netif = SOCK_ADDR_ANY_NETIF };
+    msg_t msg = { .type = _SERVER_MSG_START };
+    static const struct iovec exp_data = { .iov_base = "Hello!",
+                                           .iov_len = sizeof("Hello!") };
+    void *data = NULL, *ctx = NULL;
+
+    _server_addr.family = AF_INET6;
+    _server_addr.port = _TEST_PORT_REMOTE;
+    _server_addr.netif = SOCK_ADDR_ANY_NETIF;
+
+    msg_send(&msg, _server);        /* start server on _TEST_PORT_LOCAL */
+    msg.type = _SERVER_MSG_ACCEPT;
+    msg_send(&msg, _server);        /* let server accept */
+
+    expect(0 == sock_tcp_connect(&_sock, &remote, 0, SOCK_FLAGS_REUSE_EP));
+    msg.type = _SERVER_MSG_WRITE;
+    msg.content.ptr = (void *)&exp_data;
+    msg_send(&msg, _server);        /* write expected data at server */
+    /* the rest of a partial sock_tcp_read() is handed out in place */
+    expect(2 == sock_tcp_read(&_sock, _test_buffer, 2, SOCK_NO_TIMEOUT));
+    expect(((ssize_t)exp_data.iov_len - 2) == sock_tcp_read_buf(&_sock, &data,
+                                                                &ctx,
+                                                                SOCK_NO_TIMEOUT));
+    expect(ctx != NULL);
+    expect(memcmp((char *)exp_data.iov_base + 2, data,
+                  exp_data.iov_len - 2) == 0);
+    /* releasing the buffer context leaves nothing to read */
+    expect(0 == sock_tcp_read_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+    expect(-EAGAIN == sock_tcp_read_buf(&_sock, &data, &ctx, 0));
+    expect(ctx == NULL);
+}
+
+static void test_tcp_read_buf6__ECONNRESET_while_held(void)
+{
+    static const sock_tcp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE,
+                                          .netif = SOCK_ADDR_ANY_NETIF };
+    msg_t msg = { .type = _SERVER_MSG_START };
+    static const struct iovec exp_data = { .iov_base = "Hello!",
+                                           .iov_len = sizeof("Hello!") };
+    void *data = NULL, *ctx = NULL;
+
+    _server_addr.family = AF_INET6;
+    _server_addr.port = _TEST_PORT_REMOTE;
+    _server_addr.netif = SOCK_ADDR_ANY_NETIF;
+
+    msg_send(&msg, _server);        /* start server on _TEST_PORT_LOCAL */
+    msg.type = _SERVER_MSG_ACCEPT;
+    msg_send(&msg, _server);        /* let server accept */
+
+    expect(0 == sock_tcp_connect(&_sock, &remote, 0, SOCK_FLAGS_REUSE_EP));
+    msg.type = _SERVER_MSG_WRITE;
+    msg.content.ptr = (void *)&exp_data;
+    msg_send(&msg, _server);        /* write expected data at server */
+    expect(((ssize_t)exp_data.iov_len) == sock_tcp_read_buf(&_sock, &data,
+                                                            &ctx,
+                                                            SOCK_NO_TIMEOUT));
+    expect(ctx != NULL);
+    expect(memcmp(exp_data.iov_base, data, exp_data.iov_len) == 0);
+    msg.type = _SERVER_MSG_CLOSE;
+    msg_send(&msg, _server);        /* close connection while data is held */
+    /* the held data is still accessible and can be released */
+    expect(memcmp(exp_data.iov_base, data, exp_data.iov_len) == 0);
+    expect(0 == sock_tcp_read_buf(&_sock, &data, &ctx, SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+    expect(-ECONNRESET == sock_tcp_read_buf(&_sock, &data, &ctx,
+                                            SOCK_NO_TIMEOUT));
+    expect(ctx == NULL);
+}
+
 /* ENOTCONN not applicable since lwIP always tries to send */
 
 static void test_tcp_write6__ENOTCONN(void)
@@ -1011,6 +1165,8 @@ int main(void)
     CALL(test_tcp_read4__success());
     CALL(test_tcp_read4__success_with_timeout());
     CALL(test_tcp_read4__success_non_blocking());
+    CALL(test_tcp_read_buf4__success_partial());
+    CALL(test_tcp_read_buf4__ECONNRESET_while_held());
     /* ECONNABORTED can't be tested in this setup */
     /* ENOTCONN not applicable since lwIP always tries to send */
     CALL(test_tcp_write4__ENOTCONN());
@@ -1054,6 +1210,8 @@ int main(void)
     CALL(test_tcp_read6__success());
     CALL(test_tcp_read6__success_with_timeout());
     CALL(test_tcp_read6__success_non_blocking());
+    CALL(test_tcp_read_buf6__success_partial());
+    CALL(test_tcp_read_buf6__ECONNRESET_while_held());
     /* ECONNABORTED can't be tested in this setup */
     /* ENOTCONN not applicable since lwIP always tries to send */
     CALL(test_tcp_write6__ENOTCONN());
@@ -417,6 +417,74 @@ static void test_sock_udp_recv_buf4__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_many4__truncated_in_batch(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 8 },
+        { .data = &_test_buffer[8], .len = 2 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_4packet(_TEST_ADDR4_REMOTE, _TEST_ADDR4_LOCAL,
+                           _TEST_PORT_REMOTE, _TEST_PORT_LOCAL,
+                           "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    expect(_inject_4packet(_TEST_ADDR4_REMOTE, _TEST_ADDR4_LOCAL,
+                           _TEST_PORT_REMOTE, _TEST_PORT_LOCAL,
+                           "EFGH", sizeof("EFGH"), _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    /* the second message does not fit and is reported as truncated */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(0 == msgs[0].flags);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(2 == msgs[1].msg_len);
+    expect(SOCK_UDP_MSG_FLAG_TRUNC == msgs[1].flags);
+    expect(memcmp(msgs[1].data, "EF", 2) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many4__success(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 32 },
+        { .data = &_test_buffer[32], .len = 32 },
+        { .data = &_test_buffer[64], .len = 32 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_4packet(_TEST_ADDR4_REMOTE, _TEST_ADDR4_LOCAL,
+                           _TEST_PORT_REMOTE, _TEST_PORT_LOCAL,
+                           "ABCD", sizeof("ABCD"), _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    expect(_inject_4packet(_TEST_ADDR4_REMOTE, _TEST_ADDR4_LOCAL,
+                           _TEST_PORT_REMOTE + 1, _TEST_PORT_LOCAL,
+                           "EF", sizeof("EF"), _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    /* the batch ends with the queued messages */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(AF_INET == msgs[0].remote.family);
+    expect(_TEST_ADDR4_REMOTE == msgs[0].remote.addr.ipv4_u32);
+    expect(_TEST_PORT_REMOTE == msgs[0].remote.port);
+#if LWIP_NETBUF_RECVINFO
+    expect(_TEST_NETIF == msgs[0].remote.netif);
+#endif
+    expect(sizeof("EF") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EF", sizeof("EF")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == msgs[1].remote.port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send4__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
@@ -681,6 +749,46 @@ static void test_sock_udp_send4__no_sock(void)
     xtimer_usleep(1000);    /* let lwIP stack finish */
     expect(_check_net());
 }
+
+static void test_sock_udp_send_many4__ENOTCONN(void)
+{
+    sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+    };
+
+    /* port 0 in the message and no remote of the sock */
+    expect(0 == sock_udp_create(&_sock, NULL, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-ENOTCONN == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_many4__socketed(void)
+{
+    static const sock_udp_ep_t local = { .addr = { .ipv4_u32 = _TEST_ADDR4_LOCAL },
+                                         .family = AF_INET,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv4_u32 = _TEST_ADDR4_REMOTE },
+                                          .family = AF_INET,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        /* port 0: sent to the remote of the sock */
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EF", .len = sizeof("EF"), .remote = remote },
+    };
+
+    msgs[1].remote.port = _TEST_PORT_REMOTE + 1;
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(sizeof("EF") == msgs[1].msg_len);
+    /* the test device only keeps the last packet sent */
+    expect(_check_4packet(_TEST_ADDR4_LOCAL, _TEST_ADDR4_REMOTE,
+                          _TEST_PORT_LOCAL, _TEST_PORT_REMOTE + 1,
+                          "EF", sizeof("EF"), _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let lwIP stack finish */
+    expect(_check_net());
+}
 #endif /* MODULE_LWIP_IPV4 */
 
 #ifdef MODULE_LWIP_IPV6
@@ -1082,6 +1190,79 @@ static void test_sock_udp_recv_buf6__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_many6__truncated_in_batch(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 8 },
+        { .data = &_test_buffer[8], .len = 2 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                           _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    /* the second message does not fit and is reported as truncated */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(0 == msgs[0].flags);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(2 == msgs[1].msg_len);
+    expect(SOCK_UDP_MSG_FLAG_TRUNC == msgs[1].flags);
+    expect(memcmp(msgs[1].data, "EF", 2) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many6__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 32 },
+        { .data = &_test_buffer[32], .len = 32 },
+        { .data = &_test_buffer[64], .len = 32 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                           _TEST_PORT_LOCAL, "EF", sizeof("EF"),
+                           _TEST_NETIF));
+    xtimer_usleep(1000);    /* let lwIP stack queue the packet */
+    /* the batch ends with the queued messages */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(AF_INET6 == msgs[0].remote.family);
+    expect(memcmp(&msgs[0].remote.addr, &src_addr,
+                  sizeof(msgs[0].remote.addr)) == 0);
+    expect(_TEST_PORT_REMOTE == msgs[0].remote.port);
+#if LWIP_NETBUF_RECVINFO
+    expect(_TEST_NETIF == msgs[0].remote.netif);
+#endif
+    expect(sizeof("EF") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EF", sizeof("EF")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == msgs[1].remote.port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send6__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
@@ -1363,6 +1544,48 @@ static void test_sock_udp_send6__no_sock(void)
     xtimer_usleep(1000);    /* let lwIP stack finish */
     expect(_check_net());
 }
+
+static void test_sock_udp_send_many6__ENOTCONN(void)
+{
+    sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+    };
+
+    /* port 0 in the message and no remote of the sock */
+    expect(0 == sock_udp_create(&_sock, NULL, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-ENOTCONN == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_many6__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR6_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        /* port 0: sent to the remote of the sock */
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EF", .len = sizeof("EF"), .remote = remote },
+    };
+
+    msgs[1].remote.port = _TEST_PORT_REMOTE + 1;
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(sizeof("EF") == msgs[1].msg_len);
+    /* the test device only keeps the last packet sent */
+    expect(_check_6packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                          _TEST_PORT_REMOTE + 1, "EF", sizeof("EF"),
+                          _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let lwIP stack finish */
+    expect(_check_net());
+}
 #endif /* MODULE_LWIP_IPV6 */
 
 int main(void)
@@ -1410,6 +1633,8 @@ int main(void)
     CALL(test_sock_udp_recv4__with_timeout());
     CALL(test_sock_udp_recv4__non_blocking());
     CALL(test_sock_udp_recv_buf4__success());
+    CALL(test_sock_udp_recv_many4__truncated_in_batch());
+    CALL(test_sock_udp_recv_many4__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send4__EAFNOSUPPORT());
     CALL(test_sock_udp_send4__EINVAL_addr());
@@ -1428,6 +1653,8 @@ int main(void)
     CALL(test_sock_udp_send4__unsocketed());
     CALL(test_sock_udp_send4__no_sock_no_netif());
     CALL(test_sock_udp_send4__no_sock());
+    CALL(test_sock_udp_send_many4__ENOTCONN());
+    CALL(test_sock_udp_send_many4__socketed());
 #endif /* MODULE_LWIP_IPV4 */
 #ifdef MODULE_LWIP_IPV6
 #ifdef SO_REUSE
@@ -1458,6 +1685,8 @@ int main(void)
     CALL(test_sock_udp_recv6__with_timeout());
     CALL(test_sock_udp_recv6__non_blocking());
     CALL(test_sock_udp_recv_buf6__success());
+    CALL(test_sock_udp_recv_many6__truncated_in_batch());
+    CALL(test_sock_udp_recv_many6__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send6__EAFNOSUPPORT());
     CALL(test_sock_udp_send6__EINVAL_addr());
@@ -1476,6 +1705,8 @@ int main(void)
     CALL(test_sock_udp_send6__unsocketed());
     CALL(test_sock_udp_send6__no_sock_no_netif());
     CALL(test_sock_udp_send6__no_sock());
+    CALL(test_sock_udp_send_many6__ENOTCONN());
+    CALL(test_sock_udp_send_many6__socketed());
 #endif /* MODULE_LWIP_IPV6 */
 
     puts("ALL TESTS SUCCESSFUL");
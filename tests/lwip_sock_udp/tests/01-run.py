@@ -48,6 +48,8 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_recv4__unsocketed_with_remote()")
         child.expect_exact(u"Calling test_sock_udp_recv4__with_timeout()")
         child.expect_exact(u"Calling test_sock_udp_recv4__non_blocking()")
+        child.expect_exact(u"Calling test_sock_udp_recv_many4__truncated_in_batch()")
+        child.expect_exact(u"Calling test_sock_udp_recv_many4__success()")
         child.expect_exact(u"Calling test_sock_udp_send4__EAFNOSUPPORT()")
         child.expect_exact(u"Calling test_sock_udp_send4__EINVAL_addr()")
         child.expect_exact(u"Calling test_sock_udp_send4__EINVAL_netif()")
@@ -65,6 +67,8 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_send4__unsocketed()")
         child.expect_exact(u"Calling test_sock_udp_send4__no_sock_no_netif()")
         child.expect_exact(u"Calling test_sock_udp_send4__no_sock()")
+        child.expect_exact(u"Calling test_sock_udp_send_many4__ENOTCONN()")
+        child.expect_exact(u"Calling test_sock_udp_send_many4__socketed()")
     if _ipv6_tests(code):
         if _reuse_tests(code):
             child.expect_exact(u"Calling test_sock_udp_create6__EADDRINUSE()")
@@ -88,6 +92,8 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_recv6__unsocketed_with_remote()")
         child.expect_exact(u"Calling test_sock_udp_recv6__with_timeout()")
         child.expect_exact(u"Calling test_sock_udp_recv6__non_blocking()")
+        child.expect_exact(u"Calling test_sock_udp_recv_many6__truncated_in_batch()")
+        child.expect_exact(u"Calling test_sock_udp_recv_many6__success()")
         child.expect_exact(u"Calling test_sock_udp_send6__EAFNOSUPPORT()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_addr()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_netif()")
@@ -105,6 +111,8 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_send6__unsocketed()")
         child.expect_exact(u"Calling test_sock_udp_send6__no_sock_no_netif()")
         child.expect_exact(u"Calling test_sock_udp_send6__no_sock()")
+        child.expect_exact(u"Calling test_sock_udp_send_many6__ENOTCONN()")
+        child.expect_exact(u"Calling test_sock_udp_send_many6__socketed()")
     child.expect_exact(u"ALL TESTS SUCCESSFUL")
 
 
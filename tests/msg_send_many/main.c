@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief Test application for msg_send_many() and msg_receive_many()
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define MSG_QUEUE_LENGTH                (4)
+#define MSG_NUMOF                       (6)
+
+static msg_t _main_queue[MSG_QUEUE_LENGTH];
+static msg_t _thread_queue[MSG_QUEUE_LENGTH];
+static char _stack[THREAD_STACKSIZE_MAIN];
+static kernel_pid_t _main_pid;
+static unsigned _received;
+static int _failed;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t msges[MSG_NUMOF];
+    unsigned expected = 0;
+
+    msg_init_queue(_thread_queue, MSG_QUEUE_LENGTH);
+
+    while (expected < 1 + MSG_QUEUE_LENGTH) {
+        int res = msg_receive_many(msges, MSG_NUMOF);
+
+        for (int idx = 0; idx < res; ++idx) {
+            if ((msges[idx].type != expected++) ||
+                (msges[idx].sender_pid != _main_pid)) {
+                _failed = 1;
+            }
+        }
+        _received += res;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t msges[MSG_NUMOF];
+    int res;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, MSG_QUEUE_LENGTH);
+
+    puts("[START]");
+
+    for (int idx = 0; idx < MSG_NUMOF; ++idx) {
+        msges[idx].type = idx;
+    }
+
+    /* only as many messages as fit into the own queue are sent */
+    res = msg_send_many(msges, MSG_NUMOF, thread_getpid());
+    printf("sent %d messages to self\n", res);
+    if ((res != MSG_QUEUE_LENGTH) || (msg_avail() != MSG_QUEUE_LENGTH)) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    msg_t recvd[MSG_NUMOF];
+
+    res = msg_receive_many(recvd, MSG_NUMOF);
+    printf("received %d messages\n", res);
+    if ((res != MSG_QUEUE_LENGTH) || (msg_avail() != 0)) {
+        puts("[FAILED]");
+        return 1;
+    }
+    for (int idx = 0; idx < res; ++idx) {
+        if (recvd[idx].type != idx) {
+            puts("[FAILED]");
+            return 1;
+        }
+    }
+
+    /* the receiver is waiting, so it gets the first message directly and the
+     * following ones fill its queue */
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _receiver, NULL, "receiver");
+    res = msg_send_many(msges, MSG_NUMOF, pid);
+    printf("sent %d messages to receiver, %u received\n", res, _received);
+    if ((res != 1 + MSG_QUEUE_LENGTH) || (_received != (unsigned)res) ||
+        _failed) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
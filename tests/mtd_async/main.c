@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+
+/* Test mock object implementing a simple RAM-based mtd */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 4
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+/* number of calls of the mock and the size of the last call */
+static unsigned _reads;
+static unsigned _writes;
+static unsigned _erases;
+static uint32_t _last_size;
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _pending;
+
+static uint8_t _src[3 * PAGE_SIZE];
+static uint8_t _dest[2 * PAGE_SIZE];
+static mtd_request_t _req[3];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+    _last_size = size;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(_dummy_memory + addr, buff, size);
+    _writes++;
+    _last_size = size;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+
+    if ((sector + count) * SECTOR_SIZE > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memset(_dummy_memory + sector * SECTOR_SIZE, 0xff, count * SECTOR_SIZE);
+    _erases++;
+    _last_size = count * SECTOR_SIZE;
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static void _done_cb(mtd_request_t *req)
+{
+    (void)req;
+
+    if (--_pending == 0) {
+        mutex_unlock(&_done);
+    }
+}
+
+/* the worker has a lower priority, so it runs only once we wait */
+static void _wait(void)
+{
+    mutex_lock(&_done);
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_dest, 0, sizeof(_dest));
+    for (unsigned i = 0; i < ARRAY_SIZE(_req); i++) {
+        _req[i].cb = _done_cb;
+        _req[i].result = 1;
+    }
+    _reads = 0;
+    _writes = 0;
+    _erases = 0;
+    _last_size = 0;
+}
+
+static void test_mtd_async_write_merge(void)
+{
+    memset(_src, 0xaa, sizeof(_src));
+
+    _pending = 3;
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_async(&dev, &_req[0], _src + PAGE_SIZE,
+                                             2 * PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_async(&dev, &_req[1], _src + 2 * PAGE_SIZE,
+                                             3 * PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_async(&dev, &_req[2], _src,
+                                             PAGE_SIZE, PAGE_SIZE));
+    _wait();
+
+    /* a single write of the three pages */
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(3 * PAGE_SIZE, _last_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_dummy_memory + PAGE_SIZE, _src,
+                                    sizeof(_src)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_req); i++) {
+        TEST_ASSERT_EQUAL_INT(0, _req[i].result);
+    }
+}
+
+static void test_mtd_async_no_merge(void)
+{
+    memset(_src, 0xbb, sizeof(_src));
+
+    /* the buffers are not contiguous */
+    _pending = 2;
+    mtd_write_async(&dev, &_req[0], _src + PAGE_SIZE, 0, PAGE_SIZE);
+    mtd_write_async(&dev, &_req[1], _src, PAGE_SIZE, PAGE_SIZE);
+    _wait();
+
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_dummy_memory, _src, 2 * PAGE_SIZE));
+}
+
+static void test_mtd_async_erase_merge(void)
+{
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+
+    _pending = 2;
+    mtd_erase_async(&dev, &_req[0], 2 * SECTOR_SIZE, SECTOR_SIZE);
+    mtd_erase_async(&dev, &_req[1], SECTOR_SIZE, SECTOR_SIZE);
+    _wait();
+
+    TEST_ASSERT_EQUAL_INT(1, _erases);
+    TEST_ASSERT_EQUAL_INT(2 * SECTOR_SIZE, _last_size);
+    TEST_ASSERT_EQUAL_INT(0x00, _dummy_memory[SECTOR_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[SECTOR_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[3 * SECTOR_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(0x00, _dummy_memory[3 * SECTOR_SIZE]);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW,
+                          mtd_erase_async(&dev, &_req[0], PAGE_SIZE, SECTOR_SIZE));
+}
+
+static void test_mtd_async_order(void)
+{
+    memset(_src, 0xcc, sizeof(_src));
+
+    /* the second write may pass the read of another page */
+    _pending = 3;
+    mtd_write_async(&dev, &_req[0], _src, 0, PAGE_SIZE);
+    mtd_read_async(&dev, &_req[1], _dest, 0, PAGE_SIZE);
+    mtd_write_async(&dev, &_req[2], _src + PAGE_SIZE, PAGE_SIZE, PAGE_SIZE);
+    _wait();
+
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_dest, _src, PAGE_SIZE));
+
+    /* but not the read of the page it writes */
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    _writes = 0;
+    _reads = 0;
+    _pending = 3;
+    mtd_write_async(&dev, &_req[0], _src, 0, PAGE_SIZE);
+    mtd_read_async(&dev, &_req[1], _dest, PAGE_SIZE, PAGE_SIZE);
+    mtd_write_async(&dev, &_req[2], _src + PAGE_SIZE, PAGE_SIZE, PAGE_SIZE);
+    _wait();
+
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    TEST_ASSERT_EQUAL_INT(0xff, _dest[0]);
+    TEST_ASSERT_EQUAL_INT(0xcc, _dummy_memory[PAGE_SIZE]);
+}
+
+static void test_mtd_async_error(void)
+{
+    _pending = 2;
+    mtd_read_async(&dev, &_req[0], _dest, MEMORY_SIZE - PAGE_SIZE,
+                   2 * PAGE_SIZE);
+    mtd_read_async(&dev, &_req[1], _dest, 0, PAGE_SIZE);
+    _wait();
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, _req[0].result);
+    TEST_ASSERT_EQUAL_INT(0, _req[1].result);
+
+    TEST_ASSERT_EQUAL_INT(-ENODEV, mtd_read_async(NULL, &_req[0], _dest, 0,
+                                                  PAGE_SIZE));
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_write_merge),
+        new_TestFixture(test_mtd_async_no_merge),
+        new_TestFixture(test_mtd_async_erase_merge),
+        new_TestFixture(test_mtd_async_order),
+        new_TestFixture(test_mtd_async_error),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
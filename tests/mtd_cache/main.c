@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "kernel_defines.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd */
+#ifndef SECTOR_COUNT
+#define SECTOR_COUNT 4
+#endif
+#ifndef PAGE_PER_SECTOR
+#define PAGE_PER_SECTOR 4
+#endif
+#ifndef PAGE_SIZE
+#define PAGE_SIZE 64
+#endif
+
+#define MEMORY_SIZE         PAGE_SIZE * PAGE_PER_SECTOR * SECTOR_COUNT
+
+#define CACHE_LINES         2
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static uint8_t _buffer[PAGE_SIZE];
+
+/* number of accesses to the mock */
+static unsigned _reads;
+static unsigned _writes;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, _dummy_memory + addr, size);
+    _reads++;
+
+    return 0;
+}
+
+static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr,
+                  uint32_t size)
+{
+    (void)dev;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    if ((addr % PAGE_SIZE) + size > PAGE_SIZE) {
+        return -EOVERFLOW;
+    }
+    memcpy(_dummy_memory + addr, buff, size);
+    _writes++;
+
+    return 0;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    (void)dev;
+
+    if (size % (PAGE_PER_SECTOR * PAGE_SIZE) != 0) {
+        return -EOVERFLOW;
+    }
+    if (addr % (PAGE_PER_SECTOR * PAGE_SIZE) != 0) {
+        return -EOVERFLOW;
+    }
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memset(_dummy_memory + addr, 0xff, size);
+
+    return 0;
+}
+
+static int _power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void)dev;
+    (void)power;
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read = _read,
+    .write = _write,
+    .erase = _erase,
+    .power = _power,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+};
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * PAGE_SIZE];
+
+static mtd_cache_t _cache = {
+    .mtd = {
+        .driver = &mtd_cache_driver,
+    },
+    .parent = &dev,
+    .lines = _lines,
+    .buf = _cache_buf,
+    .lines_numof = ARRAY_SIZE(_lines),
+    .policy = MTD_CACHE_WRITE_BACK,
+    .lock = MUTEX_INIT,
+};
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    memset(_lines, 0, sizeof(_lines));
+    mtd_cache_reset_stats(&_cache);
+    _cache.policy = MTD_CACHE_WRITE_BACK;
+    _reads = 0;
+    _writes = 0;
+}
+
+static void test_mtd_init(void)
+{
+    int ret = mtd_init(_dev);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+}
+
+static void test_mtd_read_hit(void)
+{
+    mtd_cache_stats_t stats;
+
+    memset(_dummy_memory + PAGE_SIZE, 0x11, PAGE_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 0, PAGE_SIZE));
+    _test_mem(_buffer, PAGE_SIZE, 0x11);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+
+    /* partial reads of the same page are served from the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 16, 8));
+    _test_mem(_buffer, 8, 0x11);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, PAGE_SIZE + 4, 4));
+    _test_mem(_buffer, 4, 0x11);
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+}
+
+static void test_mtd_read_across_pages(void)
+{
+    static uint8_t buf[2 * PAGE_SIZE];
+
+    memset(_dummy_memory + 2 * PAGE_SIZE, 0x22, PAGE_SIZE);
+    memset(_dummy_memory + 3 * PAGE_SIZE, 0x33, PAGE_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, buf, 2 * PAGE_SIZE + 32,
+                                      PAGE_SIZE));
+    _test_mem(buf, PAGE_SIZE / 2, 0x22);
+    _test_mem(buf + PAGE_SIZE / 2, PAGE_SIZE / 2, 0x33);
+    TEST_ASSERT_EQUAL_INT(2, _reads);
+}
+
+static void test_mtd_lru(void)
+{
+    mtd_cache_stats_t stats;
+
+    mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE);
+    mtd_read_page(_dev, _buffer, 1, 0, PAGE_SIZE);
+    mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE);
+    /* evicts page 1, the least recently used */
+    mtd_read_page(_dev, _buffer, 2, 0, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+
+    mtd_read_page(_dev, _buffer, 0, 0, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+    mtd_read_page(_dev, _buffer, 1, 0, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(4, _reads);
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.hits);
+    TEST_ASSERT_EQUAL_INT(4, stats.misses);
+    TEST_ASSERT_EQUAL_INT(2, stats.evictions);
+}
+
+static void test_mtd_write_back_merge(void)
+{
+    mtd_cache_stats_t stats;
+
+    memset(_buffer, 0xaa, PAGE_SIZE);
+
+    /* adjacent writes are merged into a single write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 1, 0, 16));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 1, 16, 16));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 1, 8, 16));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+    _test_mem(_dummy_memory + PAGE_SIZE, PAGE_SIZE, 0xff);
+
+    /* the data is read back from the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 1, 0, PAGE_SIZE));
+    _test_mem(_buffer, 32, 0xaa);
+    _test_mem(_buffer + 32, PAGE_SIZE - 32, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory + PAGE_SIZE, 32, 0xaa);
+    _test_mem(_dummy_memory + PAGE_SIZE + 32, PAGE_SIZE - 32, 0xff);
+
+    /* nothing left to write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+
+    mtd_cache_get_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+}
+
+static void test_mtd_write_back_gap(void)
+{
+    memset(_buffer, 0xaa, PAGE_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 1, 0, 8));
+    /* the gap must not be written, so the first range is written back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 1, 32, 8));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+
+    _test_mem(_dummy_memory + PAGE_SIZE, 8, 0xaa);
+    _test_mem(_dummy_memory + PAGE_SIZE + 8, 24, 0xff);
+    _test_mem(_dummy_memory + PAGE_SIZE + 32, 8, 0xaa);
+}
+
+static void test_mtd_write_back_evict(void)
+{
+    memset(_buffer, 0xbb, PAGE_SIZE);
+
+    /* full pages are not read before writing */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(_dev, _buffer, PAGE_SIZE, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, _reads);
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+
+    /* evicts the dirty page 0 */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 2, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory, PAGE_SIZE, 0xbb);
+    _test_mem(_dummy_memory + PAGE_SIZE, PAGE_SIZE, 0xff);
+
+    /* a power down writes back the rest */
+    TEST_ASSERT_EQUAL_INT(0, mtd_power(_dev, MTD_POWER_DOWN));
+    TEST_ASSERT_EQUAL_INT(2, _writes);
+    _test_mem(_dummy_memory + PAGE_SIZE, PAGE_SIZE, 0xbb);
+}
+
+static void test_mtd_erase(void)
+{
+    memset(_buffer, 0xcc, PAGE_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 0, 0, 8));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, PAGE_PER_SECTOR,
+                                           0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(2, _reads);
+    memset(_dummy_memory + PAGE_PER_SECTOR * PAGE_SIZE, 0, PAGE_SIZE);
+
+    /* the pending write to sector 0 is discarded */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 0, 2));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(0, _writes);
+
+    /* the cached copies are dropped */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, PAGE_PER_SECTOR,
+                                           0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(3, _reads);
+    _test_mem(_buffer, PAGE_SIZE, 0xff);
+
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_erase_sector(_dev, SECTOR_COUNT, 1));
+}
+
+static void test_mtd_write_through(void)
+{
+    _cache.policy = MTD_CACHE_WRITE_THROUGH;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 3, 0, PAGE_SIZE));
+    memset(_buffer, 0xdd, PAGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(_dev, _buffer, 3, 4, 4));
+    TEST_ASSERT_EQUAL_INT(1, _writes);
+    _test_mem(_dummy_memory + 3 * PAGE_SIZE + 4, 4, 0xdd);
+
+    /* the cached copy was updated */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(_dev, _buffer, 3, 0, PAGE_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _reads);
+    _test_mem(_buffer, 4, 0xff);
+    _test_mem(_buffer + 4, 4, 0xdd);
+    _test_mem(_buffer + 8, PAGE_SIZE - 8, 0xff);
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_read_hit),
+        new_TestFixture(test_mtd_read_across_pages),
+        new_TestFixture(test_mtd_lru),
+        new_TestFixture(test_mtd_write_back_merge),
+        new_TestFixture(test_mtd_write_back_gap),
+        new_TestFixture(test_mtd_write_back_evict),
+        new_TestFixture(test_mtd_erase),
+        new_TestFixture(test_mtd_write_through),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the discrete-event simulation of native
+ *
+ * Run as two instances by the coordinator in dist/tools/native_sim. Instance 0
+ * waits for a timer, busy-waits on the timer and sends a frame to instance 1.
+ * Both print the virtual time of every event.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "native_internal.h"
+#include "net/ieee802154.h"
+#include "socket_zep.h"
+#include "socket_zep_params.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define MSG_QUEUE_SIZE  (4)
+#define MSG_TYPE_ISR    (0x3456)
+#define SEND_DELAY_US   (100U * US_PER_MS)
+#define SPIN_US         (1000U)
+
+static const char _payload[] = "hello";
+static uint8_t _recvbuf[IEEE802154_FRAME_LEN_MAX];
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static socket_zep_t _dev;
+static kernel_pid_t _main_pid;
+
+static void _send(void)
+{
+    netdev_t *netdev = (netdev_t *)&_dev;
+    le_uint16_t pan = byteorder_btols(
+        byteorder_htons(CONFIG_IEEE802154_DEFAULT_PANID));
+    uint8_t hdr[IEEE802154_MAX_HDR_LEN];
+    size_t hdr_len = ieee802154_set_frame_hdr(hdr, _dev.netdev.long_addr,
+                                              IEEE802154_LONG_ADDRESS_LEN,
+                                              ieee802154_addr_bcast,
+                                              IEEE802154_ADDR_BCAST_LEN,
+                                              pan, pan,
+                                              IEEE802154_FCF_TYPE_DATA, 0);
+    iolist_t payload = { .iol_base = (void *)_payload,
+                         .iol_len = sizeof(_payload) };
+    iolist_t iolist = { .iol_next = &payload, .iol_base = hdr,
+                        .iol_len = hdr_len };
+
+    expect(hdr_len > 0);
+    printf("node %u: sending at %" PRIu32 "\n", (unsigned)_native_id,
+           ztimer_now(ZTIMER_USEC));
+    expect(netdev->driver->send(netdev, &iolist) > 0);
+}
+
+static void _recv(netdev_t *netdev)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    int len = netdev->driver->recv(netdev, _recvbuf, sizeof(_recvbuf), NULL);
+    int hdr_len = (int)ieee802154_get_frame_hdr_len(_recvbuf);
+
+    if ((len <= 0) || (hdr_len <= 0) || (hdr_len > len)) {
+        printf("node %u: received invalid frame at %" PRIu32 "\n",
+               (unsigned)_native_id, now);
+        return;
+    }
+    printf("node %u: received \"%.*s\" at %" PRIu32 "\n",
+           (unsigned)_native_id, len - hdr_len - 1,
+           (char *)&_recvbuf[hdr_len], now);
+}
+
+static void _event_cb(netdev_t *netdev, netdev_event_t event)
+{
+    if (event == NETDEV_EVENT_ISR) {
+        msg_t msg = { .type = MSG_TYPE_ISR, .content.ptr = netdev };
+
+        if (msg_send(&msg, _main_pid) <= 0) {
+            puts("possibly lost interrupt.");
+        }
+    }
+    else if (event == NETDEV_EVENT_RX_COMPLETE) {
+        _recv(netdev);
+    }
+}
+
+int main(void)
+{
+    netdev_t *netdev = (netdev_t *)&_dev;
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    _main_pid = thread_getpid();
+    socket_zep_setup(&_dev, &socket_zep_params[0]);
+    netdev->event_callback = _event_cb;
+    expect(netdev->driver->init(netdev) >= 0);
+    printf("node %u: started at %" PRIu32 "\n", (unsigned)_native_id,
+           ztimer_now(ZTIMER_USEC));
+
+    if (_native_id == 0) {
+        ztimer_sleep(ZTIMER_USEC, SEND_DELAY_US);
+        printf("node %u: timer fired at %" PRIu32 "\n", (unsigned)_native_id,
+               ztimer_now(ZTIMER_USEC));
+        /* the instance does not get idle while spinning */
+        ztimer_spin(ZTIMER_USEC, SPIN_US);
+        printf("node %u: spun until %" PRIu32 "\n", (unsigned)_native_id,
+               ztimer_now(ZTIMER_USEC));
+        _send();
+    }
+
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        if (msg.type == MSG_TYPE_ISR) {
+            netdev->driver->isr(msg.content.ptr);
+        }
+    }
+    return 0;
+}
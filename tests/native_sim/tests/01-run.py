@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+# The instances of the application are started by the simulation coordinator
+# instead of the testrunner. The test runs the simulation twice with the same
+# seed and checks that both runs give the same output.
+
+import os
+import subprocess
+import sys
+import tempfile
+
+NODES = 2
+SEED = 42
+SECONDS = 1
+SEND_DELAY_US = 100000
+SPIN_US = 1000
+
+RIOTBASE = os.environ.get("RIOTBASE",
+                          os.path.join(os.path.dirname(__file__), "..", "..",
+                                       ".."))
+TOOL_DIR = os.path.join(RIOTBASE, "dist", "tools", "native_sim")
+
+
+def simulate(logdir):
+    subprocess.check_call(["make", "-C", TOOL_DIR, "--no-print-directory"])
+    subprocess.check_call([os.path.join(TOOL_DIR, "native_sim"),
+                           "-n", str(NODES), "-s", str(SEED),
+                           "-T", str(SECONDS), "-o", logdir, "--",
+                           os.environ["ELFFILE"]], timeout=60)
+    logs = []
+    for i in range(NODES):
+        with open(os.path.join(logdir, "node{}.log".format(i))) as log:
+            logs.append([line.rstrip() for line in log
+                         if line.startswith("node ")])
+    return logs
+
+
+def event_time(lines, event):
+    for line in lines:
+        if event in line:
+            return int(line.rsplit(" ", 1)[1])
+    raise AssertionError("missing \"{}\" in {}".format(event, lines))
+
+
+def main():
+    with tempfile.TemporaryDirectory() as first, \
+            tempfile.TemporaryDirectory() as second:
+        logs = simulate(first)
+        assert logs == simulate(second), "runs with the same seed differ"
+
+    fired = event_time(logs[0], "node 0: timer fired at")
+    spun = event_time(logs[0], "node 0: spun until")
+    received = event_time(logs[1], "node 1: received \"hello\" at")
+    assert fired >= SEND_DELAY_US
+    # ztimer_spin() ended, although the instance never got idle meanwhile
+    assert spun >= fired + SPIN_US
+    assert received > fired
+    for lines in logs:
+        print("\n".join(lines))
+    print("SUCCESS")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
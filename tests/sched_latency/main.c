@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the scheduler latency statistics
+ *
+ * Threads busy wait for known durations, so the recorded slices and wakeup
+ * latencies are known within a tolerance.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "sched_latency.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define SLICE_US        (2000U)
+#define DELAY_US        (3000U)
+#define TOLERANCE_US    (1000U)
+#define ROUNDS          (4U)
+
+static char _high_stack[THREAD_STACKSIZE_DEFAULT];
+static char _low_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _high;
+static kernel_pid_t _low;
+
+/* runs for SLICE_US on every message */
+static void *_high_func(void *arg)
+{
+    (void)arg;
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        ztimer_spin(ZTIMER_USEC, SLICE_US);
+    }
+    return NULL;
+}
+
+static void *_low_func(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+    }
+    return NULL;
+}
+
+static void _print(const char *name, const sched_latency_hist_t *hist)
+{
+    printf("%s: count %" PRIu32 " p50 %" PRIu32 " max %" PRIu32 "\n", name,
+           sched_latency_hist_count(hist),
+           sched_latency_hist_percentile(hist, 50), hist->max);
+}
+
+static void set_up(void)
+{
+    sched_latency_reset();
+}
+
+static void test_sched_latency__immediate_wakeup(void)
+{
+    sched_latency_t stats;
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        msg_t msg = { .type = i };
+
+        /* switches to the higher priority thread right away */
+        msg_send(&msg, _high);
+    }
+    TEST_ASSERT_EQUAL_INT(0, sched_latency_get(_high, &stats));
+    _print("wakeup", &stats.wakeup);
+    _print("slice", &stats.slice);
+    TEST_ASSERT_EQUAL_INT(ROUNDS, sched_latency_hist_count(&stats.wakeup));
+    TEST_ASSERT(stats.wakeup.max < TOLERANCE_US);
+    TEST_ASSERT_EQUAL_INT(ROUNDS, sched_latency_hist_count(&stats.slice));
+    TEST_ASSERT(sched_latency_hist_percentile(&stats.slice, 50) >= SLICE_US / 2);
+    TEST_ASSERT(stats.slice.max >= SLICE_US);
+    TEST_ASSERT(stats.slice.max < SLICE_US + TOLERANCE_US);
+}
+
+static void test_sched_latency__delayed_wakeup(void)
+{
+    sched_latency_t stats;
+
+    /* the lower priority thread has to wait until this thread blocks */
+    thread_wakeup(_low);
+    ztimer_spin(ZTIMER_USEC, DELAY_US);
+    ztimer_sleep(ZTIMER_USEC, TOLERANCE_US);
+    TEST_ASSERT_EQUAL_INT(0, sched_latency_get(_low, &stats));
+    _print("wakeup", &stats.wakeup);
+    TEST_ASSERT_EQUAL_INT(1, sched_latency_hist_count(&stats.wakeup));
+    TEST_ASSERT(stats.wakeup.max >= DELAY_US);
+    TEST_ASSERT(stats.wakeup.max < DELAY_US + TOLERANCE_US);
+}
+
+static void test_sched_latency__timer_lateness(void)
+{
+    sched_latency_hist_t hist;
+
+    ztimer_sleep(ZTIMER_USEC, 5 * CONFIG_SCHED_LATENCY_PROBE_US);
+    sched_latency_get_timer_lateness(&hist);
+    _print("timer lateness", &hist);
+    TEST_ASSERT(sched_latency_hist_count(&hist) >= 4);
+}
+
+static void test_sched_latency__invalid_pid(void)
+{
+    sched_latency_t stats;
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, sched_latency_get(KERNEL_PID_UNDEF, &stats));
+}
+
+static Test *tests_sched_latency(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_sched_latency__immediate_wakeup),
+        new_TestFixture(test_sched_latency__delayed_wakeup),
+        new_TestFixture(test_sched_latency__timer_lateness),
+        new_TestFixture(test_sched_latency__invalid_pid),
+    };
+
+    EMB_UNIT_TESTCALLER(sched_latency_tests, set_up, NULL, fixtures);
+
+    return (Test *)&sched_latency_tests;
+}
+
+int main(void)
+{
+    _high = thread_create(_high_stack, sizeof(_high_stack),
+                          THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                          _high_func, NULL, "high");
+    _low = thread_create(_low_stack, sizeof(_low_stack),
+                         THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                         _low_func, NULL, "low");
+    /* let the lower priority thread go to sleep */
+    ztimer_sleep(ZTIMER_USEC, TOLERANCE_US);
+
+    TESTS_START();
+    TESTS_RUN(tests_sched_latency());
+    TESTS_END();
+    return 0;
+}
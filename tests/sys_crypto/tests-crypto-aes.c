@@ -114,12 +114,42 @@ static void test_crypto_aes_init_key_length(void)
     TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_KEY_SIZE, err);
 }
 
+static void test_crypto_aes_blocks(void)
+{
+    cipher_context_t ctx;
+    int err;
+    uint8_t data[3 * AES_BLOCK_SIZE];
+
+    for (unsigned i = 0; i < 3; i++) {
+        memcpy(data + i * AES_BLOCK_SIZE, TEST_0_INP, AES_BLOCK_SIZE);
+    }
+
+    err = aes_init(&ctx, TEST_0_KEY, sizeof(TEST_0_KEY));
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* in place */
+    err = aes_encrypt_blocks(&ctx, data, data, 3);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_MESSAGE(1 == compare(TEST_0_ENC, data + i * AES_BLOCK_SIZE,
+                                         AES_BLOCK_SIZE), "wrong ciphertext");
+    }
+
+    err = aes_decrypt_blocks(&ctx, data, data, 3);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    for (unsigned i = 0; i < 3; i++) {
+        TEST_ASSERT_MESSAGE(1 == compare(TEST_0_INP, data + i * AES_BLOCK_SIZE,
+                                         AES_BLOCK_SIZE), "wrong plaintext");
+    }
+}
+
 Test *tests_crypto_aes_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_aes_encrypt),
         new_TestFixture(test_crypto_aes_decrypt),
         new_TestFixture(test_crypto_aes_init_key_length),
+        new_TestFixture(test_crypto_aes_blocks),
     };
 
     EMB_UNIT_TESTCALLER(crypto_aes_tests, NULL, NULL, fixtures);
@@ -7,8 +7,10 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
 
 #include "checksum/fletcher16.h"
 
@@ -18,6 +20,46 @@
  * fletcher16 */
 static const unsigned char wrap_around_data[] = "u9k89rm88z58f3hGxTfgG3BnyKnyRP";
 
+/* longer than the blocks that are summed up before reducing modulo 255 */
+#define LONG_DATA_LEN   (5808U)
+
+/* plus 3 bytes to check unaligned data */
+static uint8_t long_data[LONG_DATA_LEN + 3];
+
+/* reduces the sums modulo 255 after every byte */
+static uint16_t fletcher16_ref(const uint8_t *buf, size_t len)
+{
+    uint16_t sum1 = 0, sum2 = 0;
+
+    while (len--) {
+        sum1 = (sum1 + *buf++) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    /* fletcher16() never reduces a sum to 0, but to 0xff */
+    return ((sum2 ? sum2 : 0xff) << 8) | (sum1 ? sum1 : 0xff);
+}
+
+static void check_long_data(void)
+{
+    static const size_t lens[] = {
+        LONG_DATA_LEN - 9, LONG_DATA_LEN - 8, LONG_DATA_LEN - 7,
+        LONG_DATA_LEN - 1, LONG_DATA_LEN,
+    };
+
+    for (unsigned off = 0; off < 4; off++) {
+        for (size_t len = 0; len < 64; len++) {
+            TEST_ASSERT_EQUAL_INT(fletcher16_ref(long_data + off, len),
+                                  fletcher16(long_data + off, len));
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+            size_t len = lens[i] - off;
+
+            TEST_ASSERT_EQUAL_INT(fletcher16_ref(long_data + off, len),
+                                  fletcher16(long_data + off, len));
+        }
+    }
+}
+
 static int calc_and_compare_checksum(const unsigned char *buf, size_t len,
                                      uint16_t expected)
 {
@@ -85,6 +127,37 @@ static void test_checksum_fletcher16_multipart(void)
     TEST_ASSERT_EQUAL_INT(expect, fletcher16_finish(&ctx));
 }
 
+static void test_checksum_fletcher16_long_random(void)
+{
+    uint32_t x = 0x12345678;
+
+    for (unsigned i = 0; i < sizeof(long_data); i++) {
+        x = x * 1103515245 + 12345;
+        long_data[i] = x >> 24;
+    }
+    check_long_data();
+}
+
+static void test_checksum_fletcher16_long_ones(void)
+{
+    /* largest sums possible */
+    memset(long_data, 0xff, sizeof(long_data));
+    check_long_data();
+}
+
+static void test_checksum_fletcher16_long_multipart(void)
+{
+    fletcher16_ctx_t ctx;
+
+    memset(long_data, 0xa5, sizeof(long_data));
+    fletcher16_init(&ctx);
+    fletcher16_update(&ctx, long_data, 3);
+    fletcher16_update(&ctx, long_data + 3, LONG_DATA_LEN - 4);
+    fletcher16_update(&ctx, long_data + LONG_DATA_LEN - 1, 1);
+    TEST_ASSERT_EQUAL_INT(fletcher16_ref(long_data, LONG_DATA_LEN),
+                          fletcher16_finish(&ctx));
+}
+
 Test *tests_checksum_fletcher16_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -93,6 +166,9 @@ Test *tests_checksum_fletcher16_tests(void)
         new_TestFixture(test_checksum_fletcher16_atoe),
         new_TestFixture(test_checksum_fletcher16_wrap_around),
         new_TestFixture(test_checksum_fletcher16_multipart),
+        new_TestFixture(test_checksum_fletcher16_long_random),
+        new_TestFixture(test_checksum_fletcher16_long_ones),
+        new_TestFixture(test_checksum_fletcher16_long_multipart),
     };
 
     EMB_UNIT_TESTCALLER(checksum_fletcher16_tests, NULL, NULL, fixtures);
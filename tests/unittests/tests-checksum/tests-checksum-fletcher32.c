@@ -7,8 +7,11 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "embUnit/embUnit.h"
+#include "kernel_defines.h"
+#include "unaligned.h"
 
 #include "checksum/fletcher32.h"
 
@@ -24,6 +27,45 @@ static const unsigned char wrap_around_data[] =
         "tLhgfET2gUGU65V3edSwADMqRttI9JPVz8JS37g5QZj4Ax56rU1u0m0K8YUs57UYG5645n"
         "byNy4yqxu7";
 
+/* longer than two blocks that are summed up before reducing modulo 65535 */
+#define LONG_DATA_WORDS (720U)
+
+/* plus 1 byte to check unaligned data */
+static uint8_t long_data[(2 * LONG_DATA_WORDS) + 1];
+
+/* reduces the sums modulo 65535 after every word */
+static uint32_t fletcher32_ref(const uint8_t *buf, size_t words)
+{
+    uint32_t sum1 = 0, sum2 = 0;
+
+    for (; words; buf += 2, words--) {
+        sum1 = (sum1 + unaligned_get_u16(buf)) % 0xffff;
+        sum2 = (sum2 + sum1) % 0xffff;
+    }
+    /* fletcher32() never reduces a sum to 0, but to 0xffff */
+    return ((sum2 ? sum2 : 0xffff) << 16) | (sum1 ? sum1 : 0xffff);
+}
+
+static void check_long_data(void)
+{
+    static const size_t lens[] = {
+        357, 358, 359, 360, 715, 716, 717, LONG_DATA_WORDS,
+    };
+
+    for (unsigned off = 0; off < 2; off++) {
+        const uint16_t *data = (const uint16_t *)(long_data + off);
+
+        for (size_t len = 0; len < 16; len++) {
+            TEST_ASSERT_EQUAL_INT(fletcher32_ref(long_data + off, len),
+                                  fletcher32(data, len));
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+            TEST_ASSERT_EQUAL_INT(fletcher32_ref(long_data + off, lens[i]),
+                                  fletcher32(data, lens[i]));
+        }
+    }
+}
+
 static int calc_and_compare_checksum(const unsigned char *buf, size_t len,
                                      uint32_t expected)
 {
@@ -81,6 +123,24 @@ static void test_checksum_fletcher32_wrap_around(void)
                                           sizeof(wrap_around_data) - 1, expect));
 }
 
+static void test_checksum_fletcher32_long_random(void)
+{
+    uint32_t x = 0x12345678;
+
+    for (unsigned i = 0; i < sizeof(long_data); i++) {
+        x = x * 1103515245 + 12345;
+        long_data[i] = x >> 24;
+    }
+    check_long_data();
+}
+
+static void test_checksum_fletcher32_long_ones(void)
+{
+    /* largest sums possible */
+    memset(long_data, 0xff, sizeof(long_data));
+    check_long_data();
+}
+
 Test *tests_checksum_fletcher32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -88,6 +148,8 @@ Test *tests_checksum_fletcher32_tests(void)
         new_TestFixture(test_checksum_fletcher32_0to1_undetected),
         new_TestFixture(test_checksum_fletcher32_atof),
         new_TestFixture(test_checksum_fletcher32_wrap_around),
+        new_TestFixture(test_checksum_fletcher32_long_random),
+        new_TestFixture(test_checksum_fletcher32_long_ones),
     };
 
     EMB_UNIT_TESTCALLER(checksum_fletcher32_tests, NULL, NULL, fixtures);
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+
+#include "embUnit.h"
+
+#include "net/frag_ints.h"
+
+#include "tests-frag_ints.h"
+
+static frag_ints_t _ints;
+
+static void set_up(void)
+{
+    frag_ints_init(&_ints);
+}
+
+static void _test_int(unsigned idx, uint16_t start, uint16_t end)
+{
+    TEST_ASSERT(idx < _ints.numof);
+    TEST_ASSERT_EQUAL_INT(start, _ints.ints[idx].start);
+    TEST_ASSERT_EQUAL_INT(end, _ints.ints[idx].end);
+}
+
+static void test_frag_ints_add__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(-EEXIST, frag_ints_add(&_ints, 16, 16));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 16, 8));
+    TEST_ASSERT_EQUAL_INT(0, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(0, _ints.frags);
+}
+
+static void test_frag_ints_add__in_order(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 192));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 192, 250));
+    TEST_ASSERT_EQUAL_INT(1, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(3, _ints.frags);
+    _test_int(0, 0, 250);
+    TEST_ASSERT(frag_ints_complete(&_ints, 250));
+    TEST_ASSERT(!frag_ints_complete(&_ints, 251));
+}
+
+static void test_frag_ints_add__out_of_order(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 192, 250));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 48));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 144));
+    TEST_ASSERT_EQUAL_INT(3, _ints.numof);
+    _test_int(0, 0, 48);
+    _test_int(1, 96, 144);
+    _test_int(2, 192, 250);
+    TEST_ASSERT(!frag_ints_complete(&_ints, 250));
+    /* adjacent to the right */
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 144, 160));
+    _test_int(1, 96, 160);
+    /* adjacent to the left */
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 80, 96));
+    _test_int(1, 80, 160);
+    TEST_ASSERT_EQUAL_INT(3, _ints.numof);
+    /* closes gaps on both sides */
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 160, 192));
+    TEST_ASSERT_EQUAL_INT(2, _ints.numof);
+    _test_int(1, 80, 250);
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 48, 80));
+    TEST_ASSERT_EQUAL_INT(1, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(7, _ints.frags);
+    TEST_ASSERT(frag_ints_complete(&_ints, 250));
+}
+
+static void test_frag_ints_add__duplicate(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 192));
+    TEST_ASSERT_EQUAL_INT(-EEXIST, frag_ints_add(&_ints, 96, 192));
+    /* fragments are merged, so anything within is a duplicate */
+    TEST_ASSERT_EQUAL_INT(-EEXIST, frag_ints_add(&_ints, 88, 104));
+    TEST_ASSERT_EQUAL_INT(1, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(2, _ints.frags);
+    _test_int(0, 0, 192);
+}
+
+static void test_frag_ints_add__overlap(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 192, 288));
+    /* overlaps end of first interval */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 88, 184));
+    /* overlaps start of second interval */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 104, 200));
+    /* spans second interval */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 184, 296));
+    /* overlaps first interval, but is adjacent to the second */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 88, 192));
+    TEST_ASSERT_EQUAL_INT(2, _ints.numof);
+    _test_int(0, 0, 96);
+    _test_int(1, 192, 288);
+}
+
+static void test_frag_ints_add__full(void)
+{
+    for (unsigned i = 0; i < CONFIG_FRAG_INTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, i * 16, (i * 16) + 8));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_FRAG_INTS_NUMOF, _ints.numof);
+    /* a new gap does not fit anymore ... */
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS,
+                          frag_ints_add(&_ints, CONFIG_FRAG_INTS_NUMOF * 16,
+                                        (CONFIG_FRAG_INTS_NUMOF * 16) + 8));
+    /* ... but filling an existing gap does */
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 8, 16));
+    TEST_ASSERT_EQUAL_INT(CONFIG_FRAG_INTS_NUMOF - 1, _ints.numof);
+    _test_int(0, 0, 24);
+    _test_int(1, 32, 40);
+}
+
+static void test_frag_ints_add_exact__empty(void)
+{
+    frag_ints_init_exact(&_ints);
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 16, 16));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 16, 8));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 16));
+    /* also within data already received */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 8, 8));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 16, 16));
+    TEST_ASSERT_EQUAL_INT(1, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(1, _ints.frags);
+}
+
+static void test_frag_ints_add_exact__out_of_order(void)
+{
+    frag_ints_init_exact(&_ints);
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 192, 250));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT(!frag_ints_complete(&_ints, 250));
+    /* adjacent intervals are not merged */
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 144));
+    TEST_ASSERT_EQUAL_INT(3, _ints.numof);
+    TEST_ASSERT(!frag_ints_complete(&_ints, 250));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 144, 192));
+    TEST_ASSERT_EQUAL_INT(4, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(4, _ints.frags);
+    _test_int(0, 0, 96);
+    _test_int(1, 96, 144);
+    _test_int(2, 144, 192);
+    _test_int(3, 192, 250);
+    TEST_ASSERT(frag_ints_complete(&_ints, 250));
+    TEST_ASSERT(!frag_ints_complete(&_ints, 251));
+}
+
+static void test_frag_ints_add_exact__duplicate(void)
+{
+    frag_ints_init_exact(&_ints);
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 192));
+    TEST_ASSERT_EQUAL_INT(-EEXIST, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(-EEXIST, frag_ints_add(&_ints, 96, 192));
+    TEST_ASSERT_EQUAL_INT(2, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(2, _ints.frags);
+}
+
+static void test_frag_ints_add_exact__overlap(void)
+{
+    frag_ints_init_exact(&_ints);
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 0, 96));
+    TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, 96, 192));
+    /* within a fragment, but with different limits */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 8, 88));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 0, 88));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 104, 192));
+    /* within the data received, but spanning two fragments */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 88, 104));
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 0, 192));
+    /* overlaps end of the data received */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, frag_ints_add(&_ints, 184, 288));
+    TEST_ASSERT_EQUAL_INT(2, _ints.numof);
+    TEST_ASSERT_EQUAL_INT(2, _ints.frags);
+    _test_int(0, 0, 96);
+    _test_int(1, 96, 192);
+}
+
+static void test_frag_ints_add_exact__full(void)
+{
+    frag_ints_init_exact(&_ints);
+    for (unsigned i = 0; i < CONFIG_FRAG_INTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, frag_ints_add(&_ints, i * 8, (i * 8) + 8));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_FRAG_INTS_NUMOF, _ints.numof);
+    /* every fragment takes an interval, even if adjacent */
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS,
+                          frag_ints_add(&_ints, CONFIG_FRAG_INTS_NUMOF * 8,
+                                        (CONFIG_FRAG_INTS_NUMOF * 8) + 8));
+    TEST_ASSERT(frag_ints_complete(&_ints, CONFIG_FRAG_INTS_NUMOF * 8));
+}
+
+Test *tests_frag_ints_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_frag_ints_add__empty),
+        new_TestFixture(test_frag_ints_add__in_order),
+        new_TestFixture(test_frag_ints_add__out_of_order),
+        new_TestFixture(test_frag_ints_add__duplicate),
+        new_TestFixture(test_frag_ints_add__overlap),
+        new_TestFixture(test_frag_ints_add__full),
+        new_TestFixture(test_frag_ints_add_exact__empty),
+        new_TestFixture(test_frag_ints_add_exact__out_of_order),
+        new_TestFixture(test_frag_ints_add_exact__duplicate),
+        new_TestFixture(test_frag_ints_add_exact__overlap),
+        new_TestFixture(test_frag_ints_add_exact__full),
+    };
+
+    EMB_UNIT_TESTCALLER(frag_ints_tests, set_up, NULL, fixtures);
+
+    return (Test *)&frag_ints_tests;
+}
+
+void tests_frag_ints(void)
+{
+    TESTS_RUN(tests_frag_ints_tests());
+}
+/** @} */
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the gcoap resource index
+ *
+ * Listeners with ordered resources are searched by the binary search of
+ * `gcoap_index`. Its results are compared to the ones of the default linear
+ * matcher, which is installed for a listener with unordered resources.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "embUnit.h"
+
+#include "net/gcoap.h"
+
+#include "tests-gcoap_index.h"
+
+/*
+ * The resources of the listeners, ordered by strcmp() of their paths. The
+ * handlers are set to NULL.
+ */
+static const coap_resource_t resources_first[] = {
+    { .path = "/a", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/a/b", .methods = (COAP_POST) },
+    { .path = "/a/b", .methods = (COAP_PUT) },
+    { .path = "/a/b/c", .methods = (COAP_GET) },
+    { .path = "/ab", .methods = (COAP_GET) },
+    { .path = "/abc", .methods = (COAP_DELETE | COAP_MATCH_SUBTREE) },
+    { .path = "/s", .methods = (COAP_GET) },
+    { .path = "/s/t", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/x", .methods = (COAP_DELETE) },
+};
+
+static const coap_resource_t resources_second[] = {
+    { .path = "/a/b/c/d", .methods = (COAP_PUT) },
+    { .path = "/long/path/sub", .methods = (COAP_PUT | COAP_MATCH_SUBTREE) },
+    { .path = "/s/t/u", .methods = (COAP_POST) },
+    { .path = "/x", .methods = (COAP_GET) },
+};
+
+static const coap_resource_t resources_unordered[] = {
+    { .path = "/z", .methods = (COAP_GET) },
+    { .path = "/y", .methods = (COAP_GET) },
+};
+
+/*
+ * Hides the resources of the test listeners in the resource list of gcoap,
+ * which is checked by tests-gcoap.
+ */
+static ssize_t _encode_none(const coap_resource_t *resource, char *buf,
+                            size_t maxlen, coap_link_encoder_ctx_t *context)
+{
+    (void)resource;
+    (void)buf;
+    (void)maxlen;
+    (void)context;
+    return 0;
+}
+
+static gcoap_listener_t listener_first = {
+    .resources     = &resources_first[0],
+    .resources_len = ARRAY_SIZE(resources_first),
+    .link_encoder  = _encode_none,
+};
+
+static gcoap_listener_t listener_second = {
+    .resources     = &resources_second[0],
+    .resources_len = ARRAY_SIZE(resources_second),
+    .link_encoder  = _encode_none,
+};
+
+static gcoap_listener_t listener_unordered = {
+    .resources     = &resources_unordered[0],
+    .resources_len = ARRAY_SIZE(resources_unordered),
+    .link_encoder  = _encode_none,
+};
+
+static const unsigned methods[] = {
+    COAP_METHOD_GET, COAP_METHOD_POST, COAP_METHOD_PUT, COAP_METHOD_DELETE,
+};
+
+static const char *paths[] = {
+    "/", "/a", "/a/", "/a/b", "/a/b/", "/a/b/c", "/a/b/c/d", "/a/bc", "/ab",
+    "/ab/c", "/abc", "/abc/d", "/abcd", "/b", "/s", "/s/", "/s/t", "/s/tu",
+    "/s/t/u", "/s/u", "/x", "/x/y", "/long/path/su", "/long/path/sub",
+    "/long/path/sub/x", "/long/path/subx", "/y", "/z",
+};
+
+static uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+static coap_pkt_t pdu;
+
+static void _build_req(unsigned method, const char *path)
+{
+    ssize_t len;
+
+    gcoap_req_init(&pdu, buf, sizeof(buf), method, path);
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT(coap_parse(&pdu, buf, len) >= 0);
+}
+
+static int _match(gcoap_listener_t *listener, unsigned method,
+                  const char *path, const coap_resource_t **resource)
+{
+    _build_req(method, path);
+    return listener->request_matcher(listener, resource, &pdu);
+}
+
+/*
+ * Compares the index with the default matcher for all requests on a listener
+ */
+static void _check_equivalence(gcoap_listener_t *listener)
+{
+    gcoap_request_matcher_t linear = listener_unordered.request_matcher;
+
+    for (unsigned m = 0; m < ARRAY_SIZE(methods); m++) {
+        for (unsigned p = 0; p < ARRAY_SIZE(paths); p++) {
+            const coap_resource_t *expected = NULL, *resource = NULL;
+            int res;
+
+            _build_req(methods[m], paths[p]);
+            res = linear(listener, &expected, &pdu);
+            TEST_ASSERT_EQUAL_INT(res, listener->request_matcher(listener,
+                                                                 &resource,
+                                                                 &pdu));
+            if (res == GCOAP_RESOURCE_FOUND) {
+                TEST_ASSERT(expected == resource);
+            }
+        }
+    }
+}
+
+static void test_gcoap_index__installed(void)
+{
+    TEST_ASSERT_NOT_NULL(listener_unordered.request_matcher);
+    TEST_ASSERT_NOT_NULL(listener_first.request_matcher);
+    TEST_ASSERT(listener_first.request_matcher !=
+                listener_unordered.request_matcher);
+    TEST_ASSERT(listener_second.request_matcher ==
+                listener_first.request_matcher);
+}
+
+static void test_gcoap_index__equivalence(void)
+{
+    _check_equivalence(&listener_first);
+    _check_equivalence(&listener_second);
+}
+
+static void test_gcoap_index__overlapping_prefixes(void)
+{
+    const coap_resource_t *resource;
+
+    /* the subtree of "/a" sorts before the resources with the exact path */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_GET, "/a/b/c",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[0]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_GET, "/ab",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[0]);
+    /* two resources with the same path, but different methods */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_POST, "/a/b",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[1]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_PUT, "/a/b",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[2]);
+    /* the longer subtree "/abc" only matches with its method */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_DELETE, "/abcd",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[5]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_first, COAP_METHOD_GET, "/s/t/u",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_first[7]);
+}
+
+static void test_gcoap_index__wrong_method(void)
+{
+    const coap_resource_t *resource;
+
+    /* 4.05 if a resource matches the path, but not the method */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _match(&listener_first, COAP_METHOD_GET, "/x",
+                                 &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _match(&listener_first, COAP_METHOD_DELETE, "/a/b",
+                                 &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _match(&listener_first, COAP_METHOD_POST, "/abc/d",
+                                 &resource));
+    /* 4.04 if no resource matches the path */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match(&listener_first, COAP_METHOD_GET, "/y",
+                                 &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match(&listener_first, COAP_METHOD_GET, "/s/u",
+                                 &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match(&listener_first, COAP_METHOD_GET, "/",
+                                 &resource));
+}
+
+static void test_gcoap_index__multiple_listeners(void)
+{
+    const coap_resource_t *resource;
+
+    /* the same path with a different method in each listener */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _match(&listener_first, COAP_METHOD_GET, "/x",
+                                 &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_second, COAP_METHOD_GET, "/x",
+                                 &resource));
+    TEST_ASSERT(resource == &resources_second[3]);
+    /* the subtree path lengths are shared by all listeners, but a listener
+     * only matches its own subtrees */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_second, COAP_METHOD_PUT,
+                                 "/long/path/sub/x", &resource));
+    TEST_ASSERT(resource == &resources_second[1]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match(&listener_first, COAP_METHOD_PUT,
+                                 "/long/path/sub/x", &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match(&listener_second, COAP_METHOD_GET,
+                                 "/a/b/c", &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match(&listener_second, COAP_METHOD_POST,
+                                 "/s/t/u", &resource));
+    TEST_ASSERT(resource == &resources_second[2]);
+}
+
+Test *tests_gcoap_index_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gcoap_index__installed),
+        new_TestFixture(test_gcoap_index__equivalence),
+        new_TestFixture(test_gcoap_index__overlapping_prefixes),
+        new_TestFixture(test_gcoap_index__wrong_method),
+        new_TestFixture(test_gcoap_index__multiple_listeners),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_index_tests, NULL, NULL, fixtures);
+
+    return (Test *)&gcoap_index_tests;
+}
+
+void tests_gcoap_index(void)
+{
+    static bool registered;
+
+    /* a listener can only be registered once */
+    if (!registered) {
+        gcoap_register_listener(&listener_first);
+        gcoap_register_listener(&listener_second);
+        gcoap_register_listener(&listener_unordered);
+        registered = true;
+    }
+    TESTS_RUN(tests_gcoap_index_tests());
+}
+/** @} */
@@ -178,6 +178,71 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+static void _test_nib_ft_get_next_hop(const ipv6_addr_t *dst,
+                                      const ipv6_addr_t *next_hop,
+                                      unsigned dst_len)
+{
+    gnrc_ipv6_nib_ft_t fte;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_match_prefix(dst, &fte.dst) >= dst_len);
+    TEST_ASSERT(ipv6_addr_equal(next_hop, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(dst_len, fte.dst_len);
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+}
+
+/*
+ * Adds nested routes (/30, /64, /128) and a sibling /64 route, then gets
+ * routes for destinations below each of them, removing the routes from the
+ * inside out.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest matching prefix that is still in the forwarding table
+ */
+static void test_nib_ft_get__success5(void)
+{
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t dst128 = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t next_hops[4];
+    ipv6_addr_t pfx64_sibling = pfx, dst_in_64a = dst128;
+    ipv6_addr_t dst_in_30 = pfx, dst_in_sibling;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(next_hops); i++) {
+        next_hops[i] = (ipv6_addr_t){ .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                               { .u64 = TEST_UINT64 + i } } };
+    }
+    bf_toggle(pfx64_sibling.u8, 63);
+    dst_in_sibling = pfx64_sibling;
+    dst_in_sibling.u8[15] = 0x01;
+    dst_in_64a.u8[15] ^= 0x01;
+    bf_toggle(dst_in_30.u8, 40);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst128, 128,
+                                                  &next_hops[0], IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, 30,
+                                                  &next_hops[1], IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx64_sibling, 64,
+                                                  &next_hops[2], IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, 64,
+                                                  &next_hops[3], IFACE, 0));
+    _test_nib_ft_get_next_hop(&dst128, &next_hops[0], 128);
+    _test_nib_ft_get_next_hop(&dst_in_64a, &next_hops[3], 64);
+    _test_nib_ft_get_next_hop(&dst_in_sibling, &next_hops[2], 64);
+    _test_nib_ft_get_next_hop(&dst_in_30, &next_hops[1], 30);
+    gnrc_ipv6_nib_ft_del(&pfx, 64);
+    _test_nib_ft_get_next_hop(&dst128, &next_hops[0], 128);
+    _test_nib_ft_get_next_hop(&dst_in_64a, &next_hops[1], 30);
+    _test_nib_ft_get_next_hop(&dst_in_sibling, &next_hops[2], 64);
+    gnrc_ipv6_nib_ft_del(&dst128, 128);
+    _test_nib_ft_get_next_hop(&dst128, &next_hops[1], 30);
+    _test_nib_ft_get_next_hop(&dst_in_sibling, &next_hops[2], 64);
+    gnrc_ipv6_nib_ft_del(&pfx64_sibling, 64);
+    _test_nib_ft_get_next_hop(&dst_in_sibling, &next_hops[1], 30);
+    gnrc_ipv6_nib_ft_del(&pfx, 30);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH,
+                          gnrc_ipv6_nib_ft_get(&dst_in_30, NULL, &fte));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +792,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -532,6 +532,54 @@ static void test_nib_nc_add__cache_out_crash(void)
     }
 }
 
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
+ * addresses, makes the first one a default router, and then adds
+ * CONFIG_GNRC_IPV6_NIB_NUMOF more while the default router is removed after
+ * the first.
+ * Expected result: the first entry is skipped while it is a default router and
+ * replaced last, as it is queued again after all others
+ */
+static void test_nib_nc_add__cache_out_requeue(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF], *node;
+    _nib_dr_entry_t *dr;
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t first;
+
+    memcpy(&first, &addr, sizeof(first));
+    for (int i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addr, IFACE,
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+        addr.u64[1].u64++;
+    }
+    TEST_ASSERT_NOT_NULL((dr = _nib_drl_add(&first, IFACE)));
+    TEST_ASSERT(nodes[0] == dr->next_hop);
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    TEST_ASSERT(nodes[1] == node);
+    addr.u64[1].u64++;
+    _nib_drl_remove(dr);
+    TEST_ASSERT(nodes[0] == _nib_onl_get(&first, IFACE));
+    for (int i = 2; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                                 GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+        TEST_ASSERT(nodes[i] == node);
+        addr.u64[1].u64++;
+    }
+    /* the entry replacing nodes[1] was queued before nodes[0] */
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    TEST_ASSERT(nodes[1] == node);
+    addr.u64[1].u64++;
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    TEST_ASSERT(nodes[0] == node);
+    TEST_ASSERT(ipv6_addr_equal(&addr, &node->ipv6));
+    TEST_ASSERT_NULL(_nib_onl_get(&first, IFACE));
+}
+
 /*
  * Creates a neighbor cache entry and sets it reachable
  * Expected result: node->info flags set to NUD_STATE_REACHABLE and NIB's event
@@ -585,6 +633,48 @@ static void test_nib_nc_remove__cleared(void)
     TEST_ASSERT_NULL(_nib_onl_iter(NULL));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
+ * addresses, removes every second one and then tries to get all of them.
+ * Expected result: only the remaining entries should be found and the hash
+ * table statistics should count the hits and misses
+ */
+static void test_nib_onl_get__hash(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u8[15] = i;
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_nc_add(&addr, IFACE,
+                                                     GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        _nib_nc_remove(nodes[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF / 2,
+                          _nib_onl_hash_stats.used);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        addr.u8[15] = i;
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF,
+                          _nib_onl_hash_stats.hits);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF / 2,
+                          _nib_onl_hash_stats.misses);
+    TEST_ASSERT(_nib_onl_hash_stats.max_probes <=
+                (CONFIG_GNRC_IPV6_NIB_NUMOF / 2));
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF default router list entries with
  * different IP addresses and then tries to add another.
@@ -2028,8 +2118,12 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_nc_add__success),
         new_TestFixture(test_nib_nc_add__success_full_but_garbage_collectible),
         new_TestFixture(test_nib_nc_add__cache_out_crash),
+        new_TestFixture(test_nib_nc_add__cache_out_requeue),
         new_TestFixture(test_nib_nc_remove__uncleared),
         new_TestFixture(test_nib_nc_remove__cleared),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        new_TestFixture(test_nib_onl_get__hash),
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         new_TestFixture(test_nib_nc_set_reachable__success),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_iface),
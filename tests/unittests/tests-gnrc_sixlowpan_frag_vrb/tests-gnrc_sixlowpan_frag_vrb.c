@@ -36,13 +36,12 @@
  * reference for forwarding) so an uninitialized one is enough */
 static gnrc_netif_t _dummy_netif;
 
-static const gnrc_sixlowpan_frag_rb_int_t _interval = {
-    .next = NULL,
+static const frag_ints_int_t _interval = {
     .start = 0,
     .end = 116U,
 };
 static const gnrc_sixlowpan_frag_rb_base_t _base = {
-    .ints = (gnrc_sixlowpan_frag_rb_int_t *)&_interval,
+    .ints = { .ints = { _interval }, .frags = 1, .numof = 1 },
     .src = TEST_SRC,
     .dst = TEST_DST,
     .src_len = TEST_SRC_LEN,
@@ -68,13 +67,12 @@ static void test_vrb_add__success(void)
                                                             &_dummy_netif,
                                                             _out_dst,
                                                             sizeof(_out_dst))));
-    TEST_ASSERT_NOT_NULL(res->super.ints);
-    TEST_ASSERT_NULL(res->super.ints->next);
+    TEST_ASSERT_EQUAL_INT(1, res->super.ints.numof);
     /* make sure _base and res->super are distinct*/
     TEST_ASSERT((&_base) != (&res->super));
     /* but that the values are the same */
-    TEST_ASSERT_EQUAL_INT(_interval.start, res->super.ints->start);
-    TEST_ASSERT_EQUAL_INT(_interval.end, res->super.ints->end);
+    TEST_ASSERT_EQUAL_INT(_interval.start, res->super.ints.ints[0].start);
+    TEST_ASSERT_EQUAL_INT(_interval.end, res->super.ints.ints[0].end);
     TEST_ASSERT_EQUAL_INT(_base.src_len, res->super.src_len);
     TEST_ASSERT_MESSAGE(memcmp(_base.src, res->super.src, TEST_SRC_LEN) == 0,
                         "TEST_SRC != res->super.src");
@@ -165,6 +165,23 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    uint8_t data[66];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (i * 37) + 11;
+    }
+
+    /* long enough to be summed up in words, starting at an odd address */
+    TEST_ASSERT_EQUAL_INT(0xd06f, inet_csum(0, data, 64));
+    TEST_ASSERT_EQUAL_INT(0xe010, inet_csum(0, data + 1, 65));
+
+    /* the same in two slices, the first one of odd length */
+    uint16_t sum = inet_csum_slice(0, data + 1, 21, 0);
+    TEST_ASSERT_EQUAL_INT(0xe010, inet_csum_slice(sum, data + 22, 44, 21));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +193,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -654,7 +654,7 @@ static void test_nanocoap__options_iterate(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 
     /* read all options */
-    coap_optpos_t opt = {0, 0};
+    coap_optpos_t opt = { .opt_num = 0, .offset = 0 };
     uint8_t *value;
     ssize_t exp_len[] = {17, 1, 24, 5, -ENOENT};
     ssize_t exp_optnum[] = {COAP_OPT_URI_PATH, COAP_OPT_CONTENT_FORMAT,
@@ -703,7 +703,9 @@ static void test_nanocoap__options_get_opaque(void)
     ssize_t optlen = coap_opt_get_opaque(&pkt, COAP_OPT_URI_QUERY, &value);
     TEST_ASSERT_EQUAL_INT(24, optlen);
 
-    coap_optpos_t opt = {0, value + optlen - (uint8_t *)pkt.hdr};
+    coap_optpos_t opt = {
+        .opt_num = 0, .offset = value + optlen - (uint8_t *)pkt.hdr
+    };
 
     optlen = coap_opt_get_next(&pkt, &opt, &value, false);
     TEST_ASSERT_EQUAL_INT(0, opt.opt_num);
@@ -713,6 +715,69 @@ static void test_nanocoap__options_get_opaque(void)
     TEST_ASSERT_EQUAL_INT(-ENOENT, optlen);
 }
 
+/*
+ * Tests lookup of options of a parsed request by option number, with
+ * coap_opt_get_uint(), coap_get_content_type() and coap_get_blockopt().
+ */
+static void test_nanocoap__options_get_uint(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint16_t msgid = 0xABCD;
+    uint8_t token[2] = {0xDA, 0xEC};
+
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_CON,
+                                &token[0], 2, COAP_METHOD_POST, msgid);
+
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+
+    coap_opt_add_uint(&pkt, COAP_OPT_OBSERVE, 0x1000);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, "/riot/value", '/');
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uri_query(&pkt, "a", "1");
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, 0x12);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK1, 0x1234a);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+
+    memset(&pkt, 0, sizeof(pkt));
+    int res = coap_parse(&pkt, &buf[0], len);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_CBOR, coap_get_content_type(&pkt));
+
+    uint32_t value;
+    res = coap_opt_get_uint(&pkt, COAP_OPT_OBSERVE, &value);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(0x1000, value);
+
+    res = coap_opt_get_uint(&pkt, COAP_OPT_ACCEPT, &value);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    uint32_t blknum;
+    unsigned szx;
+    res = coap_get_blockopt(&pkt, COAP_OPT_BLOCK2, &blknum, &szx);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT_EQUAL_INT(1, blknum);
+    TEST_ASSERT_EQUAL_INT(2, szx);
+
+    res = coap_get_blockopt(&pkt, COAP_OPT_BLOCK1, &blknum, &szx);
+    TEST_ASSERT_EQUAL_INT(1, res);
+    TEST_ASSERT_EQUAL_INT(0x1234, blknum);
+    TEST_ASSERT_EQUAL_INT(2, szx);
+
+    uint8_t *opt_value;
+    ssize_t optlen = coap_opt_get_opaque(&pkt, COAP_OPT_URI_PATH, &opt_value);
+    TEST_ASSERT_EQUAL_INT(4, optlen);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(opt_value, "riot", 4));
+
+    optlen = coap_opt_get_opaque(&pkt, COAP_OPT_URI_QUERY, &opt_value);
+    TEST_ASSERT_EQUAL_INT(3, optlen);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(opt_value, "a=1", 3));
+
+    optlen = coap_opt_get_opaque(&pkt, COAP_OPT_PROXY_URI, &opt_value);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, optlen);
+}
+
 /*
  * Validates empty message parsing.
  */
@@ -853,6 +918,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__option_add_buffer_max),
         new_TestFixture(test_nanocoap__options_get_opaque),
         new_TestFixture(test_nanocoap__options_iterate),
+        new_TestFixture(test_nanocoap__options_get_uint),
         new_TestFixture(test_nanocoap__server_get_req),
         new_TestFixture(test_nanocoap__server_reply_simple),
         new_TestFixture(test_nanocoap__server_get_req_con),
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the nanocoap option index
+ *
+ * The options are looked up in a request with option headers of all sizes,
+ * both as written with the Packet API and as parsed with coap_parse(). The
+ * results are compared to iterating the options with coap_opt_get_next(),
+ * which does not use coap_pkt_t::options.
+ *
+ * The tests only use the nanocoap API and pass with the linear lookup as well.
+ * With `nanocoap_option_index` they additionally check the value and header
+ * lengths recorded for every option.
+ */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/nanocoap.h"
+
+#include "tests-nanocoap_option_index.h"
+
+#define _BUF_SIZE           (128U)
+#define _OPT_IF_MATCH       (1U)
+#define _OPT_SIZE1          (60U)
+#define _OPT_TEST           (2049U)     /**< needs a 2 byte delta extension */
+#define _OPT_NUM_MAX        (2100U)
+
+static const uint8_t _if_match[] = { 0x01, 0x02 };
+static const char _host[] = "riot-os.org";
+static const char _path[] = "/a/b";
+static const char _query[] = "long-query-value=1";
+static const uint8_t _test[] = { 0xaa, 0xbb, 0xcc };
+
+/* the options of the request in order, with the lengths of the option value
+ * and of the option header */
+static const struct {
+    uint16_t num;
+    uint8_t len;
+    uint8_t hdr_len;
+} _exp[] = {
+    { _OPT_IF_MATCH, sizeof(_if_match), 1 },
+    { COAP_OPT_URI_HOST, sizeof(_host) - 1, 1 },
+    { COAP_OPT_URI_PATH, 1, 1 },
+    { COAP_OPT_URI_PATH, 1, 1 },        /* same option number again */
+    { COAP_OPT_CONTENT_FORMAT, 1, 1 },
+    { COAP_OPT_URI_QUERY, sizeof(_query) - 1, 2 },
+    { _OPT_SIZE1, 2, 2 },
+    { _OPT_TEST, sizeof(_test), 3 },
+};
+
+static uint8_t _buf[_BUF_SIZE];
+static coap_pkt_t _pkt;
+
+static size_t _build(void)
+{
+    uint8_t token[2] = { 0xda, 0xec };
+    size_t len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_NON, token,
+                                sizeof(token), COAP_METHOD_GET, 0xabcd);
+
+    coap_pkt_init(&_pkt, _buf, sizeof(_buf), len);
+    TEST_ASSERT(coap_opt_add_opaque(&_pkt, _OPT_IF_MATCH, _if_match,
+                                    sizeof(_if_match)) > 0);
+    TEST_ASSERT(coap_opt_add_opaque(&_pkt, COAP_OPT_URI_HOST,
+                                    (const uint8_t *)_host,
+                                    sizeof(_host) - 1) > 0);
+    TEST_ASSERT(coap_opt_add_string(&_pkt, COAP_OPT_URI_PATH, _path, '/') > 0);
+    TEST_ASSERT(coap_opt_add_uint(&_pkt, COAP_OPT_CONTENT_FORMAT,
+                                  COAP_FORMAT_LINK) > 0);
+    TEST_ASSERT(coap_opt_add_string(&_pkt, COAP_OPT_URI_QUERY, _query,
+                                    '&') > 0);
+    TEST_ASSERT(coap_opt_add_uint(&_pkt, _OPT_SIZE1, 1024) > 0);
+    TEST_ASSERT(coap_opt_add_opaque(&_pkt, _OPT_TEST, _test,
+                                    sizeof(_test)) > 0);
+    return coap_opt_finish(&_pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void _build_and_parse(void)
+{
+    size_t len = _build();
+
+    memset(&_pkt, 0, sizeof(_pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&_pkt, _buf, len));
+}
+
+/* reference for coap_opt_get_opaque(): iterates the options in the packet
+ * for the first one with the option number */
+static ssize_t _find_linear(unsigned opt_num, uint8_t **value)
+{
+    coap_optpos_t opt;
+    ssize_t len;
+    bool first = true;
+
+    while ((len = coap_opt_get_next(&_pkt, &opt, value, first)) >= 0) {
+        if (opt.opt_num == opt_num) {
+            return len;
+        }
+        first = false;
+    }
+    return -ENOENT;
+}
+
+static void _check_lookup(void)
+{
+    for (unsigned opt_num = 0; opt_num <= _OPT_NUM_MAX; opt_num++) {
+        uint8_t *exp_value = NULL, *value = NULL;
+        ssize_t exp_len = _find_linear(opt_num, &exp_value);
+
+        TEST_ASSERT_EQUAL_INT(exp_len,
+                              coap_opt_get_opaque(&_pkt, opt_num, &value));
+        if (exp_len >= 0) {
+            TEST_ASSERT(exp_value == value);
+        }
+    }
+}
+
+static void _check_values(void)
+{
+    uint8_t *value;
+    uint32_t uint_value;
+    char str[CONFIG_NANOCOAP_URI_MAX];
+
+    TEST_ASSERT_EQUAL_INT(sizeof(_if_match),
+                          coap_opt_get_opaque(&_pkt, _OPT_IF_MATCH, &value));
+    TEST_ASSERT(memcmp(_if_match, value, sizeof(_if_match)) == 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(_host) - 1,
+                          coap_opt_get_opaque(&_pkt, COAP_OPT_URI_HOST,
+                                              &value));
+    TEST_ASSERT(memcmp(_host, value, sizeof(_host) - 1) == 0);
+    /* the first of both Uri-Path options */
+    TEST_ASSERT_EQUAL_INT(1, coap_opt_get_opaque(&_pkt, COAP_OPT_URI_PATH,
+                                                 &value));
+    TEST_ASSERT_EQUAL_INT('a', *value);
+    TEST_ASSERT_EQUAL_INT(sizeof(_path),
+                          coap_get_uri_path(&_pkt, (uint8_t *)str));
+    TEST_ASSERT_EQUAL_STRING(_path, str);
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&_pkt, COAP_OPT_CONTENT_FORMAT,
+                                               &uint_value));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_LINK, uint_value);
+    /* the separator is prepended to every part */
+    TEST_ASSERT_EQUAL_INT(sizeof(_query) + 1,
+                          coap_opt_get_string(&_pkt, COAP_OPT_URI_QUERY,
+                                              (uint8_t *)str, sizeof(str),
+                                              '&'));
+    TEST_ASSERT_EQUAL_STRING(_query, &str[1]);
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&_pkt, _OPT_SIZE1,
+                                               &uint_value));
+    TEST_ASSERT_EQUAL_INT(1024, uint_value);
+    TEST_ASSERT_EQUAL_INT(sizeof(_test),
+                          coap_opt_get_opaque(&_pkt, _OPT_TEST, &value));
+    TEST_ASSERT(memcmp(_test, value, sizeof(_test)) == 0);
+}
+
+/*
+ * Checks the options array against _exp. coap_parse() only records the first
+ * of consecutive options with the same number.
+ */
+static void _check_options(bool parsed)
+{
+    unsigned i = 0;
+
+    for (unsigned e = 0; e < ARRAY_SIZE(_exp); e++) {
+        if (parsed && (e > 0) && (_exp[e].num == _exp[e - 1].num)) {
+            continue;
+        }
+        TEST_ASSERT(i < _pkt.options_len);
+        TEST_ASSERT_EQUAL_INT(_exp[e].num, _pkt.options[i].opt_num);
+#ifdef MODULE_NANOCOAP_OPTION_INDEX
+        TEST_ASSERT_EQUAL_INT(_exp[e].len, _pkt.options[i].len);
+        TEST_ASSERT_EQUAL_INT(_exp[e].hdr_len, _pkt.options[i].hdr_len);
+#endif
+        i++;
+    }
+    TEST_ASSERT_EQUAL_INT(i, _pkt.options_len);
+}
+
+static void test_nanocoap_option_index__built(void)
+{
+    _build();
+    _check_options(false);
+    _check_values();
+    _check_lookup();
+}
+
+static void test_nanocoap_option_index__parsed(void)
+{
+    _build_and_parse();
+    _check_options(true);
+    _check_values();
+    _check_lookup();
+}
+
+static void test_nanocoap_option_index__not_found(void)
+{
+    static const uint16_t missing[] = {
+        0, 2, 4, 13, 16, 59, 61, 2048, 2050, UINT16_MAX,
+    };
+
+    _build_and_parse();
+    for (unsigned i = 0; i < ARRAY_SIZE(missing); i++) {
+        uint8_t *value;
+        uint32_t uint_value;
+
+        TEST_ASSERT_EQUAL_INT(-ENOENT,
+                              coap_opt_get_opaque(&_pkt, missing[i], &value));
+        TEST_ASSERT_EQUAL_INT(-ENOENT,
+                              coap_opt_get_uint(&_pkt, missing[i],
+                                                &uint_value));
+    }
+}
+
+static void test_nanocoap_option_index__single(void)
+{
+    uint8_t token[2] = { 0xda, 0xec };
+    size_t len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_NON, token,
+                                sizeof(token), COAP_METHOD_GET, 0xabcd);
+    uint32_t uint_value;
+
+    coap_pkt_init(&_pkt, _buf, sizeof(_buf), len);
+    /* no options at all */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_uint(&_pkt,
+                                                     COAP_OPT_CONTENT_FORMAT,
+                                                     &uint_value));
+    TEST_ASSERT(coap_opt_add_uint(&_pkt, COAP_OPT_CONTENT_FORMAT,
+                                  COAP_FORMAT_TEXT) > 0);
+    len = coap_opt_finish(&_pkt, COAP_OPT_FINISH_NONE);
+    memset(&_pkt, 0, sizeof(_pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&_pkt, _buf, len));
+    TEST_ASSERT_EQUAL_INT(1, _pkt.options_len);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_uint(&_pkt, COAP_OPT_URI_PATH,
+                                                     &uint_value));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_uint(&_pkt, COAP_OPT_ACCEPT,
+                                                     &uint_value));
+    /* COAP_FORMAT_TEXT is 0, so the option value is empty */
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&_pkt, COAP_OPT_CONTENT_FORMAT,
+                                               &uint_value));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_TEXT, uint_value);
+}
+
+Test *tests_nanocoap_option_index_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_option_index__built),
+        new_TestFixture(test_nanocoap_option_index__parsed),
+        new_TestFixture(test_nanocoap_option_index__not_found),
+        new_TestFixture(test_nanocoap_option_index__single),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_option_index_tests, NULL, NULL, fixtures);
+
+    return (Test *)&nanocoap_option_index_tests;
+}
+
+void tests_nanocoap_option_index(void)
+{
+    TESTS_RUN(tests_nanocoap_option_index_tests());
+}
+/** @} */
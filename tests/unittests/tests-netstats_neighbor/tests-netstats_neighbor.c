@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include "embUnit.h"
+
+#include "net/netstats/neighbor.h"
+
+#include "tests-netstats_neighbor.h"
+
+#define ADDR_LEN    (8U)
+
+static netstats_nb_table_t _table;
+static const uint8_t _addr1[] = { 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+static const uint8_t _addr2[] = { 0x02, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17 };
+
+static void set_up(void)
+{
+    netstats_nb_init(&_table);
+}
+
+static void test_netstats_nb_get__empty(void)
+{
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr1, sizeof(_addr1)));
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr1, 0));
+}
+
+static void test_netstats_nb_record(void)
+{
+    const netstats_nb_t *nb;
+
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR,
+                          nb->etx);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_count);
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr2, sizeof(_addr2)));
+    /* shorter address with the same prefix is another neighbor */
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, _addr1, 2));
+    TEST_ASSERT_EQUAL_INT(1, _table.queue_len);
+}
+
+static void test_netstats_nb_update_tx__success(void)
+{
+    const netstats_nb_t *nb;
+
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    /* first sample replaces initial value */
+    TEST_ASSERT_EQUAL_INT(NETSTATS_NB_ETX_DIVISOR, nb->etx);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_failed);
+    TEST_ASSERT_EQUAL_INT(0, _table.queue_len);
+}
+
+static void test_netstats_nb_update_tx__ewma(void)
+{
+    const netstats_nb_t *nb;
+    unsigned sample = (3 + 1 + CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY) *
+                      NETSTATS_NB_ETX_DIVISOR;
+
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_NOACK, 3);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(((NETSTATS_NB_ETX_DIVISOR *
+                            (100 - CONFIG_NETSTATS_NB_EWMA_ALPHA)) +
+                           (sample * CONFIG_NETSTATS_NB_EWMA_ALPHA)) / 100,
+                          nb->etx);
+    TEST_ASSERT_EQUAL_INT(2, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_failed);
+}
+
+static void test_netstats_nb_update_tx__busy(void)
+{
+    const netstats_nb_t *nb;
+
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_BUSY, 0);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR,
+                          nb->etx);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(0, _table.queue_len);
+}
+
+static void test_netstats_nb_update_tx__order(void)
+{
+    const netstats_nb_t *nb;
+
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    /* multicast frame in between */
+    netstats_nb_record(&_table, NULL, 0);
+    netstats_nb_record(&_table, _addr2, sizeof(_addr2));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 1);
+    netstats_nb_update_tx(&_table, NETSTATS_NB_NOACK, 0);
+    netstats_nb_update_tx(&_table, NETSTATS_NB_NOACK, 0);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(2 * NETSTATS_NB_ETX_DIVISOR, nb->etx);
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_failed);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr2, sizeof(_addr2))));
+    TEST_ASSERT_EQUAL_INT((1 + CONFIG_NETSTATS_NB_ETX_NOACK_PENALTY) *
+                          NETSTATS_NB_ETX_DIVISOR, nb->etx);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_failed);
+    /* no frame left, so this is ignored */
+    netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_count);
+}
+
+static void test_netstats_nb_drop_last(void)
+{
+    const netstats_nb_t *nb;
+
+    /* frame to addr1 is in flight when the one to addr2 is rejected */
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    netstats_nb_record(&_table, _addr2, sizeof(_addr2));
+    netstats_nb_drop_last(&_table);
+    TEST_ASSERT_EQUAL_INT(1, _table.queue_len);
+    netstats_nb_update_tx(&_table, NETSTATS_NB_NOACK, 0);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(1, nb->tx_failed);
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr2, sizeof(_addr2))));
+    TEST_ASSERT_EQUAL_INT(0, nb->tx_count);
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR,
+                          nb->etx);
+    /* nothing left to drop */
+    netstats_nb_drop_last(&_table);
+    netstats_nb_drop_last(&_table);
+    TEST_ASSERT_EQUAL_INT(0, _table.queue_len);
+}
+
+static void test_netstats_nb_record__queue_full(void)
+{
+    const netstats_nb_t *nb;
+
+    for (unsigned i = 0; i <= CONFIG_NETSTATS_NB_QUEUE_SIZE; i++) {
+        netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_NB_QUEUE_SIZE, _table.queue_len);
+    for (unsigned i = 0; i <= CONFIG_NETSTATS_NB_QUEUE_SIZE; i++) {
+        netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    }
+    TEST_ASSERT_NOT_NULL((nb = netstats_nb_get(&_table, _addr1, sizeof(_addr1))));
+    TEST_ASSERT_EQUAL_INT(CONFIG_NETSTATS_NB_QUEUE_SIZE, nb->tx_count);
+}
+
+static void test_netstats_nb_record__evict(void)
+{
+    uint8_t addr[ADDR_LEN] = { 0 };
+
+    for (unsigned i = 0; i < CONFIG_NETSTATS_NB_SIZE; i++) {
+        addr[ADDR_LEN - 1] = i;
+        netstats_nb_record(&_table, addr, sizeof(addr));
+        netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    }
+    /* use the first neighbor again, so the second is the least recently
+     * used */
+    addr[ADDR_LEN - 1] = 0;
+    netstats_nb_record(&_table, addr, sizeof(addr));
+    netstats_nb_update_tx(&_table, NETSTATS_NB_SUCCESS, 0);
+    netstats_nb_record(&_table, _addr1, sizeof(_addr1));
+    TEST_ASSERT_NOT_NULL(netstats_nb_get(&_table, _addr1, sizeof(_addr1)));
+    TEST_ASSERT_NOT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+    addr[ADDR_LEN - 1] = 1;
+    TEST_ASSERT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+    for (unsigned i = 2; i < CONFIG_NETSTATS_NB_SIZE; i++) {
+        addr[ADDR_LEN - 1] = i;
+        TEST_ASSERT_NOT_NULL(netstats_nb_get(&_table, addr, sizeof(addr)));
+    }
+}
+
+Test *tests_netstats_neighbor_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netstats_nb_get__empty),
+        new_TestFixture(test_netstats_nb_record),
+        new_TestFixture(test_netstats_nb_update_tx__success),
+        new_TestFixture(test_netstats_nb_update_tx__ewma),
+        new_TestFixture(test_netstats_nb_update_tx__busy),
+        new_TestFixture(test_netstats_nb_update_tx__order),
+        new_TestFixture(test_netstats_nb_drop_last),
+        new_TestFixture(test_netstats_nb_record__queue_full),
+        new_TestFixture(test_netstats_nb_record__evict),
+    };
+
+    EMB_UNIT_TESTCALLER(netstats_neighbor_tests, set_up, NULL, fixtures);
+
+    return (Test *)&netstats_neighbor_tests;
+}
+
+void tests_netstats_neighbor(void)
+{
+    TESTS_RUN(tests_netstats_neighbor_tests());
+}
+/** @} */
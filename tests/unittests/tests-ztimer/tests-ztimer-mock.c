@@ -15,6 +15,7 @@
  * @author      Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include "kernel_defines.h"
 #include "ztimer.h"
 #include "ztimer/mock.h"
 
@@ -249,6 +250,77 @@ static void test_ztimer_mock_set16(void)
     TEST_ASSERT_EQUAL_INT(0x100207d2, now);
 }
 
+/**
+ * @brief   State of a timer in test_ztimer_mock_set_many()
+ */
+typedef struct {
+    ztimer_t timer;             /**< the timer */
+    ztimer_mock_t *zmock;       /**< clock the timer is set on */
+    uint32_t target;            /**< expected trigger time */
+    uint32_t fired;             /**< time the timer triggered at */
+    unsigned count;             /**< number of triggers */
+} many_timer_t;
+
+static void cb_record(void *arg)
+{
+    many_timer_t *t = arg;
+
+    t->fired = t->zmock->now;
+    t->count++;
+}
+
+static uint32_t _lcg(uint32_t *state)
+{
+    *state = (*state * 1103515245ul) + 12345ul;
+    return *state;
+}
+
+/**
+ * @brief   Testing many timers with spread out targets, including removal
+ *          and re-setting of already set timers
+ */
+static void test_ztimer_mock_set_many(void)
+{
+    static many_timer_t timers[64];
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t seed = 0x5eed;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_jump(&zmock, 0xfff00000ul);   /* wrap around during test */
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        /* mix of near, medium and far targets */
+        uint32_t val = _lcg(&seed) >> ((i % 3) * 6 + 8);
+
+        timers[i] = (many_timer_t){
+            .timer = { .callback = cb_record, .arg = &timers[i] },
+            .zmock = &zmock,
+            .target = zmock.now + val,
+        };
+        ztimer_set(z, &timers[i].timer, val);
+    }
+    /* remove every 8th timer, re-set every 8th with an offset of 4 */
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i += 8) {
+        ztimer_remove(z, &timers[i].timer);
+        ztimer_remove(z, &timers[i + 4].timer);
+        timers[i + 4].target = zmock.now + 1000;
+        ztimer_set(z, &timers[i + 4].timer, 1000);
+    }
+    /* advance in irregular steps until all targets have passed */
+    for (unsigned step = 0; step < 4096; step++) {
+        ztimer_mock_advance(&zmock, _lcg(&seed) >> 16);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        if ((i % 8) == 0) {
+            TEST_ASSERT_EQUAL_INT(0, timers[i].count);
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(1, timers[i].count);
+            TEST_ASSERT_EQUAL_INT(timers[i].target, timers[i].fired);
+        }
+    }
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -258,6 +330,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_now3),
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
+        new_TestFixture(test_ztimer_mock_set_many),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer timing wheel
+ *
+ * The tests only use the ztimer API and pass with the sorted list as well.
+ * With `ztimer_wheel` they additionally check that timers are cascaded
+ * through the levels of the wheel.
+ */
+
+#include "kernel_defines.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer_wheel.h"
+
+#define TIMERS_NUMOF    (9U)
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+/* returns the highest occupied level of the wheel, or -1 */
+static int _top_level(const ztimer_clock_t *z)
+{
+#if MODULE_ZTIMER_WHEEL
+    for (int level = ZTIMER_WHEEL_LEVELS - 1; level >= 0; level--) {
+        if (z->wheel_map[level]) {
+            return level;
+        }
+    }
+#else
+    (void)z;
+#endif
+    return -1;
+}
+
+/**
+ * @brief   Timers on every level of the wheel trigger in order
+ */
+static void test_ztimer_wheel_levels(void)
+{
+    static const uint32_t offsets[TIMERS_NUMOF] = {
+        0x10000000ul, 0x1ul, 0x100000ul, 0x10ul, 0xf0000000ul, 0x1000ul,
+        0x1000000ul, 0x100ul, 0x10000ul,
+    };
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t timers[TIMERS_NUMOF];
+    uint32_t count[TIMERS_NUMOF] = { 0 };
+    uint32_t now = 0;
+
+    ztimer_mock_init(&zmock, 32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        timers[i] = (ztimer_t){ .callback = cb_incr, .arg = &count[i] };
+        ztimer_set(z, &timers[i], offsets[i]);
+    }
+    /* in ascending order of the offsets */
+    static const uint8_t order[TIMERS_NUMOF] = { 1, 3, 7, 5, 8, 2, 6, 0, 4 };
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        unsigned idx = order[i];
+
+        ztimer_mock_advance(&zmock, offsets[idx] - 1 - now);
+        TEST_ASSERT_EQUAL_INT(0, count[idx]);
+        ztimer_mock_advance(&zmock, 1);
+        now = offsets[idx];
+        TEST_ASSERT_EQUAL_INT(1, count[idx]);
+        for (unsigned j = i + 1; j < TIMERS_NUMOF; j++) {
+            TEST_ASSERT_EQUAL_INT(0, count[order[j]]);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _top_level(z));
+}
+
+/**
+ * @brief   A timer is cascaded down level by level and neither triggers
+ *          early nor late
+ */
+static void test_ztimer_wheel_cascade(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    int level = -1;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_set(z, &alarm, 0x123456ul);
+    if (IS_USED(MODULE_ZTIMER_WHEEL)) {
+        level = _top_level(z);
+        TEST_ASSERT(level > 0);
+    }
+    /* advance to the start of each slot the timer passes through */
+    static const uint32_t steps[] = {
+        0x100000ul, 0x120000ul, 0x123000ul, 0x123400ul, 0x123450ul,
+    };
+    uint32_t now = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(steps); i++) {
+        ztimer_mock_advance(&zmock, steps[i] - now);
+        now = steps[i];
+        TEST_ASSERT_EQUAL_INT(0, count);
+        if (IS_USED(MODULE_ZTIMER_WHEEL)) {
+            /* the timer moved down */
+            TEST_ASSERT(_top_level(z) < level);
+            level = _top_level(z);
+        }
+    }
+    ztimer_mock_advance(&zmock, 0x123455ul - now);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 0x1000000ul);
+    TEST_ASSERT_EQUAL_INT(1, count);
+}
+
+/**
+ * @brief   Removing a timer that was cascaded to a lower level
+ */
+static void test_ztimer_wheel_remove_cascaded(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count_a = 0;
+    uint32_t count_b = 0;
+    ztimer_t a = { .callback = cb_incr, .arg = &count_a, };
+    ztimer_t b = { .callback = cb_incr, .arg = &count_b, };
+
+    ztimer_mock_init(&zmock, 32);
+    /* both share the slots of the upper levels */
+    ztimer_set(z, &a, 0x5432ul);
+    ztimer_set(z, &b, 0x5437ul);
+    ztimer_mock_advance(&zmock, 0x5430ul);
+    ztimer_remove(z, &a);
+    ztimer_mock_advance(&zmock, 6);
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    TEST_ASSERT_EQUAL_INT(0, count_b);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    TEST_ASSERT_EQUAL_INT(1, count_b);
+    TEST_ASSERT_EQUAL_INT(-1, _top_level(z));
+}
+
+/**
+ * @brief   Timers whose target wraps around the 32 bit time
+ */
+static void test_ztimer_wheel_wrap_around(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count_a = 0;
+    uint32_t count_b = 0;
+    uint32_t count_c = 0;
+    ztimer_t a = { .callback = cb_incr, .arg = &count_a, };
+    ztimer_t b = { .callback = cb_incr, .arg = &count_b, };
+    ztimer_t c = { .callback = cb_incr, .arg = &count_c, };
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_jump(&zmock, 0xfffffff0ul);
+    /* b differs from now in the most significant digit */
+    ztimer_set(z, &a, 0x8ul);           /* at 0xfffffff8 */
+    ztimer_set(z, &b, 0x20ul);          /* at 0x00000010 */
+    ztimer_set(z, &c, 0x10000010ul);    /* at 0x10000000 */
+    ztimer_mock_advance(&zmock, 0x7);
+    TEST_ASSERT_EQUAL_INT(0, count_a);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count_a);
+    /* now = 0xfffffff8, reach 0 */
+    ztimer_mock_advance(&zmock, 0x8);
+    TEST_ASSERT_EQUAL_INT(0, count_b);
+    TEST_ASSERT_EQUAL_INT(0, ztimer_now(z));
+    ztimer_mock_advance(&zmock, 0xf);
+    TEST_ASSERT_EQUAL_INT(0, count_b);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count_b);
+    TEST_ASSERT_EQUAL_INT(0, count_c);
+    /* now = 0x10 */
+    ztimer_mock_advance(&zmock, 0x0fffffeful);
+    TEST_ASSERT_EQUAL_INT(0, count_c);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count_c);
+    TEST_ASSERT_EQUAL_INT(-1, _top_level(z));
+
+    /* the full 32 bit offset at the wrap-around */
+    ztimer_set(z, &a, UINT32_MAX);
+    ztimer_mock_advance(&zmock, UINT32_MAX - 1);
+    TEST_ASSERT_EQUAL_INT(1, count_a);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count_a);
+}
+
+static ztimer_mock_t _rearm_mock;
+static ztimer_t _rearm_timer;
+static uint32_t _rearm_count;
+
+static void _cb_rearm(void *arg)
+{
+    (void)arg;
+    if (++_rearm_count < 3) {
+        ztimer_set(&_rearm_mock.super, &_rearm_timer, 0x10);
+    }
+}
+
+/**
+ * @brief   A timer set again from its callback still triggers, also across
+ *          the boundary of a slot of the top level
+ */
+static void test_ztimer_wheel_rearm(void)
+{
+    _rearm_count = 0;
+    _rearm_timer = (ztimer_t){ .callback = _cb_rearm };
+    ztimer_mock_init(&_rearm_mock, 32);
+    ztimer_mock_jump(&_rearm_mock, 0x0ffffff8ul);
+    ztimer_set(&_rearm_mock.super, &_rearm_timer, 0x10);
+    for (unsigned i = 1; i <= 3; i++) {
+        ztimer_mock_advance(&_rearm_mock, 0xf);
+        TEST_ASSERT_EQUAL_INT(i - 1, _rearm_count);
+        ztimer_mock_advance(&_rearm_mock, 1);
+        TEST_ASSERT_EQUAL_INT(i, _rearm_count);
+    }
+    ztimer_mock_advance(&_rearm_mock, 0x1000);
+    TEST_ASSERT_EQUAL_INT(3, _rearm_count);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_levels),
+        new_TestFixture(test_ztimer_wheel_cascade),
+        new_TestFixture(test_ztimer_wheel_remove_cascaded),
+        new_TestFixture(test_ztimer_wheel_wrap_around),
+        new_TestFixture(test_ztimer_wheel_rearm),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_wheel_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_wheel_tests;
+}
+
+void tests_ztimer_wheel(void)
+{
+    TESTS_RUN(tests_ztimer_wheel_tests());
+}
+/** @} */